@@ -0,0 +1,161 @@
+/**
+  ******************************************************************************
+  * @file    font12_packed.c
+  * @brief   Font12 packed by fontc, do not edit
+  ******************************************************************************
+  */
+
+#include "fonts.h"
+
+static const uint8_t Font12_Packed_Data[] =
+{
+	0xF9, 0xDC, 0xA4, 0x29, 0x55, 0xF5, 0x7D, 0x54, 0xA0, 0x27, 0x88, 0x79,
+	0xE2, 0x20, 0x45, 0x10, 0x3E, 0x08, 0xA2, 0x32, 0x11, 0x59, 0x34, 0xF0,
+	0x5A, 0xAA, 0x50, 0xA5, 0x55, 0xA0, 0x27, 0xC8, 0xA5, 0x00, 0x10, 0x20,
+	0x47, 0xF1, 0x02, 0x04, 0x00, 0x6B, 0x40, 0xF8, 0xF0, 0x08, 0x44, 0x22,
+	0x11, 0x08, 0x80, 0x74, 0x63, 0x18, 0xC6, 0x2E, 0x61, 0x08, 0x42, 0x10,
+	0x9F, 0x74, 0x42, 0x22, 0x22, 0x3F, 0x74, 0x42, 0x60, 0x86, 0x2E, 0x18,
+	0xA2, 0x92, 0x8B, 0xF0, 0x87, 0x7A, 0x10, 0xE0, 0x86, 0x2E, 0x3A, 0x21,
+	0xE8, 0xC6, 0x2E, 0xFC, 0x42, 0x21, 0x08, 0x84, 0x74, 0x62, 0xE8, 0xC6,
+	0x2E, 0x74, 0x63, 0x17, 0x84, 0x5C, 0xF0, 0xF0, 0x6C, 0x07, 0xA0, 0x0C,
+	0x46, 0x20, 0x60, 0x40, 0xC0, 0xF8, 0x3E, 0xC0, 0x81, 0x81, 0x18, 0x8C,
+	0x00, 0x69, 0x12, 0x40, 0xC0, 0x74, 0x63, 0x3A, 0xD6, 0x70, 0x8B, 0x80,
+	0x30, 0x20, 0xA1, 0x42, 0x8F, 0x91, 0x77, 0xF9, 0x14, 0x5E, 0x45, 0x14,
+	0x7E, 0x7C, 0x61, 0x08, 0x42, 0x2E, 0xF1, 0x24, 0x51, 0x45, 0x14, 0xBC,
+	0xFD, 0x15, 0x1C, 0x51, 0x04, 0x7F, 0xFD, 0x15, 0x1C, 0x51, 0x04, 0x38,
+	0x7A, 0x28, 0x20, 0x9E, 0x28, 0x9C, 0xEE, 0x89, 0x13, 0xE4, 0x48, 0x91,
+	0x77, 0xF9, 0x08, 0x42, 0x10, 0x9F, 0x78, 0x84, 0x29, 0x4A, 0x4C, 0xEE,
+	0x89, 0x22, 0x87, 0x09, 0x11, 0x73, 0xE2, 0x10, 0x84, 0x25, 0x3F, 0xEE,
+	0xD9, 0xB2, 0xA5, 0x48, 0x91, 0x77, 0xEE, 0xC9, 0x92, 0xA5, 0x4A, 0x93,
+	0x76, 0x74, 0x63, 0x18, 0xC6, 0x2E, 0xF2, 0x52, 0x97, 0x21, 0x1C, 0x74,
+	0x63, 0x18, 0xC6, 0x2E, 0x38, 0xF8, 0x89, 0x12, 0x27, 0x89, 0x11, 0x71,
+	0x6C, 0xE0, 0xE0, 0x87, 0x36, 0xFF, 0x24, 0x40, 0x81, 0x02, 0x04, 0x1C,
+	0xEE, 0x89, 0x12, 0x24, 0x48, 0x91, 0x1C, 0xEE, 0x89, 0x11, 0x42, 0x85,
+	0x04, 0x08, 0xEE, 0x89, 0x12, 0xA5, 0x4A, 0x95, 0x14, 0xC6, 0x88, 0xA0,
+	0x81, 0x05, 0x11, 0x63, 0xEE, 0x88, 0xA1, 0x41, 0x02, 0x04, 0x1C, 0xFC,
+	0x44, 0x42, 0x22, 0x3F, 0xF2, 0x49, 0x24, 0x9C, 0x84, 0x44, 0x22, 0x11,
+	0x10, 0xE4, 0x92, 0x49, 0x3C, 0x21, 0x15, 0x10, 0xFE, 0x90, 0x72, 0x27,
+	0xA2, 0x89, 0xF0, 0xC1, 0x05, 0x99, 0x45, 0x14, 0x7E, 0x7C, 0x61, 0x08,
+	0xB8, 0x18, 0x26, 0xA6, 0x8A, 0x28, 0x9F, 0x74, 0x7F, 0x08, 0x3C, 0x3A,
+	0x3E, 0x84, 0x21, 0x1F, 0x6E, 0x68, 0xA2, 0x89, 0xE0, 0x9C, 0xC0, 0x81,
+	0x63, 0x24, 0x48, 0x91, 0x77, 0x20, 0x38, 0x42, 0x10, 0x9F, 0x20, 0xF1,
+	0x11, 0x11, 0x1E, 0xC1, 0x05, 0xD2, 0x71, 0x44, 0xB7, 0x61, 0x08, 0x42,
+	0x10, 0x9F, 0xE8, 0xA9, 0x52, 0xA5, 0x5F, 0xC0, 0xD8, 0xC9, 0x12, 0x24,
+	0x5D, 0xC0, 0x74, 0x63, 0x18, 0xB8, 0xD9, 0x94, 0x51, 0x45, 0xE4, 0x38,
+	0x6E, 0x68, 0xA2, 0x89, 0xE0, 0x87, 0xDB, 0x10, 0x84, 0x7C, 0x7C, 0x5C,
+	0x18, 0xF8, 0x43, 0xE4, 0x10, 0x41, 0x13, 0x80, 0xCC, 0x89, 0x12, 0x24,
+	0xC6, 0xC0, 0xEE, 0x89, 0x11, 0x42, 0x82, 0x00, 0xEE, 0x89, 0x52, 0xA5,
+	0x45, 0x00, 0xCD, 0x23, 0x0C, 0x4B, 0x30, 0xEE, 0x88, 0x91, 0x41, 0x82,
+	0x04, 0x3C, 0xFC, 0x88, 0x88, 0xFC, 0x29, 0x25, 0x12, 0x44, 0xFF, 0x80,
+	0x89, 0x24, 0x52, 0x50, 0x4D, 0x80,
+};
+
+static const sGLYPH Font12_Packed_Glyphs[] =
+{
+	{    0,   0,  0,  0,  0 }, /* ' ' */
+	{    0,   3,  1,  1,  8 }, /* '!' */
+	{    1,   1,  1,  5,  3 }, /* '"' */
+	{    3,   1,  1,  5,  9 }, /* '#' */
+	{    9,   1,  1,  4,  9 }, /* '$' */
+	{   14,   1,  1,  5,  8 }, /* '%' */
+	{   19,   1,  3,  5,  6 }, /* '&' */
+	{   23,   3,  1,  1,  4 }, /* '\'' */
+	{   24,   3,  1,  2, 10 }, /* '(' */
+	{   27,   2,  1,  2, 10 }, /* ')' */
+	{   30,   1,  1,  5,  5 }, /* '*' */
+	{   34,   0,  2,  7,  7 }, /* '+' */
+	{   41,   2,  7,  3,  4 }, /* ',' */
+	{   43,   1,  5,  5,  1 }, /* '-' */
+	{   44,   2,  7,  2,  2 }, /* '.' */
+	{   45,   1,  1,  5,  9 }, /* '/' */
+	{   51,   1,  1,  5,  8 }, /* '0' */
+	{   56,   1,  1,  5,  8 }, /* '1' */
+	{   61,   1,  1,  5,  8 }, /* '2' */
+	{   66,   1,  1,  5,  8 }, /* '3' */
+	{   71,   1,  1,  6,  8 }, /* '4' */
+	{   77,   1,  1,  5,  8 }, /* '5' */
+	{   82,   1,  1,  5,  8 }, /* '6' */
+	{   87,   1,  1,  5,  8 }, /* '7' */
+	{   92,   1,  1,  5,  8 }, /* '8' */
+	{   97,   1,  1,  5,  8 }, /* '9' */
+	{  102,   2,  3,  2,  6 }, /* ':' */
+	{  104,   2,  3,  3,  7 }, /* ';' */
+	{  107,   0,  2,  6,  7 }, /* '<' */
+	{  113,   1,  4,  5,  3 }, /* '=' */
+	{  115,   0,  2,  6,  7 }, /* '>' */
+	{  121,   2,  2,  4,  7 }, /* '?' */
+	{  125,   1,  0,  5, 10 }, /* '@' */
+	{  132,   0,  1,  7,  8 }, /* 'A' */
+	{  139,   0,  1,  6,  8 }, /* 'B' */
+	{  145,   1,  1,  5,  8 }, /* 'C' */
+	{  150,   0,  1,  6,  8 }, /* 'D' */
+	{  156,   0,  1,  6,  8 }, /* 'E' */
+	{  162,   1,  1,  6,  8 }, /* 'F' */
+	{  168,   1,  1,  6,  8 }, /* 'G' */
+	{  174,   0,  1,  7,  8 }, /* 'H' */
+	{  181,   1,  1,  5,  8 }, /* 'I' */
+	{  186,   1,  1,  5,  8 }, /* 'J' */
+	{  191,   0,  1,  7,  8 }, /* 'K' */
+	{  198,   1,  1,  5,  8 }, /* 'L' */
+	{  203,   0,  1,  7,  8 }, /* 'M' */
+	{  210,   0,  1,  7,  8 }, /* 'N' */
+	{  217,   1,  1,  5,  8 }, /* 'O' */
+	{  222,   1,  1,  5,  8 }, /* 'P' */
+	{  227,   1,  1,  5,  9 }, /* 'Q' */
+	{  233,   0,  1,  7,  8 }, /* 'R' */
+	{  240,   1,  1,  5,  8 }, /* 'S' */
+	{  245,   0,  1,  7,  8 }, /* 'T' */
+	{  252,   0,  1,  7,  8 }, /* 'U' */
+	{  259,   0,  1,  7,  8 }, /* 'V' */
+	{  266,   0,  1,  7,  8 }, /* 'W' */
+	{  273,   0,  1,  7,  8 }, /* 'X' */
+	{  280,   0,  1,  7,  8 }, /* 'Y' */
+	{  287,   1,  1,  5,  8 }, /* 'Z' */
+	{  292,   2,  1,  3, 10 }, /* '[' */
+	{  296,   1,  1,  4,  9 }, /* '\\' */
+	{  301,   2,  1,  3, 10 }, /* ']' */
+	{  305,   1,  1,  5,  4 }, /* '^' */
+	{  308,   0, 11,  7,  1 }, /* '_' */
+	{  309,   3,  1,  2,  2 }, /* '`' */
+	{  310,   1,  3,  6,  6 }, /* 'a' */
+	{  315,   0,  1,  6,  8 }, /* 'b' */
+	{  321,   1,  3,  5,  6 }, /* 'c' */
+	{  325,   1,  1,  6,  8 }, /* 'd' */
+	{  331,   1,  3,  5,  6 }, /* 'e' */
+	{  335,   1,  1,  5,  8 }, /* 'f' */
+	{  340,   1,  3,  6,  8 }, /* 'g' */
+	{  346,   0,  1,  7,  8 }, /* 'h' */
+	{  353,   1,  1,  5,  8 }, /* 'i' */
+	{  358,   1,  1,  4, 10 }, /* 'j' */
+	{  363,   0,  1,  6,  8 }, /* 'k' */
+	{  369,   1,  1,  5,  8 }, /* 'l' */
+	{  374,   0,  3,  7,  6 }, /* 'm' */
+	{  380,   0,  3,  7,  6 }, /* 'n' */
+	{  386,   1,  3,  5,  6 }, /* 'o' */
+	{  390,   0,  3,  6,  8 }, /* 'p' */
+	{  396,   1,  3,  6,  8 }, /* 'q' */
+	{  402,   1,  3,  5,  6 }, /* 'r' */
+	{  406,   1,  3,  5,  6 }, /* 's' */
+	{  410,   1,  2,  6,  7 }, /* 't' */
+	{  416,   0,  3,  7,  6 }, /* 'u' */
+	{  422,   0,  3,  7,  6 }, /* 'v' */
+	{  428,   0,  3,  7,  6 }, /* 'w' */
+	{  434,   0,  3,  6,  6 }, /* 'x' */
+	{  439,   0,  3,  7,  8 }, /* 'y' */
+	{  446,   1,  3,  5,  6 }, /* 'z' */
+	{  450,   2,  1,  3, 10 }, /* '{' */
+	{  454,   3,  1,  1,  9 }, /* '|' */
+	{  456,   2,  1,  3, 10 }, /* '}' */
+	{  460,   1,  5,  5,  2 }, /* '~' */
+};
+
+sPFONT Font12_Packed = {
+  Font12_Packed_Data,
+  Font12_Packed_Glyphs,
+  0, /* Advances */
+  7, /* Advance */
+  FONT_GLYPH_BITS,
+  32, /* First */
+  95, /* Count */
+  12, /* Height */
+};
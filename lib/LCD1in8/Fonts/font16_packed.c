@@ -0,0 +1,191 @@
+/**
+  ******************************************************************************
+  * @file    font16_packed.c
+  * @brief   Font16 packed by fontc, do not edit
+  ******************************************************************************
+  */
+
+#include "fonts.h"
+
+static const uint8_t Font16_Packed_Data[] =
+{
+	0xFF, 0xFF, 0x30, 0xEF, 0xDD, 0x12, 0x24, 0x40, 0x36, 0x36, 0x36, 0x36,
+	0xFF, 0x6C, 0xFF, 0x6C, 0x6C, 0x6C, 0x6C, 0x10, 0xFF, 0x1E, 0x3E, 0x0F,
+	0x0F, 0x07, 0xC7, 0x8F, 0xF0, 0x81, 0x00, 0x60, 0x90, 0x90, 0x63, 0x1E,
+	0x78, 0xC6, 0x09, 0x09, 0x06, 0x3C, 0xC1, 0x83, 0x03, 0x0E, 0xF7, 0x66,
+	0x76, 0xFD, 0x24, 0x33, 0x6E, 0xCC, 0xCC, 0xE6, 0x33, 0xCC, 0x63, 0x33,
+	0x33, 0x36, 0xEC, 0x18, 0x18, 0xFF, 0xFF, 0x3C, 0x7E, 0x66, 0x10, 0x20,
+	0x47, 0xF1, 0x02, 0x04, 0x00, 0x6B, 0x48, 0xFE, 0xF0, 0x03, 0x03, 0x06,
+	0x06, 0x0C, 0x0C, 0x18, 0x30, 0x30, 0x60, 0x60, 0xC0, 0xC0, 0x38, 0xDB,
+	0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0x6C, 0x70, 0x18, 0xF8, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0xFF, 0x3C, 0xCF, 0x1E, 0x30, 0xC3, 0x0C, 0x30,
+	0xC1, 0xFC, 0x7E, 0xC3, 0x03, 0x06, 0x3E, 0x07, 0x03, 0x03, 0xC3, 0x7E,
+	0x1C, 0x38, 0xF1, 0x66, 0xC9, 0xB3, 0x7F, 0x0C, 0x7C, 0x7E, 0xC1, 0x83,
+	0x07, 0xC8, 0xC1, 0x83, 0x86, 0xF8, 0x1E, 0xE1, 0x86, 0x0D, 0xDC, 0xF1,
+	0xE3, 0x66, 0x78, 0xFF, 0x0C, 0x18, 0x60, 0xC1, 0x83, 0x0C, 0x18, 0x30,
+	0x7D, 0x8F, 0x1E, 0x37, 0xD8, 0xF1, 0xE3, 0xC6, 0xF8, 0x79, 0x9B, 0x1E,
+	0x3C, 0xEE, 0xC1, 0x86, 0x1D, 0xE0, 0xF0, 0x3C, 0x33, 0x00, 0x06, 0x48,
+	0x80, 0x01, 0x83, 0x02, 0x06, 0x0C, 0x01, 0x80, 0x20, 0x0C, 0x01, 0x80,
+	0xFF, 0x80, 0x3F, 0xE0, 0xC0, 0x18, 0x02, 0x00, 0xC0, 0x18, 0x30, 0x20,
+	0x60, 0xC0, 0x00, 0x7D, 0x8F, 0x18, 0x31, 0xC6, 0x0C, 0x00, 0x30, 0x39,
+	0x18, 0x61, 0x9E, 0x9A, 0x67, 0x81, 0x13, 0x80, 0x7E, 0x07, 0x81, 0x20,
+	0xCC, 0x33, 0x0F, 0xC6, 0x19, 0x86, 0xF3, 0xC0, 0xFE, 0x63, 0x63, 0x63,
+	0x7E, 0x63, 0x63, 0x63, 0xFE, 0x3E, 0xB0, 0xF0, 0x38, 0x0C, 0x06, 0x03,
+	0x02, 0xC2, 0x3E, 0x00, 0xFE, 0x31, 0x98, 0x6C, 0x36, 0x1B, 0x0D, 0x86,
+	0xC6, 0xFE, 0x00, 0xFF, 0x61, 0x61, 0x64, 0x7C, 0x64, 0x61, 0x61, 0xFF,
+	0xFF, 0xB0, 0x58, 0x2C, 0x87, 0xC3, 0x21, 0x80, 0xC0, 0xF8, 0x00, 0x3D,
+	0x31, 0xB0, 0x58, 0x0C, 0x06, 0x7F, 0x0C, 0xC6, 0x3E, 0x00, 0xF7, 0xB1,
+	0x98, 0xCC, 0x67, 0xF3, 0x19, 0x8C, 0xC6, 0xF7, 0x80, 0xFF, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0x3F, 0x83, 0x01, 0x80, 0xC0, 0x66,
+	0x33, 0x19, 0x8C, 0x7C, 0x00, 0xF7, 0xB1, 0x99, 0x8D, 0x87, 0x83, 0xE1,
+	0x98, 0xC6, 0xF3, 0x80, 0xFC, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x84, 0xC2,
+	0x61, 0xFF, 0x80, 0xE0, 0xEC, 0x19, 0xC7, 0x3D, 0xE6, 0xAC, 0xDD, 0x99,
+	0x33, 0x06, 0xFB, 0xE0, 0xE7, 0xB1, 0x9C, 0xCF, 0x66, 0xB3, 0x79, 0x9C,
+	0xC6, 0xF3, 0x00, 0x3E, 0x31, 0xB0, 0x78, 0x3C, 0x1E, 0x0F, 0x06, 0xC6,
+	0x3E, 0x00, 0xFE, 0x63, 0x63, 0x63, 0x63, 0x7E, 0x60, 0x60, 0xFC, 0x3E,
+	0x31, 0xB0, 0x78, 0x3C, 0x1E, 0x0F, 0x06, 0xC6, 0x3E, 0x0C, 0xCF, 0xC0,
+	0xFE, 0x18, 0xC6, 0x31, 0x8C, 0x7C, 0x19, 0x86, 0x31, 0x8C, 0xF9, 0xC0,
+	0x7F, 0x8F, 0x1F, 0x07, 0xC1, 0xF1, 0xE3, 0xFC, 0xFF, 0x99, 0x99, 0x99,
+	0x18, 0x18, 0x18, 0x18, 0x7E, 0xF7, 0xB1, 0x98, 0xCC, 0x66, 0x33, 0x19,
+	0x8C, 0xC6, 0x3E, 0x00, 0xF7, 0xB1, 0x98, 0xC6, 0xC3, 0x61, 0xB0, 0x50,
+	0x38, 0x1C, 0x00, 0xFB, 0xEC, 0x19, 0x93, 0x37, 0x66, 0xEC, 0x55, 0x0E,
+	0xE1, 0xDC, 0x31, 0x80, 0xF7, 0xB1, 0x8D, 0x83, 0x81, 0xC0, 0xE0, 0xD8,
+	0xC6, 0xF7, 0x80, 0xF3, 0xD8, 0x63, 0x30, 0x78, 0x0C, 0x03, 0x00, 0xC0,
+	0x30, 0x3F, 0x00, 0xFF, 0x0E, 0x30, 0xC1, 0x06, 0x18, 0xE1, 0xFE, 0xFC,
+	0xCC, 0xCC, 0xCC, 0xCC, 0xCF, 0xC0, 0xC0, 0x60, 0x60, 0x30, 0x30, 0x18,
+	0x0C, 0x0C, 0x06, 0x06, 0x03, 0x03, 0xF3, 0x33, 0x33, 0x33, 0x33, 0x3F,
+	0x10, 0x50, 0xA2, 0x28, 0x30, 0x40, 0xFF, 0xE0, 0x88, 0x80, 0x7C, 0x06,
+	0x06, 0x7E, 0xC6, 0xCE, 0x77, 0xE0, 0x30, 0x18, 0x0D, 0xC7, 0x33, 0x0D,
+	0x86, 0xC3, 0x73, 0x77, 0x00, 0x3D, 0x63, 0xC1, 0xC0, 0xC1, 0x63, 0x3E,
+	0x07, 0x01, 0x80, 0xC7, 0x66, 0x76, 0x1B, 0x0D, 0x86, 0x67, 0x1D, 0xC0,
+	0x3E, 0x31, 0xB0, 0x7F, 0xFC, 0x03, 0x0C, 0xFC, 0x1F, 0x98, 0x0C, 0x1F,
+	0xC3, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x7F, 0x00, 0x3B, 0xB3, 0xB0, 0xD8,
+	0x6C, 0x33, 0x38, 0xEC, 0x06, 0x03, 0x1F, 0x00, 0xE0, 0x30, 0x18, 0x0D,
+	0xC7, 0x33, 0x19, 0x8C, 0xC6, 0x63, 0x7B, 0xC0, 0x18, 0x18, 0x00, 0x78,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0x18, 0x60, 0x3F, 0x0C, 0x30, 0xC3,
+	0x0C, 0x30, 0xC3, 0xF8, 0xE0, 0x30, 0x18, 0x0D, 0xE6, 0xC3, 0xC1, 0xE0,
+	0xD8, 0x66, 0x77, 0xC0, 0x78, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0xFF, 0xFF, 0x1B, 0x66, 0xD9, 0xB6, 0x6D, 0x9B, 0x6E, 0xDC, 0xEE,
+	0x39, 0x98, 0xCC, 0x66, 0x33, 0x1B, 0xDE, 0x3E, 0x31, 0xB0, 0x78, 0x3C,
+	0x1B, 0x18, 0xF8, 0xEE, 0x39, 0x98, 0x6C, 0x36, 0x1B, 0x99, 0xB8, 0xC0,
+	0x60, 0x7C, 0x00, 0x3B, 0xB3, 0xB0, 0xD8, 0x6C, 0x33, 0x38, 0xEC, 0x06,
+	0x03, 0x07, 0xC0, 0xF7, 0x1C, 0xCC, 0x06, 0x03, 0x01, 0x83, 0xF8, 0x7F,
+	0x8F, 0xC3, 0xE0, 0xF8, 0xFF, 0x00, 0x30, 0x30, 0x30, 0xFE, 0x30, 0x30,
+	0x30, 0x30, 0x31, 0x1E, 0xE7, 0x31, 0x98, 0xCC, 0x66, 0x33, 0x38, 0xEE,
+	0xF7, 0xB1, 0x98, 0xC6, 0xC3, 0x60, 0xE0, 0x70, 0xF1, 0xEC, 0x19, 0x93,
+	0x37, 0x63, 0xB8, 0x77, 0x0C, 0x60, 0xF7, 0x9B, 0x07, 0x03, 0x81, 0xC1,
+	0xB3, 0xDE, 0xF3, 0xD8, 0x63, 0x30, 0xCC, 0x16, 0x07, 0x80, 0xC0, 0x30,
+	0x18, 0x1F, 0x00, 0xFF, 0x0C, 0x31, 0xC6, 0x18, 0x7F, 0x80, 0x36, 0x66,
+	0x66, 0xC6, 0x66, 0x63, 0xFF, 0xFF, 0xFF, 0xC6, 0x66, 0x66, 0x36, 0x66,
+	0x6C, 0x61, 0x24, 0x30,
+};
+
+static const sGLYPH Font16_Packed_Glyphs[] =
+{
+	{    0,   0,  0,  0,  0 }, /* ' ' */
+	{    0,   4,  1,  2, 10 }, /* '!' */
+	{    3,   3,  2,  7,  5 }, /* '"' */
+	{    8,   2,  1,  8, 11 }, /* '#' */
+	{   19,   2,  0,  7, 13 }, /* '$' */
+	{   31,   2,  1,  8, 10 }, /* '%' */
+	{   41,   2,  2,  7,  9 }, /* '&' */
+	{   49,   5,  2,  3,  5 }, /* '\'' */
+	{   51,   4,  1,  4, 12 }, /* '(' */
+	{   57,   3,  1,  4, 12 }, /* ')' */
+	{   63,   2,  1,  8,  7 }, /* '*' */
+	{   70,   2,  3,  7,  7 }, /* '+' */
+	{   77,   4,  9,  3,  5 }, /* ',' */
+	{   79,   2,  6,  7,  1 }, /* '-' */
+	{   80,   4,  9,  2,  2 }, /* '.' */
+	{   81,   2,  0,  8, 13 }, /* '/' */
+	{   94,   2,  1,  7, 10 }, /* '0' */
+	{  103,   2,  1,  8, 10 }, /* '1' */
+	{  113,   2,  1,  7, 10 }, /* '2' */
+	{  122,   1,  1,  8, 10 }, /* '3' */
+	{  132,   2,  1,  7, 10 }, /* '4' */
+	{  141,   2,  1,  7, 10 }, /* '5' */
+	{  150,   2,  1,  7, 10 }, /* '6' */
+	{  159,   1,  1,  7, 10 }, /* '7' */
+	{  168,   2,  1,  7, 10 }, /* '8' */
+	{  177,   2,  1,  7, 10 }, /* '9' */
+	{  186,   4,  4,  2,  7 }, /* ':' */
+	{  188,   4,  4,  4,  9 }, /* ';' */
+	{  193,   1,  2,  9,  9 }, /* '<' */
+	{  204,   1,  5,  9,  3 }, /* '=' */
+	{  208,   1,  2,  9,  9 }, /* '>' */
+	{  219,   2,  2,  7,  9 }, /* '?' */
+	{  227,   2,  1,  6, 11 }, /* '@' */
+	{  236,   1,  2, 10,  9 }, /* 'A' */
+	{  248,   1,  2,  8,  9 }, /* 'B' */
+	{  257,   1,  2,  9,  9 }, /* 'C' */
+	{  268,   1,  2,  9,  9 }, /* 'D' */
+	{  279,   1,  2,  8,  9 }, /* 'E' */
+	{  288,   1,  2,  9,  9 }, /* 'F' */
+	{  299,   1,  2,  9,  9 }, /* 'G' */
+	{  310,   1,  2,  9,  9 }, /* 'H' */
+	{  321,   2,  2,  8,  9 }, /* 'I' */
+	{  330,   1,  2,  9,  9 }, /* 'J' */
+	{  341,   1,  2,  9,  9 }, /* 'K' */
+	{  352,   1,  2,  9,  9 }, /* 'L' */
+	{  363,   0,  2, 11,  9 }, /* 'M' */
+	{  376,   1,  2,  9,  9 }, /* 'N' */
+	{  387,   1,  2,  9,  9 }, /* 'O' */
+	{  398,   1,  2,  8,  9 }, /* 'P' */
+	{  407,   1,  2,  9, 11 }, /* 'Q' */
+	{  420,   1,  2, 10,  9 }, /* 'R' */
+	{  432,   2,  2,  7,  9 }, /* 'S' */
+	{  440,   1,  2,  8,  9 }, /* 'T' */
+	{  449,   1,  2,  9,  9 }, /* 'U' */
+	{  460,   1,  2,  9,  9 }, /* 'V' */
+	{  471,   0,  2, 11,  9 }, /* 'W' */
+	{  484,   1,  2,  9,  9 }, /* 'X' */
+	{  495,   1,  2, 10,  9 }, /* 'Y' */
+	{  507,   2,  2,  7,  9 }, /* 'Z' */
+	{  515,   5,  1,  4, 12 }, /* '[' */
+	{  521,   2,  0,  8, 13 }, /* '\\' */
+	{  534,   3,  1,  4, 12 }, /* ']' */
+	{  540,   2,  0,  7,  6 }, /* '^' */
+	{  546,   0, 15, 11,  1 }, /* '_' */
+	{  548,   4,  0,  3,  3 }, /* '`' */
+	{  550,   2,  4,  8,  7 }, /* 'a' */
+	{  557,   1,  1,  9, 10 }, /* 'b' */
+	{  569,   1,  4,  8,  7 }, /* 'c' */
+	{  576,   1,  1,  9, 10 }, /* 'd' */
+	{  588,   1,  4,  9,  7 }, /* 'e' */
+	{  596,   2,  1,  9, 10 }, /* 'f' */
+	{  608,   1,  4,  9, 10 }, /* 'g' */
+	{  620,   1,  1,  9, 10 }, /* 'h' */
+	{  632,   2,  1,  8, 10 }, /* 'i' */
+	{  642,   2,  1,  6, 13 }, /* 'j' */
+	{  652,   1,  1,  9, 10 }, /* 'k' */
+	{  664,   2,  1,  8, 10 }, /* 'l' */
+	{  674,   1,  4, 10,  7 }, /* 'm' */
+	{  683,   1,  4,  9,  7 }, /* 'n' */
+	{  691,   1,  4,  9,  7 }, /* 'o' */
+	{  699,   1,  4,  9, 10 }, /* 'p' */
+	{  711,   1,  4,  9, 10 }, /* 'q' */
+	{  723,   1,  4,  9,  7 }, /* 'r' */
+	{  731,   2,  4,  7,  7 }, /* 's' */
+	{  738,   1,  1,  8, 10 }, /* 't' */
+	{  748,   1,  4,  9,  7 }, /* 'u' */
+	{  756,   1,  4,  9,  7 }, /* 'v' */
+	{  764,   0,  4, 11,  7 }, /* 'w' */
+	{  774,   1,  4,  9,  7 }, /* 'x' */
+	{  782,   1,  4, 10, 10 }, /* 'y' */
+	{  795,   2,  4,  7,  7 }, /* 'z' */
+	{  802,   3,  1,  4, 12 }, /* '{' */
+	{  808,   5,  1,  2, 12 }, /* '|' */
+	{  811,   4,  1,  4, 12 }, /* '}' */
+	{  817,   2,  5,  7,  3 }, /* '~' */
+};
+
+sPFONT Font16_Packed = {
+  Font16_Packed_Data,
+  Font16_Packed_Glyphs,
+  0, /* Advances */
+  11, /* Advance */
+  FONT_GLYPH_BITS,
+  32, /* First */
+  95, /* Count */
+  16, /* Height */
+};
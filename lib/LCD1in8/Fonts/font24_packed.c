@@ -0,0 +1,263 @@
+/**
+  ******************************************************************************
+  * @file    font24_packed.c
+  * @brief   Font24 packed by fontc, do not edit
+  ******************************************************************************
+  */
+
+#include "fonts.h"
+
+static const uint8_t Font24_Packed_Data[] =
+{
+	0x0F, 0xC1, 0x12, 0x17, 0x60, 0x03, 0x26, 0x26, 0x23, 0x11, 0x41, 0x21,
+	0x41, 0x21, 0x41, 0x21, 0x41, 0x10, 0x32, 0x22, 0x52, 0x22, 0x52, 0x22,
+	0x52, 0x22, 0x52, 0x22, 0x2F, 0x73, 0x22, 0x24, 0x22, 0x23, 0xF7, 0x22,
+	0x22, 0x52, 0x22, 0x52, 0x22, 0x52, 0x22, 0x52, 0x22, 0x30, 0x42, 0x72,
+	0x54, 0x12, 0x1A, 0x45, 0x46, 0x75, 0x56, 0x66, 0x55, 0x45, 0x3B, 0x12,
+	0x14, 0x62, 0x72, 0x72, 0x72, 0x30, 0x24, 0x56, 0x33, 0x23, 0x22, 0x42,
+	0x22, 0x42, 0x23, 0x23, 0x39, 0x26, 0x29, 0x33, 0x23, 0x22, 0x42, 0x22,
+	0x42, 0x23, 0x23, 0x36, 0x54, 0x20, 0x36, 0x47, 0x32, 0x32, 0x42, 0x92,
+	0xA2, 0x93, 0x75, 0x26, 0x19, 0x34, 0x22, 0x43, 0x3A, 0x25, 0x13, 0x09,
+	0x11, 0x21, 0x21, 0x21, 0x10, 0x42, 0x33, 0x23, 0x24, 0x23, 0x33, 0x23,
+	0x33, 0x33, 0x33, 0x33, 0x33, 0x43, 0x33, 0x43, 0x33, 0x43, 0x42, 0x02,
+	0x43, 0x43, 0x33, 0x43, 0x33, 0x43, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23,
+	0x33, 0x24, 0x23, 0x23, 0x32, 0x40, 0x42, 0x82, 0x82, 0x43, 0x12, 0x1D,
+	0x26, 0x54, 0x64, 0x52, 0x22, 0x42, 0x22, 0x20, 0x52, 0xA2, 0xA2, 0xA2,
+	0xA2, 0x5F, 0x95, 0x2A, 0x2A, 0x2A, 0x2A, 0x25, 0x23, 0x22, 0x23, 0x22,
+	0x32, 0x22, 0x32, 0x30, 0x0F, 0x50, 0x0C, 0x82, 0x82, 0x73, 0x72, 0x73,
+	0x72, 0x82, 0x72, 0x82, 0x72, 0x82, 0x72, 0x82, 0x72, 0x82, 0x73, 0x72,
+	0x73, 0x72, 0x82, 0x80, 0x34, 0x56, 0x32, 0x42, 0x22, 0x42, 0x12, 0x64,
+	0x64, 0x64, 0x64, 0x64, 0x64, 0x62, 0x12, 0x42, 0x22, 0x42, 0x36, 0x54,
+	0x30, 0x51, 0x64, 0x46, 0x43, 0x12, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
+	0x82, 0x82, 0x82, 0x4F, 0x50, 0x35, 0x49, 0x13, 0x52, 0x12, 0x74, 0x72,
+	0x92, 0x82, 0x82, 0x73, 0x73, 0x72, 0x82, 0x82, 0x8F, 0x70, 0x34, 0x47,
+	0x32, 0x33, 0x82, 0x82, 0x72, 0x54, 0x65, 0x83, 0x92, 0x82, 0x84, 0x5C,
+	0x26, 0x30, 0x63, 0x74, 0x74, 0x62, 0x12, 0x52, 0x22, 0x52, 0x22, 0x42,
+	0x32, 0x42, 0x32, 0x32, 0x42, 0x22, 0x52, 0x2F, 0x77, 0x26, 0x74, 0x70,
+	0x19, 0x29, 0x22, 0x92, 0x92, 0x92, 0x14, 0x49, 0x23, 0x42, 0xA2, 0x92,
+	0x92, 0x94, 0x62, 0x1A, 0x36, 0x30, 0x55, 0x37, 0x23, 0x63, 0x72, 0x72,
+	0x82, 0x14, 0x39, 0x13, 0x42, 0x12, 0x64, 0x64, 0x62, 0x12, 0x43, 0x18,
+	0x45, 0x20, 0x0F, 0x76, 0x45, 0x37, 0x28, 0x27, 0x37, 0x28, 0x27, 0x37,
+	0x28, 0x27, 0x37, 0x28, 0x24, 0x26, 0x38, 0x13, 0x45, 0x64, 0x62, 0x12,
+	0x42, 0x36, 0x46, 0x32, 0x42, 0x12, 0x64, 0x64, 0x65, 0x43, 0x18, 0x36,
+	0x20, 0x25, 0x48, 0x13, 0x42, 0x12, 0x64, 0x64, 0x62, 0x12, 0x43, 0x19,
+	0x34, 0x12, 0x82, 0x72, 0x73, 0x63, 0x27, 0x35, 0x50, 0x0C, 0xF5, 0xC0,
+	0x24, 0x24, 0x24, 0xFB, 0x32, 0x33, 0x24, 0x23, 0x24, 0x15, 0xB3, 0xA4,
+	0x84, 0x84, 0x84, 0x84, 0x84, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xB3, 0x0F,
+	0xBF, 0xBF, 0xB0, 0x03, 0xB4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0x84, 0x84,
+	0x84, 0x84, 0x84, 0xA3, 0xB0, 0x25, 0x37, 0x12, 0x45, 0x54, 0x52, 0x63,
+	0x53, 0x44, 0x53, 0x62, 0xF9, 0x36, 0x34, 0x35, 0x47, 0x23, 0x33, 0x12,
+	0x54, 0x46, 0x37, 0x23, 0x14, 0x22, 0x24, 0x22, 0x24, 0x22, 0x24, 0x37,
+	0x46, 0x92, 0x83, 0x42, 0x28, 0x35, 0x20, 0x36, 0xA7, 0xD3, 0xC2, 0x12,
+	0xB2, 0x12, 0xA2, 0x32, 0x92, 0x32, 0x82, 0x42, 0x89, 0x6A, 0x62, 0x72,
+	0x42, 0x82, 0x26, 0x3D, 0x37, 0x0A, 0x3B, 0x42, 0x53, 0x32, 0x62, 0x32,
+	0x62, 0x32, 0x53, 0x39, 0x4A, 0x32, 0x63, 0x22, 0x72, 0x22, 0x72, 0x22,
+	0x7E, 0x1B, 0x20, 0x45, 0x12, 0x2A, 0x13, 0x53, 0x12, 0x74, 0x84, 0xA2,
+	0xA2, 0xA2, 0xA2, 0xB2, 0x72, 0x13, 0x53, 0x29, 0x56, 0x20, 0x09, 0x4B,
+	0x42, 0x53, 0x32, 0x62, 0x32, 0x72, 0x22, 0x72, 0x22, 0x72, 0x22, 0x72,
+	0x22, 0x72, 0x22, 0x72, 0x22, 0x62, 0x32, 0x53, 0x1B, 0x2A, 0x30, 0x0F,
+	0x92, 0x26, 0x22, 0x26, 0x22, 0x22, 0x22, 0x22, 0x22, 0x26, 0x66, 0x66,
+	0x22, 0x26, 0x22, 0x22, 0x22, 0x26, 0x22, 0x26, 0xFB, 0x0F, 0x92, 0x26,
+	0x22, 0x26, 0x22, 0x22, 0x22, 0x22, 0x22, 0x26, 0x66, 0x66, 0x22, 0x26,
+	0x22, 0x26, 0x2A, 0x28, 0x84, 0x84, 0x45, 0x12, 0x3A, 0x23, 0x53, 0x22,
+	0x72, 0x12, 0x82, 0x12, 0xB2, 0xB2, 0x49, 0x49, 0x82, 0x13, 0x72, 0x23,
+	0x53, 0x3A, 0x56, 0x30, 0x06, 0x2C, 0x26, 0x22, 0x62, 0x42, 0x62, 0x42,
+	0x62, 0x42, 0x62, 0x4A, 0x4A, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42,
+	0x62, 0x26, 0x2C, 0x26, 0x0F, 0x54, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+	0x28, 0x28, 0x28, 0x24, 0xF5, 0x3A, 0x3A, 0x82, 0xB2, 0xB2, 0xB2, 0xB2,
+	0x32, 0x62, 0x32, 0x62, 0x32, 0x62, 0x32, 0x62, 0x32, 0x52, 0x49, 0x65,
+	0x60, 0x07, 0x25, 0x17, 0x25, 0x32, 0x52, 0x62, 0x42, 0x72, 0x32, 0x82,
+	0x22, 0x92, 0x13, 0x97, 0x83, 0x23, 0x72, 0x43, 0x62, 0x52, 0x62, 0x53,
+	0x37, 0x3C, 0x35, 0x08, 0x58, 0x82, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2,
+	0x62, 0x32, 0x62, 0x32, 0x62, 0x32, 0x6F, 0xD0, 0x04, 0x89, 0x65, 0x23,
+	0x63, 0x44, 0x44, 0x44, 0x44, 0x42, 0x12, 0x22, 0x12, 0x42, 0x12, 0x22,
+	0x12, 0x42, 0x24, 0x22, 0x42, 0x24, 0x22, 0x42, 0x32, 0x32, 0x42, 0x82,
+	0x42, 0x82, 0x27, 0x2E, 0x27, 0x04, 0x3B, 0x37, 0x23, 0x52, 0x44, 0x42,
+	0x45, 0x32, 0x42, 0x12, 0x32, 0x42, 0x13, 0x22, 0x42, 0x23, 0x12, 0x42,
+	0x32, 0x12, 0x42, 0x35, 0x42, 0x44, 0x42, 0x53, 0x27, 0x32, 0x27, 0x32,
+	0x20, 0x44, 0x68, 0x33, 0x43, 0x22, 0x62, 0x13, 0x65, 0x84, 0x84, 0x84,
+	0x85, 0x63, 0x12, 0x62, 0x23, 0x43, 0x38, 0x64, 0x40, 0x0A, 0x2B, 0x32,
+	0x53, 0x22, 0x62, 0x22, 0x62, 0x22, 0x62, 0x22, 0x52, 0x39, 0x37, 0x52,
+	0xA2, 0xA2, 0x88, 0x48, 0x40, 0x44, 0x68, 0x33, 0x43, 0x22, 0x62, 0x13,
+	0x65, 0x84, 0x84, 0x84, 0x85, 0x63, 0x12, 0x62, 0x23, 0x43, 0x38, 0x55,
+	0x75, 0x22, 0x2A, 0x22, 0x43, 0x10, 0x0A, 0x4B, 0x52, 0x53, 0x42, 0x62,
+	0x42, 0x62, 0x42, 0x53, 0x49, 0x57, 0x72, 0x33, 0x62, 0x43, 0x52, 0x52,
+	0x52, 0x53, 0x27, 0x3B, 0x43, 0x25, 0x12, 0x1C, 0x45, 0x64, 0x66, 0x76,
+	0x66, 0x76, 0x64, 0x65, 0x4C, 0x12, 0x15, 0x20, 0x0F, 0xB3, 0x23, 0x43,
+	0x23, 0x43, 0x23, 0x43, 0x23, 0x25, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x27,
+	0x84, 0x82, 0x06, 0x2C, 0x26, 0x22, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42,
+	0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x52,
+	0x42, 0x68, 0x84, 0x50, 0x07, 0x1E, 0x17, 0x22, 0x72, 0x52, 0x52, 0x62,
+	0x52, 0x62, 0x52, 0x72, 0x32, 0x82, 0x32, 0x92, 0x12, 0xA2, 0x12, 0xA2,
+	0x12, 0xB3, 0xC3, 0xD1, 0x70, 0x07, 0x3E, 0x37, 0x22, 0x92, 0x42, 0x92,
+	0x42, 0x41, 0x42, 0x52, 0x23, 0x22, 0x62, 0x23, 0x22, 0x62, 0x12, 0x12,
+	0x12, 0x62, 0x12, 0x12, 0x12, 0x64, 0x25, 0x73, 0x33, 0x83, 0x33, 0x82,
+	0x52, 0x82, 0x52, 0x40, 0x06, 0x2C, 0x26, 0x22, 0x62, 0x52, 0x42, 0x72,
+	0x22, 0x94, 0xB2, 0xC2, 0xB4, 0x92, 0x22, 0x72, 0x42, 0x52, 0x62, 0x26,
+	0x2C, 0x26, 0x05, 0x3B, 0x36, 0x22, 0x62, 0x52, 0x42, 0x72, 0x22, 0x82,
+	0x22, 0x94, 0xB2, 0xC2, 0xC2, 0xC2, 0xC2, 0x98, 0x68, 0x30, 0x1A, 0x1A,
+	0x12, 0x62, 0x12, 0x52, 0x22, 0x42, 0x32, 0x32, 0x82, 0x82, 0x82, 0x42,
+	0x22, 0x52, 0x12, 0x64, 0x7F, 0x90, 0x0C, 0x32, 0x32, 0x32, 0x32, 0x32,
+	0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x3A, 0x02, 0x82, 0x83,
+	0x82, 0x83, 0x82, 0x82, 0x92, 0x82, 0x92, 0x82, 0x92, 0x82, 0x92, 0x82,
+	0x83, 0x82, 0x83, 0x82, 0x82, 0x0A, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+	0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x3C, 0x51, 0x93, 0x75, 0x53,
+	0x13, 0x42, 0x32, 0x32, 0x52, 0x12, 0x73, 0x91, 0x0F, 0xF2, 0x02, 0x33,
+	0x43, 0x32, 0x26, 0x58, 0xB2, 0xA2, 0x57, 0x39, 0x23, 0x52, 0x22, 0x62,
+	0x22, 0x53, 0x3B, 0x25, 0x14, 0x04, 0x94, 0xB2, 0xB2, 0xB2, 0x15, 0x5A,
+	0x33, 0x52, 0x32, 0x72, 0x22, 0x72, 0x22, 0x72, 0x22, 0x72, 0x22, 0x72,
+	0x23, 0x52, 0x1C, 0x14, 0x15, 0x30, 0x45, 0x12, 0x2A, 0x13, 0x56, 0x74,
+	0x84, 0xA2, 0xA3, 0x72, 0x13, 0x53, 0x29, 0x56, 0x20, 0x74, 0x94, 0xB2,
+	0xB2, 0x55, 0x12, 0x3A, 0x32, 0x53, 0x22, 0x72, 0x22, 0x72, 0x22, 0x72,
+	0x22, 0x72, 0x22, 0x72, 0x32, 0x53, 0x3C, 0x35, 0x14, 0x36, 0x4A, 0x22,
+	0x62, 0x12, 0x8F, 0xDA, 0x2B, 0x27, 0x21, 0xB3, 0x72, 0x57, 0x48, 0x32,
+	0xA2, 0x7B, 0x1B, 0x42, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0x7A, 0x2A,
+	0x20, 0x35, 0x14, 0x1C, 0x12, 0x53, 0x22, 0x72, 0x22, 0x72, 0x22, 0x72,
+	0x22, 0x72, 0x22, 0x72, 0x32, 0x53, 0x3A, 0x55, 0x12, 0xB2, 0xB2, 0xA3,
+	0x48, 0x56, 0x50, 0x04, 0xA4, 0xC2, 0xC2, 0xC2, 0x15, 0x69, 0x53, 0x43,
+	0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62,
+	0x26, 0x2C, 0x26, 0x52, 0xA2, 0xFF, 0x06, 0x66, 0xA2, 0xA2, 0xA2, 0xA2,
+	0xA2, 0xA2, 0xA2, 0x5F, 0x90, 0x52, 0x72, 0xF5, 0xF3, 0x72, 0x72, 0x72,
+	0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6B, 0x16, 0x30, 0x04,
+	0x84, 0xA2, 0xA2, 0xA2, 0x25, 0x32, 0x25, 0x32, 0x22, 0x62, 0x12, 0x75,
+	0x74, 0x85, 0x72, 0x13, 0x62, 0x23, 0x34, 0x39, 0x35, 0x16, 0x66, 0xA2,
+	0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0x5F, 0x90,
+	0x04, 0x13, 0x14, 0x3E, 0x43, 0x23, 0x22, 0x42, 0x32, 0x32, 0x42, 0x32,
+	0x32, 0x42, 0x32, 0x32, 0x42, 0x32, 0x32, 0x42, 0x32, 0x32, 0x42, 0x32,
+	0x32, 0x26, 0x14, 0x1A, 0x14, 0x14, 0x04, 0x15, 0x4B, 0x53, 0x43, 0x42,
+	0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x26,
+	0x2C, 0x26, 0x44, 0x68, 0x33, 0x43, 0x13, 0x65, 0x84, 0x84, 0x85, 0x63,
+	0x13, 0x43, 0x38, 0x64, 0x40, 0x04, 0x15, 0x3C, 0x33, 0x52, 0x32, 0x72,
+	0x22, 0x72, 0x22, 0x72, 0x22, 0x72, 0x22, 0x72, 0x23, 0x52, 0x3A, 0x32,
+	0x15, 0x52, 0xB2, 0xB2, 0x97, 0x67, 0x60, 0x35, 0x14, 0x1C, 0x12, 0x53,
+	0x22, 0x72, 0x22, 0x72, 0x22, 0x72, 0x22, 0x72, 0x22, 0x72, 0x32, 0x53,
+	0x3A, 0x55, 0x12, 0xB2, 0xB2, 0xB2, 0x87, 0x67, 0x05, 0x24, 0x15, 0x16,
+	0x35, 0x22, 0x33, 0x92, 0xA2, 0xA2, 0xA2, 0xA2, 0x7A, 0x2A, 0x20, 0x28,
+	0x1B, 0x64, 0x68, 0x58, 0x67, 0x64, 0x5C, 0x18, 0x20, 0x22, 0xA2, 0xA2,
+	0xA2, 0x8A, 0x2A, 0x42, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0x53, 0x39,
+	0x46, 0x20, 0x04, 0x44, 0x24, 0x44, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62,
+	0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x53, 0x5B, 0x45, 0x14, 0x05,
+	0x4A, 0x45, 0x22, 0x62, 0x42, 0x62, 0x52, 0x42, 0x62, 0x42, 0x72, 0x22,
+	0x82, 0x22, 0x86, 0x94, 0xA4, 0x50, 0x04, 0x58, 0x54, 0x12, 0x31, 0x32,
+	0x22, 0x23, 0x22, 0x22, 0x23, 0x22, 0x32, 0x11, 0x11, 0x12, 0x44, 0x14,
+	0x44, 0x14, 0x43, 0x32, 0x62, 0x32, 0x62, 0x32, 0x30, 0x05, 0x2A, 0x25,
+	0x22, 0x42, 0x52, 0x22, 0x74, 0x92, 0x94, 0x72, 0x22, 0x52, 0x42, 0x25,
+	0x2A, 0x25, 0x06, 0x4B, 0x45, 0x22, 0x72, 0x52, 0x52, 0x62, 0x52, 0x72,
+	0x32, 0x82, 0x32, 0x92, 0x12, 0xA5, 0xB3, 0xD2, 0xC2, 0xD2, 0xC2, 0x98,
+	0x78, 0x60, 0x0F, 0x75, 0x21, 0x24, 0x27, 0x27, 0x27, 0x27, 0x24, 0x21,
+	0x25, 0xF7, 0x33, 0x24, 0x22, 0x42, 0x42, 0x42, 0x42, 0x42, 0x33, 0x23,
+	0x43, 0x42, 0x42, 0x42, 0x42, 0x42, 0x44, 0x33, 0x0F, 0xF6, 0x03, 0x34,
+	0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x43, 0x43, 0x23, 0x32, 0x42, 0x42,
+	0x42, 0x42, 0x24, 0x23, 0x30, 0x23, 0x75, 0x35, 0x13, 0x15, 0x35, 0x73,
+	0x20,
+};
+
+static const sGLYPH Font24_Packed_Glyphs[] =
+{
+	{    0,   0,  0,  0,  0 }, /* ' ' */
+	{    0,   6,  2,  3, 15 }, /* '!' */
+	{    5,   4,  3,  8,  7 }, /* '"' */
+	{   18,   2,  2, 11, 16 }, /* '#' */
+	{   46,   3,  1,  9, 19 }, /* '$' */
+	{   66,   3,  2, 10, 15 }, /* '%' */
+	{   90,   3,  4, 11, 13 }, /* '&' */
+	{  107,   6,  3,  3,  7 }, /* '\'' */
+	{  113,   7,  2,  6, 18 }, /* '(' */
+	{  131,   3,  2,  6, 18 }, /* ')' */
+	{  150,   3,  2, 10, 10 }, /* '*' */
+	{  164,   2,  4, 12, 12 }, /* '+' */
+	{  176,   6, 14,  5,  7 }, /* ',' */
+	{  184,   3,  9, 10,  2 }, /* '-' */
+	{  186,   6, 14,  4,  3 }, /* '.' */
+	{  187,   3,  0, 10, 20 }, /* '/' */
+	{  208,   3,  2, 10, 15 }, /* '0' */
+	{  229,   3,  2, 10, 15 }, /* '1' */
+	{  245,   2,  2, 11, 15 }, /* '2' */
+	{  262,   3,  2, 10, 15 }, /* '3' */
+	{  278,   2,  2, 11, 15 }, /* '4' */
+	{  300,   2,  2, 11, 15 }, /* '5' */
+	{  318,   3,  2, 10, 15 }, /* '6' */
+	{  338,   3,  2, 10, 15 }, /* '7' */
+	{  353,   3,  2, 10, 15 }, /* '8' */
+	{  373,   3,  2, 10, 15 }, /* '9' */
+	{  393,   6,  6,  4, 11 }, /* ':' */
+	{  396,   6,  6,  6, 13 }, /* ';' */
+	{  406,   0,  4, 14, 13 }, /* '<' */
+	{  419,   1,  7, 13,  6 }, /* '=' */
+	{  423,   1,  4, 14, 13 }, /* '>' */
+	{  437,   3,  3,  9, 14 }, /* '?' */
+	{  451,   3,  2, 10, 17 }, /* '@' */
+	{  475,   0,  3, 16, 14 }, /* 'A' */
+	{  497,   1,  3, 13, 14 }, /* 'B' */
+	{  519,   2,  3, 12, 14 }, /* 'C' */
+	{  538,   1,  3, 13, 14 }, /* 'D' */
+	{  563,   1,  3, 12, 14 }, /* 'E' */
+	{  585,   2,  3, 12, 14 }, /* 'F' */
+	{  606,   2,  3, 13, 14 }, /* 'G' */
+	{  628,   1,  3, 14, 14 }, /* 'H' */
+	{  652,   3,  3, 10, 14 }, /* 'I' */
+	{  665,   2,  3, 13, 14 }, /* 'J' */
+	{  685,   1,  3, 15, 14 }, /* 'K' */
+	{  711,   1,  3, 13, 14 }, /* 'L' */
+	{  728,   0,  3, 16, 14 }, /* 'M' */
+	{  761,   1,  3, 14, 14 }, /* 'N' */
+	{  793,   2,  3, 12, 14 }, /* 'O' */
+	{  813,   2,  3, 12, 14 }, /* 'P' */
+	{  833,   2,  3, 12, 17 }, /* 'Q' */
+	{  858,   1,  3, 14, 14 }, /* 'R' */
+	{  881,   3,  3, 10, 14 }, /* 'S' */
+	{  896,   2,  3, 12, 14 }, /* 'T' */
+	{  914,   1,  3, 14, 14 }, /* 'U' */
+	{  940,   1,  3, 15, 14 }, /* 'V' */
+	{  965,   0,  3, 17, 14 }, /* 'W' */
+	{ 1000,   1,  3, 14, 14 }, /* 'X' */
+	{ 1022,   1,  3, 14, 14 }, /* 'Y' */
+	{ 1042,   2,  3, 11, 14 }, /* 'Z' */
+	{ 1062,   7,  2,  5, 18 }, /* '[' */
+	{ 1077,   3,  0, 10, 20 }, /* '\\' */
+	{ 1097,   4,  2,  5, 18 }, /* ']' */
+	{ 1112,   3,  1, 11,  8 }, /* '^' */
+	{ 1124,   0, 22, 16,  2 }, /* '_' */
+	{ 1126,   6,  1,  5,  4 }, /* '`' */
+	{ 1130,   2,  6, 12, 11 }, /* 'a' */
+	{ 1145,   1,  2, 13, 15 }, /* 'b' */
+	{ 1170,   2,  6, 12, 11 }, /* 'c' */
+	{ 1185,   2,  2, 13, 15 }, /* 'd' */
+	{ 1209,   2,  6, 12, 11 }, /* 'e' */
+	{ 1221,   2,  2, 12, 15 }, /* 'f' */
+	{ 1237,   2,  6, 13, 16 }, /* 'g' */
+	{ 1263,   1,  2, 14, 15 }, /* 'h' */
+	{ 1287,   2,  2, 12, 15 }, /* 'i' */
+	{ 1301,   3,  2,  9, 20 }, /* 'j' */
+	{ 1319,   2,  2, 12, 15 }, /* 'k' */
+	{ 1341,   2,  2, 12, 15 }, /* 'l' */
+	{ 1356,   0,  6, 16, 11 }, /* 'm' */
+	{ 1386,   1,  6, 14, 11 }, /* 'n' */
+	{ 1406,   2,  6, 12, 11 }, /* 'o' */
+	{ 1421,   1,  6, 13, 16 }, /* 'p' */
+	{ 1447,   2,  6, 13, 16 }, /* 'q' */
+	{ 1472,   2,  6, 12, 11 }, /* 'r' */
+	{ 1487,   3,  6, 10, 11 }, /* 's' */
+	{ 1497,   2,  2, 12, 15 }, /* 't' */
+	{ 1514,   1,  6, 14, 11 }, /* 'u' */
+	{ 1535,   1,  6, 14, 11 }, /* 'v' */
+	{ 1554,   1,  6, 13, 11 }, /* 'w' */
+	{ 1581,   2,  6, 12, 11 }, /* 'x' */
+	{ 1598,   1,  6, 15, 16 }, /* 'y' */
+	{ 1622,   3,  6, 10, 11 }, /* 'z' */
+	{ 1634,   5,  2,  6, 18 }, /* '{' */
+	{ 1652,   7,  2,  2, 18 }, /* '|' */
+	{ 1654,   5,  2,  6, 18 }, /* '}' */
+	{ 1673,   2,  8, 11,  5 }, /* '~' */
+};
+
+sPFONT Font24_Packed = {
+  Font24_Packed_Data,
+  Font24_Packed_Glyphs,
+  0, /* Advances */
+  17, /* Advance */
+  FONT_GLYPH_RLE,
+  32, /* First */
+  95, /* Count */
+  24, /* Height */
+};
@@ -0,0 +1,145 @@
+/**
+  ******************************************************************************
+  * @file    font8_packed.c
+  * @brief   Font8 packed by fontc, do not edit
+  ******************************************************************************
+  */
+
+#include "fonts.h"
+
+static const uint8_t Font8_Packed_Data[] =
+{
+	0xF4, 0xB4, 0x2A, 0xBE, 0xAF, 0xAA, 0x80, 0x4F, 0x33, 0x90, 0x44, 0x3C,
+	0x22, 0x74, 0xCA, 0xF0, 0xE0, 0x6A, 0xA4, 0x95, 0x58, 0x5D, 0x50, 0x21,
+	0x3E, 0x42, 0x00, 0x68, 0xE0, 0x80, 0x12, 0x22, 0x44, 0x80, 0x56, 0xDA,
+	0x80, 0x61, 0x08, 0x42, 0x7C, 0x55, 0x29, 0xC0, 0x54, 0xA3, 0x80, 0x26,
+	0xAF, 0x27, 0xF3, 0x1A, 0x80, 0x73, 0x5B, 0x80, 0xF4, 0xA4, 0x80, 0x55,
+	0x5A, 0x80, 0x76, 0xB3, 0x80, 0x90, 0x46, 0x12, 0xC2, 0x10, 0xE3, 0x80,
+	0x84, 0x34, 0x80, 0x54, 0xA0, 0x80, 0x69, 0x9B, 0x98, 0x70, 0x61, 0x14,
+	0xE8, 0xEC, 0xF2, 0x5C, 0x94, 0xF8, 0xF6, 0x48, 0xC0, 0xF2, 0x52, 0x94,
+	0xF8, 0xFA, 0x58, 0x84, 0xFC, 0xFA, 0x58, 0x84, 0x70, 0xE8, 0x8B, 0xA6,
+	0xEA, 0x5E, 0x94, 0xF4, 0xE9, 0x25, 0xC0, 0x72, 0x2A, 0xA4, 0xDA, 0x98,
+	0xE5, 0x6C, 0xE2, 0x10, 0x84, 0xFC, 0xDE, 0xF7, 0x58, 0xEC, 0xDB, 0x5A,
+	0xB5, 0xF4, 0x69, 0x99, 0x96, 0xF2, 0x52, 0xE4, 0x70, 0x69, 0x99, 0x96,
+	0x30, 0xF2, 0x52, 0xE4, 0xF4, 0xF5, 0x1B, 0xC0, 0xFD, 0x48, 0x42, 0x38,
+	0xDA, 0x52, 0x94, 0x98, 0xDC, 0x52, 0xA5, 0x18, 0xDC, 0x6B, 0x5A, 0xA8,
+	0xDA, 0x88, 0x45, 0x6C, 0xDC, 0x54, 0x42, 0x38, 0xF9, 0x24, 0x9F, 0xEA,
+	0xAC, 0x84, 0x42, 0x22, 0x10, 0xD5, 0x5C, 0x4A, 0x80, 0xF8, 0x90, 0x62,
+	0xEF, 0xC2, 0x1C, 0x94, 0xF8, 0xF2, 0x70, 0x31, 0x79, 0x97, 0xFE, 0x30,
+	0x2B, 0xA5, 0xC0, 0x79, 0x97, 0x16, 0xC2, 0x1C, 0x94, 0xF4, 0x43, 0x25,
+	0xC0, 0x43, 0x92, 0x4F, 0xC2, 0x16, 0xE5, 0x6C, 0xC9, 0x25, 0xC0, 0xD5,
+	0x6B, 0x50, 0xF2, 0x53, 0x90, 0x69, 0x96, 0xF2, 0x52, 0xE4, 0x70, 0x79,
+	0x97, 0x13, 0xF4, 0x4E, 0x68, 0xE0, 0x47, 0x90, 0x93, 0x00, 0xDA, 0x52,
+	0x70, 0xCA, 0x4C, 0x60, 0xDD, 0x6A, 0xA0, 0x96, 0x69, 0xDA, 0x94, 0x42,
+	0x30, 0xFA, 0x5F, 0x29, 0x64, 0x88, 0xFE, 0x89, 0x34, 0xA0, 0x5A,
+};
+
+static const sGLYPH Font8_Packed_Glyphs[] =
+{
+	{    0,   0,  0,  0,  0 }, /* ' ' */
+	{    0,   2,  0,  1,  6 }, /* '!' */
+	{    1,   1,  0,  3,  2 }, /* '"' */
+	{    2,   0,  0,  5,  7 }, /* '#' */
+	{    7,   1,  0,  3,  7 }, /* '$' */
+	{   10,   1,  0,  4,  6 }, /* '%' */
+	{   13,   1,  1,  4,  5 }, /* '&' */
+	{   16,   2,  0,  1,  3 }, /* '\'' */
+	{   17,   2,  0,  2,  7 }, /* '(' */
+	{   19,   1,  0,  2,  7 }, /* ')' */
+	{   21,   1,  0,  3,  4 }, /* '*' */
+	{   23,   0,  1,  5,  5 }, /* '+' */
+	{   27,   2,  4,  2,  3 }, /* ',' */
+	{   28,   1,  3,  3,  1 }, /* '-' */
+	{   29,   2,  5,  1,  1 }, /* '.' */
+	{   30,   0,  0,  4,  7 }, /* '/' */
+	{   34,   1,  0,  3,  6 }, /* '0' */
+	{   37,   0,  0,  5,  6 }, /* '1' */
+	{   41,   1,  0,  3,  6 }, /* '2' */
+	{   44,   1,  0,  3,  6 }, /* '3' */
+	{   47,   1,  0,  4,  6 }, /* '4' */
+	{   50,   1,  0,  3,  6 }, /* '5' */
+	{   53,   1,  0,  3,  6 }, /* '6' */
+	{   56,   1,  0,  3,  6 }, /* '7' */
+	{   59,   1,  0,  3,  6 }, /* '8' */
+	{   62,   1,  0,  3,  6 }, /* '9' */
+	{   65,   2,  2,  1,  4 }, /* ':' */
+	{   66,   2,  2,  2,  4 }, /* ';' */
+	{   67,   0,  1,  4,  5 }, /* '<' */
+	{   70,   1,  1,  3,  3 }, /* '=' */
+	{   72,   1,  1,  4,  5 }, /* '>' */
+	{   75,   1,  0,  3,  6 }, /* '?' */
+	{   78,   1,  0,  4,  7 }, /* '@' */
+	{   82,   0,  0,  5,  6 }, /* 'A' */
+	{   86,   0,  0,  5,  6 }, /* 'B' */
+	{   90,   1,  0,  3,  6 }, /* 'C' */
+	{   93,   0,  0,  5,  6 }, /* 'D' */
+	{   97,   0,  0,  5,  6 }, /* 'E' */
+	{  101,   0,  0,  5,  6 }, /* 'F' */
+	{  105,   1,  0,  4,  6 }, /* 'G' */
+	{  108,   0,  0,  5,  6 }, /* 'H' */
+	{  112,   1,  0,  3,  6 }, /* 'I' */
+	{  115,   1,  0,  4,  6 }, /* 'J' */
+	{  118,   0,  0,  5,  6 }, /* 'K' */
+	{  122,   0,  0,  5,  6 }, /* 'L' */
+	{  126,   0,  0,  5,  6 }, /* 'M' */
+	{  130,   0,  0,  5,  6 }, /* 'N' */
+	{  134,   1,  0,  4,  6 }, /* 'O' */
+	{  137,   0,  0,  5,  6 }, /* 'P' */
+	{  141,   1,  0,  4,  7 }, /* 'Q' */
+	{  145,   0,  0,  5,  6 }, /* 'R' */
+	{  149,   1,  0,  3,  6 }, /* 'S' */
+	{  152,   0,  0,  5,  6 }, /* 'T' */
+	{  156,   0,  0,  5,  6 }, /* 'U' */
+	{  160,   0,  0,  5,  6 }, /* 'V' */
+	{  164,   0,  0,  5,  6 }, /* 'W' */
+	{  168,   0,  0,  5,  6 }, /* 'X' */
+	{  172,   0,  0,  5,  6 }, /* 'Y' */
+	{  176,   1,  0,  4,  6 }, /* 'Z' */
+	{  179,   2,  0,  2,  7 }, /* '[' */
+	{  181,   0,  0,  4,  7 }, /* '\\' */
+	{  185,   1,  0,  2,  7 }, /* ']' */
+	{  187,   1,  0,  3,  3 }, /* '^' */
+	{  189,   0,  7,  5,  1 }, /* '_' */
+	{  190,   2,  0,  2,  2 }, /* '`' */
+	{  191,   1,  2,  4,  4 }, /* 'a' */
+	{  193,   0,  0,  5,  6 }, /* 'b' */
+	{  197,   1,  2,  3,  4 }, /* 'c' */
+	{  199,   1,  0,  4,  6 }, /* 'd' */
+	{  202,   1,  2,  3,  4 }, /* 'e' */
+	{  204,   1,  0,  3,  6 }, /* 'f' */
+	{  207,   1,  2,  4,  6 }, /* 'g' */
+	{  210,   0,  0,  5,  6 }, /* 'h' */
+	{  214,   1,  0,  3,  6 }, /* 'i' */
+	{  217,   1,  0,  3,  8 }, /* 'j' */
+	{  220,   0,  0,  5,  6 }, /* 'k' */
+	{  224,   1,  0,  3,  6 }, /* 'l' */
+	{  227,   0,  2,  5,  4 }, /* 'm' */
+	{  230,   0,  2,  5,  4 }, /* 'n' */
+	{  233,   1,  2,  4,  4 }, /* 'o' */
+	{  235,   0,  2,  5,  6 }, /* 'p' */
+	{  239,   1,  2,  4,  6 }, /* 'q' */
+	{  242,   1,  2,  4,  4 }, /* 'r' */
+	{  244,   1,  2,  3,  4 }, /* 's' */
+	{  246,   0,  1,  5,  5 }, /* 't' */
+	{  250,   0,  2,  5,  4 }, /* 'u' */
+	{  253,   0,  2,  5,  4 }, /* 'v' */
+	{  256,   0,  2,  5,  4 }, /* 'w' */
+	{  259,   1,  2,  4,  4 }, /* 'x' */
+	{  261,   0,  2,  5,  6 }, /* 'y' */
+	{  265,   1,  2,  4,  4 }, /* 'z' */
+	{  267,   1,  0,  3,  7 }, /* '{' */
+	{  270,   2,  0,  1,  7 }, /* '|' */
+	{  271,   1,  0,  3,  7 }, /* '}' */
+	{  274,   1,  3,  4,  2 }, /* '~' */
+};
+
+sPFONT Font8_Packed = {
+  Font8_Packed_Data,
+  Font8_Packed_Glyphs,
+  0, /* Advances */
+  5, /* Advance */
+  FONT_GLYPH_BITS,
+  32, /* First */
+  95, /* Count */
+  8, /* Height */
+};
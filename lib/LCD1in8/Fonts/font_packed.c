@@ -0,0 +1,138 @@
+/**
+  ******************************************************************************
+  * @file    font_packed.c
+  * @brief   Row decoder of the packed fonts and the sFONT tables
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "fonts.h"
+
+#include <string.h>
+
+/**
+  * @brief  Glyph of a character
+  * @retval NULL when the font has no glyph for it
+  */
+const sGLYPH *Font_FindGlyph(const sPFONT *Font, char Char)
+{
+  uint8_t Index = (uint8_t)Char - Font->First;
+  if ((uint8_t)Char < Font->First || Index >= Font->Count) {
+    return NULL;
+  }
+  return &Font->Glyphs[Index];
+}
+
+/**
+  * @brief  Pen advance of a glyph of the font
+  * @retval 0 without a glyph
+  */
+uint16_t Font_Advance(const sPFONT *Font, const sGLYPH *Glyph)
+{
+  if (!Glyph) {
+    return 0;
+  }
+  return Font->Advances ? Font->Advances[Glyph - Font->Glyphs] : Font->Advance;
+}
+
+/**
+  * @brief  Start reading a character of a sFONT table
+  */
+void Font_DecodeTable(sGLYPH_DECODER *Decoder, const sFONT *Font, char Char)
+{
+  uint32_t Row_Bytes = Font->Width / 8 + (Font->Width % 8 ? 1 : 0);
+  memset(Decoder, 0, sizeof(*Decoder));
+  Decoder->Data = &Font->table[(Char - ' ') * Font->Height * Row_Bytes];
+  Decoder->Encoding = FONT_GLYPH_TABLE;
+  Decoder->Width = Font->Width;
+  Decoder->Height = Font->Height;
+}
+
+/**
+  * @brief  Start reading a glyph of a packed font
+  */
+void Font_DecodePacked(sGLYPH_DECODER *Decoder, const sPFONT *Font,
+                       const sGLYPH *Glyph)
+{
+  memset(Decoder, 0, sizeof(*Decoder));
+  Decoder->Data = &Font->Data[Glyph->Offset];
+  Decoder->Encoding = Font->Encoding;
+  Decoder->Color = 1; /* The first run toggles to the background */
+  Decoder->Left = Glyph->Left;
+  Decoder->Top = Glyph->Top;
+  Decoder->Width = Glyph->Width;
+  Decoder->Height = Glyph->Height;
+}
+
+/* Next run of the box: Decoder->Run pixels of Decoder->Color */
+static void Font_NextRun(sGLYPH_DECODER *Decoder)
+{
+  while (Decoder->Run == 0) {
+    uint8_t Nibble;
+    if (Decoder->Bit == 0) {
+      Nibble = *Decoder->Data >> 4;
+      Decoder->Bit = 4;
+    } else {
+      Nibble = *Decoder->Data++ & 0x0f;
+      Decoder->Bit = 0;
+    }
+    if (!Decoder->Continued) {
+      Decoder->Color ^= 1;
+    }
+    Decoder->Run = Nibble;
+    Decoder->Continued = (Nibble == 15);
+  }
+}
+
+/**
+  * @brief  Read the next row of the cell
+  * @param  Row: One bit per pixel, MSB first like the sFONT rows, with room
+  *         for the whole row of the cell
+  * @param  Columns: Pixels of the row wanted, the rest of the box is skipped
+  */
+void Font_DecodeRow(sGLYPH_DECODER *Decoder, uint8_t *Row, uint16_t Columns)
+{
+  uint16_t Cell_Row = Decoder->Row++;
+  uint16_t Column = 0;
+
+  if (Decoder->Encoding == FONT_GLYPH_TABLE) {
+    uint32_t Row_Bytes = Decoder->Width / 8 + (Decoder->Width % 8 ? 1 : 0);
+    memcpy(Row, Decoder->Data, Row_Bytes);
+    Decoder->Data += Row_Bytes;
+    return;
+  }
+
+  memset(Row, 0, (Columns + 7) / 8);
+  if (Cell_Row < Decoder->Top || Cell_Row >= Decoder->Top + Decoder->Height) {
+    return;
+  }
+
+  while (Column < Decoder->Width) {
+    uint16_t Count = 1;
+    uint8_t Lit;
+    if (Decoder->Encoding == FONT_GLYPH_BITS) {
+      Lit = (*Decoder->Data >> (7 - Decoder->Bit)) & 1;
+      if (++Decoder->Bit == 8) {
+        Decoder->Bit = 0;
+        Decoder->Data++;
+      }
+    } else {
+      Font_NextRun(Decoder);
+      Count = Decoder->Width - Column;
+      if (Decoder->Run < Count) {
+        Count = Decoder->Run;
+      }
+      Decoder->Run -= Count;
+      Lit = Decoder->Color;
+    }
+
+    if (Lit) {
+      int32_t X = Decoder->Left + Column;
+      int32_t X_End = X + Count;
+      for (X = X < 0 ? 0 : X; X < X_End && X < Columns; X++) {
+        Row[X / 8] |= 0x80 >> (X % 8);
+      }
+    }
+    Column += Count;
+  }
+}
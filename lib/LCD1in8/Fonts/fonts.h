@@ -65,6 +65,71 @@ extern sFONT Font16;
 extern sFONT Font12;
 extern sFONT Font8;
 
+/* Packed fonts --------------------------------------------------------------*/
+/* Written by the fontc tool, see tools/fontc.cpp. Every glyph keeps only its
+   bounding box, as plain bits or run lengths, in 4 bytes of metrics. The
+   advance is the font's, or one per glyph for proportional fonts. */
+#define FONT_GLYPH_BITS  0 /* Box pixels row by row, one bit each, MSB first */
+#define FONT_GLYPH_RLE   1 /* Alternating background / foreground runs, one
+                              nibble each (high first), starting with the
+                              background; 15 continues the run */
+#define FONT_GLYPH_TABLE 2 /* sFONT rows, padded to whole bytes */
+
+/* Limits of the packed metrics */
+#define FONT_GLYPH_DATA_MAX 4096 /* Bytes of glyph data */
+#define FONT_GLYPH_BOX_MAX  31   /* Box size and Top */
+
+typedef struct _tGlyph
+{
+  uint32_t Offset : 12;  /* First byte in Data */
+  int32_t Left : 5;      /* Box position from the pen, -16..15 */
+  uint32_t Top : 5;      /* Box position from the top of the line */
+  uint32_t Width : 5;    /* Box size */
+  uint32_t Height : 5;
+} sGLYPH;
+
+typedef struct _tPackedFont
+{
+  const uint8_t *Data;
+  const sGLYPH *Glyphs;
+  const uint8_t *Advances; /* Pen advance of each glyph, NULL when all of
+                              them advance by Advance */
+  uint8_t Advance;
+  uint8_t Encoding;  /* FONT_GLYPH_BITS or FONT_GLYPH_RLE, of every glyph */
+  uint8_t First;     /* Character of Glyphs[0] */
+  uint8_t Count;
+  uint16_t Height;   /* Line height */
+} sPFONT;
+
+/* Row by row reader of a glyph cell */
+typedef struct _tGlyphDecoder
+{
+  const uint8_t *Data;
+  uint8_t Encoding;
+  uint8_t Bit;       /* Next bit of *Data (bits) or 4 for its low nibble */
+  uint8_t Color;     /* RLE: color of the current run */
+  uint8_t Continued; /* RLE: the run goes on with the next nibble */
+  uint16_t Run;      /* RLE: pixels left in the current run */
+  int16_t Left;
+  uint16_t Top;
+  uint16_t Width;
+  uint16_t Height;
+  uint16_t Row;      /* Next cell row */
+} sGLYPH_DECODER;
+
+const sGLYPH *Font_FindGlyph(const sPFONT *Font, char Char);
+uint16_t Font_Advance(const sPFONT *Font, const sGLYPH *Glyph);
+void Font_DecodeTable(sGLYPH_DECODER *Decoder, const sFONT *Font, char Char);
+void Font_DecodePacked(sGLYPH_DECODER *Decoder, const sPFONT *Font,
+                       const sGLYPH *Glyph);
+void Font_DecodeRow(sGLYPH_DECODER *Decoder, uint8_t *Row, uint16_t Columns);
+
+extern sPFONT Font24_Packed;
+extern sPFONT Font20_Packed;
+extern sPFONT Font16_Packed;
+extern sPFONT Font12_Packed;
+extern sPFONT Font8_Packed;
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,112 @@
+/***********************************************************************************************************************
+  | file      	:	fontbench.cpp
+  | function	:	Flash use and row decoding speed of the built-in fonts,
+  |                 as sFONT tables and packed
+  | usage     	:	fontbench, from a -DCMAKE_BUILD_TYPE=Release build
+***********************************************************************************************************************/
+
+#include "fonts.h"
+
+#include <chrono>
+#include <stdio.h>
+
+#define FONTBENCH_ROUNDS 20000
+
+typedef struct {
+  const char *Name;
+  sFONT *Table;
+  sPFONT *Packed;
+} FONTBENCH_FONT;
+
+/********************************************************************************
+  function:
+                        Bytes of glyph data of a packed font
+  note:
+                        A glyph ends where the next one starts, the last one
+                        where its decoder stops reading.
+********************************************************************************/
+static uint32_t Fontbench_DataSize(const sPFONT *Font) {
+  uint32_t Size = 0;
+  for (uint8_t i = 0; i < Font->Count; i++) {
+    const sGLYPH *Glyph = &Font->Glyphs[i];
+    sGLYPH_DECODER Decoder;
+    uint8_t Row[32];
+    Font_DecodePacked(&Decoder, Font, Glyph);
+    for (uint16_t y = 0; y < Font->Height; y++) {
+      Font_DecodeRow(&Decoder, Row, Font_Advance(Font, Glyph));
+    }
+    uint32_t End = Decoder.Data - Font->Data + (Decoder.Bit ? 1 : 0);
+    for (uint8_t j = 0; j < Font->Count; j++) {
+      if (Font->Glyphs[j].Offset > Glyph->Offset &&
+          Font->Glyphs[j].Offset < End) {
+        End = Font->Glyphs[j].Offset;
+      }
+    }
+    if (End > Size) {
+      Size = End;
+    }
+  }
+  return Size;
+}
+
+// Glyphs a second, every row of every character decoded
+template <typename Start>
+static double Fontbench_Rate(uint8_t Count, uint16_t Height, Start Begin,
+                             uint32_t *Sum) {
+  auto Time_Start = std::chrono::steady_clock::now();
+  for (uint32_t Round = 0; Round < FONTBENCH_ROUNDS; Round++) {
+    for (uint8_t i = 0; i < Count; i++) {
+      sGLYPH_DECODER Decoder;
+      uint8_t Row[32];
+      uint16_t Columns = Begin(&Decoder, i);
+      for (uint16_t y = 0; y < Height; y++) {
+        Font_DecodeRow(&Decoder, Row, Columns);
+        *Sum += Row[0];
+      }
+    }
+  }
+  std::chrono::duration<double> Time =
+      std::chrono::steady_clock::now() - Time_Start;
+  return (double)FONTBENCH_ROUNDS * Count / Time.count();
+}
+
+int main(void) {
+  static const FONTBENCH_FONT Fonts[] = {
+      {"Font8", &Font8, &Font8_Packed},    {"Font12", &Font12, &Font12_Packed},
+      {"Font16", &Font16, &Font16_Packed}, {"Font20", &Font20, &Font20_Packed},
+      {"Font24", &Font24, &Font24_Packed},
+  };
+  uint32_t Sum = 0;
+
+  printf("%-8s %12s %12s %15s %15s\n", "", "sFONT bytes", "packed bytes",
+         "sFONT Mglyph/s", "packed Mglyph/s");
+  for (const FONTBENCH_FONT &Font : Fonts) {
+    const sPFONT *Packed = Font.Packed;
+    uint32_t Table_Size =
+        95 * Font.Table->Height * ((Font.Table->Width + 7) / 8);
+    uint32_t Packed_Size = Fontbench_DataSize(Packed) +
+                           Packed->Count * sizeof(sGLYPH) +
+                           (Packed->Advances ? Packed->Count : 0);
+
+    double Table_Rate = Fontbench_Rate(
+        95, Font.Table->Height,
+        [&](sGLYPH_DECODER *Decoder, uint8_t i) -> uint16_t {
+          Font_DecodeTable(Decoder, Font.Table, ' ' + i);
+          return Font.Table->Width;
+        },
+        &Sum);
+    double Packed_Rate = Fontbench_Rate(
+        Packed->Count, Packed->Height,
+        [&](sGLYPH_DECODER *Decoder, uint8_t i) -> uint16_t {
+          Font_DecodePacked(Decoder, Packed, &Packed->Glyphs[i]);
+          return Font_Advance(Packed, &Packed->Glyphs[i]);
+        },
+        &Sum);
+
+    printf("%-8s %12u %12u %15.1f %15.1f\n", Font.Name, Table_Size,
+           Packed_Size, Table_Rate / 1e6, Packed_Rate / 1e6);
+  }
+  // Keeps the decoded rows from being optimized away
+  printf("checksum %08x\n", Sum);
+  return 0;
+}
@@ -0,0 +1,358 @@
+/***********************************************************************************************************************
+  | file      	:	fontc.cpp
+  | function	:	Compile a font into the packed format of fonts.h
+  | usage     	:	fontc [-p] <Font8..Font24 | file.bdf> <name> <output.c>
+  |               	-p  proportional advances, from the glyph boxes
+***********************************************************************************************************************/
+
+#include "fonts.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#define FONTC_FIRST ' '
+#define FONTC_LAST '~'
+
+/********************************************************************************
+  function:
+                        A character as lit pixels, relative to the pen on the
+                        top of the line
+********************************************************************************/
+typedef struct {
+  int Advance;
+  std::vector<std::pair<int, int>> Pixels; // x, y
+} FONTC_GLYPH;
+
+typedef struct {
+  int Height;
+  FONTC_GLYPH Glyph[FONTC_LAST - FONTC_FIRST + 1];
+} FONTC_FONT;
+
+static void Fontc_Fail(const char *Message, const char *Detail) {
+  fprintf(stderr, "fontc: %s%s\n", Message, Detail);
+  exit(1);
+}
+
+/*******************************************************************************
+function:
+                Read one of the sFONT tables linked in
+*******************************************************************************/
+static bool Fontc_LoadTable(const char *Name, FONTC_FONT *Font,
+                            uint32_t *Table_Size) {
+  static const struct {
+    const char *Name;
+    const sFONT *Font;
+  } Tables[] = {{"Font8", &Font8},
+                {"Font12", &Font12},
+                {"Font16", &Font16},
+                {"Font20", &Font20},
+                {"Font24", &Font24}};
+
+  for (const auto &Table : Tables) {
+    if (strcmp(Name, Table.Name) != 0) {
+      continue;
+    }
+    const sFONT *Src = Table.Font;
+    uint32_t Row_Bytes = Src->Width / 8 + (Src->Width % 8 ? 1 : 0);
+    Font->Height = Src->Height;
+    for (int Char = FONTC_FIRST; Char <= FONTC_LAST; Char++) {
+      FONTC_GLYPH *Glyph = &Font->Glyph[Char - FONTC_FIRST];
+      const uint8_t *Row = &Src->table[(Char - ' ') * Src->Height * Row_Bytes];
+      Glyph->Advance = Src->Width;
+      for (int Y = 0; Y < Src->Height; Y++, Row += Row_Bytes) {
+        for (int X = 0; X < Src->Width; X++) {
+          if (Row[X / 8] & (0x80 >> (X % 8))) {
+            Glyph->Pixels.push_back({X, Y});
+          }
+        }
+      }
+    }
+    *Table_Size = (FONTC_LAST - FONTC_FIRST + 1) * Src->Height * Row_Bytes;
+    return true;
+  }
+  return false;
+}
+
+/*******************************************************************************
+function:
+                Read the printable ASCII characters of a BDF font
+*******************************************************************************/
+static void Fontc_LoadBDF(const char *Path, FONTC_FONT *Font) {
+  FILE *File = fopen(Path, "r");
+  if (!File) {
+    Fontc_Fail("cannot open ", Path);
+  }
+
+  int Ascent = -1, Descent = -1, Box_Height = 0, Box_Y = 0, Box_Width = 0;
+  int Encoding = -1, Advance = 0, Width = 0, Height = 0, X_Off = 0, Y_Off = 0;
+  int Bitmap_Row = -1;
+  bool Seen[FONTC_LAST - FONTC_FIRST + 1] = {};
+  char Line[1024];
+
+  while (fgets(Line, sizeof(Line), File)) {
+    if (Bitmap_Row >= 0) {
+      if (strncmp(Line, "ENDCHAR", 7) == 0) {
+        Bitmap_Row = -1;
+        continue;
+      }
+      if (Encoding >= FONTC_FIRST && Encoding <= FONTC_LAST) {
+        FONTC_GLYPH *Glyph = &Font->Glyph[Encoding - FONTC_FIRST];
+        int Top = Ascent - (Y_Off + Height) + Bitmap_Row;
+        for (int X = 0; X < Width; X++) {
+          char Digit[2] = {Line[X / 4], 0};
+          if (strtol(Digit, nullptr, 16) & (8 >> (X % 4))) {
+            Glyph->Pixels.push_back({X_Off + X, Top});
+          }
+        }
+      }
+      Bitmap_Row++;
+      continue;
+    }
+
+    sscanf(Line, "FONT_ASCENT %d", &Ascent);
+    sscanf(Line, "FONT_DESCENT %d", &Descent);
+    if (sscanf(Line, "FONTBOUNDINGBOX %d %d %*d %d", &Box_Width, &Box_Height,
+               &Box_Y) == 3 &&
+        Ascent < 0) {
+      Ascent = Box_Height + Box_Y;
+      Descent = -Box_Y;
+    }
+    if (sscanf(Line, "ENCODING %d", &Encoding) == 1) {
+      Advance = Box_Width;
+    }
+    sscanf(Line, "DWIDTH %d", &Advance);
+    sscanf(Line, "BBX %d %d %d %d", &Width, &Height, &X_Off, &Y_Off);
+    if (strncmp(Line, "BITMAP", 6) == 0) {
+      Bitmap_Row = 0;
+      if (Encoding >= FONTC_FIRST && Encoding <= FONTC_LAST) {
+        Font->Glyph[Encoding - FONTC_FIRST].Advance = Advance;
+        Seen[Encoding - FONTC_FIRST] = true;
+      }
+    }
+  }
+  fclose(File);
+
+  if (Ascent < 0 || Descent < 0) {
+    Fontc_Fail("no FONT_ASCENT / FONT_DESCENT in ", Path);
+  }
+  Font->Height = Ascent + Descent;
+  for (int i = 0; i <= FONTC_LAST - FONTC_FIRST; i++) {
+    if (!Seen[i]) {
+      Font->Glyph[i].Advance = Box_Width;
+    }
+  }
+}
+
+/*******************************************************************************
+function:
+                Pack the box of a glyph as bits and as runs
+*******************************************************************************/
+static void Fontc_Encode(const std::vector<bool> &Box,
+                         std::vector<uint8_t> *Bits,
+                         std::vector<uint8_t> *Runs) {
+  Bits->assign((Box.size() + 7) / 8, 0);
+  for (size_t i = 0; i < Box.size(); i++) {
+    if (Box[i]) {
+      (*Bits)[i / 8] |= 0x80 >> (i % 8);
+    }
+  }
+
+  std::vector<uint8_t> Nibbles;
+  bool Color = false;
+  size_t i = 0;
+  while (i < Box.size()) {
+    size_t Run = 0;
+    while (i < Box.size() && Box[i] == Color) {
+      Run++;
+      i++;
+    }
+    for (; Run >= 15; Run -= 15) {
+      Nibbles.push_back(15);
+    }
+    Nibbles.push_back(Run);
+    Color = !Color;
+  }
+  Runs->assign((Nibbles.size() + 1) / 2, 0);
+  for (size_t n = 0; n < Nibbles.size(); n++) {
+    (*Runs)[n / 2] |= n % 2 ? Nibbles[n] : Nibbles[n] << 4;
+  }
+}
+
+int main(int argc, char **argv) {
+  bool Proportional = false;
+  if (argc > 1 && strcmp(argv[1], "-p") == 0) {
+    Proportional = true;
+    argc--;
+    argv++;
+  }
+  if (argc != 4) {
+    fprintf(stderr,
+            "usage: fontc [-p] <Font8..Font24 | file.bdf> <name> <output.c>\n");
+    return 2;
+  }
+  const char *Input = argv[1];
+  const char *Name = argv[2];
+  const char *Output = argv[3];
+
+  static FONTC_FONT Font;
+  uint32_t Table_Size = 0;
+  if (!Fontc_LoadTable(Input, &Font, &Table_Size)) {
+    Fontc_LoadBDF(Input, &Font);
+  }
+
+  // Every box as bits and as runs, the smaller of both for the whole font
+  std::vector<std::vector<uint8_t>> Bits, Runs;
+  std::vector<sGLYPH> Glyphs;
+  std::vector<uint8_t> Advances;
+  size_t Bits_Size = 0, Runs_Size = 0;
+  for (const FONTC_GLYPH &Src : Font.Glyph) {
+    sGLYPH Glyph = {};
+    int Left = 0, Top = 0, Right = -1, Bottom = -1;
+    for (size_t i = 0; i < Src.Pixels.size(); i++) {
+      int X = Src.Pixels[i].first, Y = Src.Pixels[i].second;
+      Left = i == 0 || X < Left ? X : Left;
+      Right = i == 0 || X > Right ? X : Right;
+      Top = i == 0 || Y < Top ? Y : Top;
+      Bottom = i == 0 || Y > Bottom ? Y : Bottom;
+    }
+    if (Top < 0 || Bottom >= Font.Height || Src.Advance > 255 ||
+        Src.Advance < 0) {
+      Fontc_Fail("glyph out of range in ", Input);
+    }
+
+    // Proportional: the box starts at the pen, one column of spacing after
+    // it; blanks get half their advance
+    int Advance = Src.Advance;
+    if (Proportional) {
+      Advance = Right >= Left ? Right - Left + 2 : (Advance + 1) / 2;
+    }
+    int Glyph_Left = Right >= Left && !Proportional ? Left : 0;
+    int Glyph_Top = Right >= Left ? Top : 0;
+    if (Glyph_Left < -16 || Glyph_Left > 15 || Glyph_Top > FONT_GLYPH_BOX_MAX ||
+        Right - Left + 1 > FONT_GLYPH_BOX_MAX ||
+        Bottom - Top + 1 > FONT_GLYPH_BOX_MAX) {
+      Fontc_Fail("glyph box over the packed metrics in ", Input);
+    }
+    Glyph.Left = Glyph_Left;
+    Glyph.Top = Glyph_Top;
+    Glyph.Width = Right - Left + 1;
+    Glyph.Height = Bottom - Top + 1;
+
+    std::vector<bool> Box(Glyph.Width * Glyph.Height);
+    for (const auto &Pixel : Src.Pixels) {
+      Box[(Pixel.second - Top) * Glyph.Width + Pixel.first - Left] = true;
+    }
+    Bits.emplace_back();
+    Runs.emplace_back();
+    Fontc_Encode(Box, &Bits.back(), &Runs.back());
+    Bits_Size += Bits.back().size();
+    Runs_Size += Runs.back().size();
+    Glyphs.push_back(Glyph);
+    Advances.push_back(Advance);
+  }
+
+  uint8_t Encoding = Runs_Size < Bits_Size ? FONT_GLYPH_RLE : FONT_GLYPH_BITS;
+  std::vector<uint8_t> Data;
+  for (size_t i = 0; i < Glyphs.size(); i++) {
+    const std::vector<uint8_t> &Box = Encoding == FONT_GLYPH_RLE ? Runs[i]
+                                                                 : Bits[i];
+    Glyphs[i].Offset = Data.size();
+    Data.insert(Data.end(), Box.begin(), Box.end());
+  }
+  if (Data.size() > FONT_GLYPH_DATA_MAX) {
+    Fontc_Fail("glyph data over the packed metrics in ", Input);
+  }
+  if (Data.empty()) {
+    Data.push_back(0);
+  }
+
+  // Monospaced fonts keep one advance
+  bool Monospaced = true;
+  for (uint8_t Advance : Advances) {
+    Monospaced = Monospaced && Advance == Advances[0];
+  }
+
+  FILE *File = fopen(Output, "w");
+  if (!File) {
+    Fontc_Fail("cannot write ", Output);
+  }
+  std::string File_Name = Output;
+  File_Name = File_Name.substr(File_Name.find_last_of('/') + 1);
+  fprintf(File,
+          "/**\n"
+          "  "
+          "******************************************************************"
+          "************\n"
+          "  * @file    %s\n"
+          "  * @brief   %s packed by fontc%s, do not edit\n"
+          "  "
+          "******************************************************************"
+          "************\n"
+          "  */\n\n"
+          "#include \"fonts.h\"\n\n",
+          File_Name.c_str(), Input, Proportional ? " -p" : "");
+
+  fprintf(File, "static const uint8_t %s_Data[] =\n{", Name);
+  for (size_t i = 0; i < Data.size(); i++) {
+    fprintf(File, "%s0x%02X,", i % 12 ? " " : "\n\t", Data[i]);
+  }
+  fprintf(File, "\n};\n\n");
+
+  fprintf(File, "static const sGLYPH %s_Glyphs[] =\n{\n", Name);
+  for (size_t i = 0; i < Glyphs.size(); i++) {
+    const sGLYPH &Glyph = Glyphs[i];
+    char Char = FONTC_FIRST + i;
+    fprintf(File, "\t{ %4u, %3d, %2u, %2u, %2u }, /* '%s%c' */\n",
+            (unsigned)Glyph.Offset, (int)Glyph.Left, (unsigned)Glyph.Top,
+            (unsigned)Glyph.Width, (unsigned)Glyph.Height,
+            Char == '\\' || Char == '\'' ? "\\" : "", Char);
+  }
+  fprintf(File, "};\n\n");
+
+  if (!Monospaced) {
+    fprintf(File, "static const uint8_t %s_Advances[] =\n{", Name);
+    for (size_t i = 0; i < Advances.size(); i++) {
+      fprintf(File, "%s%3u,", i % 12 ? " " : "\n\t", Advances[i]);
+    }
+    fprintf(File, "\n};\n\n");
+  }
+
+  std::string Advances_Name = Monospaced ? std::string("0, /* Advances */")
+                                         : std::string(Name) + "_Advances,";
+  fprintf(File,
+          "sPFONT %s = {\n"
+          "  %s_Data,\n"
+          "  %s_Glyphs,\n"
+          "  %s\n"
+          "  %u, /* Advance */\n"
+          "  %s,\n"
+          "  %d, /* First */\n"
+          "  %u, /* Count */\n"
+          "  %d, /* Height */\n"
+          "};\n",
+          Name, Name, Name, Advances_Name.c_str(),
+          Monospaced ? Advances[0] : 0,
+          Encoding == FONT_GLYPH_RLE ? "FONT_GLYPH_RLE" : "FONT_GLYPH_BITS",
+          FONTC_FIRST, (unsigned)Glyphs.size(), Font.Height);
+  fclose(File);
+
+  uint32_t Metrics_Size =
+      Glyphs.size() * sizeof(sGLYPH) + (Monospaced ? 0 : Advances.size());
+  uint32_t Packed_Size = Data.size() + Metrics_Size;
+  if (Table_Size) {
+    printf("%s: %u bytes as sFONT, %u packed (%u glyph data, %u metrics)\n",
+           Input, Table_Size, Packed_Size, (unsigned)Data.size(),
+           Metrics_Size);
+    if (Packed_Size >= Table_Size) {
+      fprintf(stderr, "fontc: %s packed is not smaller than its sFONT\n",
+              Input);
+    }
+  } else {
+    printf("%s: %u bytes packed (%u glyph data, %u metrics)\n", Input,
+           Packed_Size, (unsigned)Data.size(), Metrics_Size);
+  }
+  return 0;
+}
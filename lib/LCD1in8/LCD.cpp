@@ -1,4 +1,3 @@
-
 /***********************************************************************************************************************
   | file      	:	LCD.c
   |	version		:	V1.0
@@ -8,12 +7,29 @@ lines, drawing, writing and other functions to achieve
 ***********************************************************************************************************************/
 
 #include "LCD.h"
+#include "LCD_Command.h"
+#include "LCD_GlyphCache.h"
+#include "LCD_InitTable.h"
+#include "LCD_Layout.h"
 
 #include <stdio.h>
 #include <stdlib.h> //itoa()
+#include <string.h>
 
 LCD_DIS sLCD_DIS;
 
+/**
+ * @params transport bus to the panel, must outlive the driver
+ */
+LCD_ST7735S::LCD_ST7735S(LCD_Transport *transport)
+#if !defined(LCD_HOST)
+    : spi_transport(nullptr, 0, 0, 0, 0)
+#endif
+{
+  LCD_Attach(transport);
+}
+
+#if !defined(LCD_HOST)
 /**
  * @params spi_port spi port number to write
  * @params pin_cs pico pin number to connect CS in LCD
@@ -22,18 +38,52 @@ LCD_DIS sLCD_DIS;
  * @params pin_bl pico pin number to connect BL in LCD
  */
 LCD_ST7735S::LCD_ST7735S(spi_inst_t *spi_port, uint pin_cs, uint pin_dc,
-                         uint pin_rst, uint pin_bl) {
-  this->spi_port = spi_port;
-  this->pin_cs = pin_cs;
-  this->pin_dc = pin_dc;
-  this->pin_rst = pin_rst;
-  this->pin_bl = pin_bl;
+                         uint pin_rst, uint pin_bl)
+    : spi_transport(spi_port, pin_cs, pin_dc, pin_rst, pin_bl) {
+  LCD_Attach(&spi_transport);
 }
+#endif
 
-void LCD_ST7735S::Write_CS(bool Val) { gpio_put(pin_cs, Val); }
-void LCD_ST7735S::Write_DC(bool Val) { gpio_put(pin_dc, Val); }
-void LCD_ST7735S::Write_RST(bool Val) { gpio_put(pin_rst, Val); }
-void LCD_ST7735S::Write_BL(bool Val) { gpio_put(pin_bl, Val); }
+void LCD_ST7735S::LCD_Attach(LCD_Transport *transport) {
+  this->transport = transport;
+  this->init_state = LCD_INIT_IDLE;
+  this->init_scan_dir = SCAN_DIR_DFT;
+  this->init_table = nullptr;
+  this->init_reset_us = 0;
+  this->init_deadline_us = 0;
+  this->frame_buffer = nullptr;
+  this->fb_top = 0;
+  this->fb_bottom = 0;
+  this->index_buffer = nullptr;
+  this->index_bpp = 8;
+  this->palette = nullptr;
+  this->palette_used = 0;
+  this->palette_full = false;
+  this->index_cached = false;
+  this->dirty_count = 0;
+  this->flush_count = 0;
+  this->flush_index = 0;
+  this->flush_row = 0;
+  this->flush_buffer = nullptr;
+  this->flush_top = 0;
+  this->flush_indices = nullptr;
+  this->flush_active = false;
+  this->flush_window = false;
+  this->flush_callback = nullptr;
+  this->flush_callback_data = nullptr;
+  this->span_vertical = false;
+  this->span_open = false;
+  this->span_color = 0;
+  this->span_line_start = 0;
+  this->span_line_end = 0;
+  this->span_start = 0;
+  this->span_end = 0;
+  this->curve_rows = 0;
+  this->glyph_lut_valid = false;
+  this->glyph_lut_background = 0;
+  this->glyph_lut_foreground = 0;
+  this->glyph_cache = nullptr;
+}
 
 /***********************************************************************************************************************
                         ------------------------------------------------------------------------
@@ -42,151 +92,98 @@ void LCD_ST7735S::Write_BL(bool Val) { gpio_put(pin_bl, Val); }
 layer								///|
                         ------------------------------------------------------------------------
 ***********************************************************************************************************************/
+void LCD_ST7735S::LCD_WriteData_16Bit(uint16_t Data) {
+  uint8_t buf[2] = {(uint8_t)(Data >> 8), uint8_t(Data & 0xff)};
+  transport->WriteData(buf, 2);
+}
+
 /*******************************************************************************
 function:
-                        Hardware reset
+                Write the same 16 bit data DataLen times
+parameter:
+                Data    :   16 bit data (sent MSB first)
+                DataLen :   Number of repetitions
 *******************************************************************************/
-void LCD_ST7735S::LCD_Reset(void) {
-  Write_RST(1);
-  sleep_ms(100);
-  Write_RST(0);
-  sleep_ms(100);
-  Write_RST(1);
-  sleep_ms(100);
+void LCD_ST7735S::LCD_WriteData_NLen16Bit(uint16_t Data, uint32_t DataLen) {
+  transport->WriteRepeated(Data, DataLen);
 }
 
 /*******************************************************************************
 function:
-                Write register address and data
+                Write DataLen 16 bit words from Buffer
 *******************************************************************************/
-void LCD_ST7735S::LCD_WriteReg(uint8_t Reg) {
-  Write_DC(0);
-  Write_CS(0);
-  spi_write_blocking(spi_port, &Reg, 1);
-  Write_CS(1);
+void LCD_ST7735S::LCD_WriteData_Buffer(const LCD_COLOR *Buffer,
+                                       uint32_t DataLen) {
+  transport->WritePixels(Buffer, DataLen);
 }
 
-void LCD_ST7735S::LCD_WriteData_8Bit(uint8_t Data) {
-  Write_DC(1);
-  Write_CS(0);
-  spi_write_blocking(spi_port, &Data, 1);
-  Write_CS(1);
+/*******************************************************************************
+function:
+                Start streaming the same 16 bit data DataLen times
+note:
+                Returns as soon as the transfer is started, Callback runs
+                once it is on the wire.
+*******************************************************************************/
+void LCD_ST7735S::LCD_StartData_NLen16Bit(uint16_t Data, uint32_t DataLen,
+                                          LCD_CALLBACK Callback,
+                                          void *User_Data) {
+  transport->StartRepeated(Data, DataLen, Callback, User_Data);
 }
 
-void LCD_ST7735S::LCD_WriteData_16Bit(uint16_t Data) {
-  uint8_t buf[2] = {(uint8_t)(Data >> 8), uint8_t(Data & 0xff)};
-  Write_DC(1);
-  Write_CS(0);
-  spi_write_blocking(spi_port, buf, 2);
-  Write_CS(1);
+/*******************************************************************************
+function:
+                Start streaming DataLen 16 bit words from Buffer
+*******************************************************************************/
+void LCD_ST7735S::LCD_StartData_Buffer(const LCD_COLOR *Buffer,
+                                       uint32_t DataLen, LCD_CALLBACK Callback,
+                                       void *User_Data) {
+  transport->StartPixels(Buffer, DataLen, Callback, User_Data);
 }
 
-void LCD_ST7735S::LCD_WriteData_NLen16Bit(uint16_t Data, uint32_t DataLen) {
+/*******************************************************************************
+                Common register initialization
+*******************************************************************************/
+void LCD_ST7735S::LCD_InitReg(void) { LCD_WriteCommandTable(LCD_INIT_TABLE); }
 
-  uint8_t buf[2] = {(uint8_t)(Data >> 8), uint8_t(Data & 0xff)};
-  uint32_t i;
-  Write_DC(1);
-  Write_CS(0);
-  for (i = 0; i < DataLen; i++) {
-    spi_write_blocking(spi_port, buf, 2);
+/*******************************************************************************
+function:
+                Send a command table, see LCD_InitTable.h for the format
+*******************************************************************************/
+void LCD_ST7735S::LCD_WriteCommandTable(const uint8_t *Table) {
+  uint32_t Delay_ms;
+  while ((Table = LCD_WriteCommandEntries(Table, &Delay_ms)) != nullptr) {
+    transport->Delay_us(Delay_ms * 1000);
   }
-  Write_CS(1);
 }
 
 /*******************************************************************************
 function:
-                Common register initialization
+                Send table entries up to and including the next one with a
+                delay
+parameter:
+                Table    :   Entries to send
+                Delay_ms :   Receives the delay requested by the last entry
+return:
+                The entry to continue with after the delay, or nullptr when
+                the end of the table was reached
 *******************************************************************************/
-void LCD_ST7735S::LCD_InitReg(void) {
-  // ST7735R Frame Rate
-  LCD_WriteReg(0xB1);
-  LCD_WriteData_8Bit(0x01);
-  LCD_WriteData_8Bit(0x2C);
-  LCD_WriteData_8Bit(0x2D);
-
-  LCD_WriteReg(0xB2);
-  LCD_WriteData_8Bit(0x01);
-  LCD_WriteData_8Bit(0x2C);
-  LCD_WriteData_8Bit(0x2D);
-
-  LCD_WriteReg(0xB3);
-  LCD_WriteData_8Bit(0x01);
-  LCD_WriteData_8Bit(0x2C);
-  LCD_WriteData_8Bit(0x2D);
-  LCD_WriteData_8Bit(0x01);
-  LCD_WriteData_8Bit(0x2C);
-  LCD_WriteData_8Bit(0x2D);
-
-  LCD_WriteReg(0xB4); // Column inversion
-  LCD_WriteData_8Bit(0x07);
-
-  // ST7735R Power Sequence
-  LCD_WriteReg(0xC0);
-  LCD_WriteData_8Bit(0xA2);
-  LCD_WriteData_8Bit(0x02);
-  LCD_WriteData_8Bit(0x84);
-  LCD_WriteReg(0xC1);
-  LCD_WriteData_8Bit(0xC5);
-
-  LCD_WriteReg(0xC2);
-  LCD_WriteData_8Bit(0x0A);
-  LCD_WriteData_8Bit(0x00);
-
-  LCD_WriteReg(0xC3);
-  LCD_WriteData_8Bit(0x8A);
-  LCD_WriteData_8Bit(0x2A);
-  LCD_WriteReg(0xC4);
-  LCD_WriteData_8Bit(0x8A);
-  LCD_WriteData_8Bit(0xEE);
-
-  LCD_WriteReg(0xC5); // VCOM
-  LCD_WriteData_8Bit(0x0E);
-
-  // ST7735R Gamma Sequence
-  LCD_WriteReg(0xe0);
-  LCD_WriteData_8Bit(0x0f);
-  LCD_WriteData_8Bit(0x1a);
-  LCD_WriteData_8Bit(0x0f);
-  LCD_WriteData_8Bit(0x18);
-  LCD_WriteData_8Bit(0x2f);
-  LCD_WriteData_8Bit(0x28);
-  LCD_WriteData_8Bit(0x20);
-  LCD_WriteData_8Bit(0x22);
-  LCD_WriteData_8Bit(0x1f);
-  LCD_WriteData_8Bit(0x1b);
-  LCD_WriteData_8Bit(0x23);
-  LCD_WriteData_8Bit(0x37);
-  LCD_WriteData_8Bit(0x00);
-  LCD_WriteData_8Bit(0x07);
-  LCD_WriteData_8Bit(0x02);
-  LCD_WriteData_8Bit(0x10);
-
-  LCD_WriteReg(0xe1);
-  LCD_WriteData_8Bit(0x0f);
-  LCD_WriteData_8Bit(0x1b);
-  LCD_WriteData_8Bit(0x0f);
-  LCD_WriteData_8Bit(0x17);
-  LCD_WriteData_8Bit(0x33);
-  LCD_WriteData_8Bit(0x2c);
-  LCD_WriteData_8Bit(0x29);
-  LCD_WriteData_8Bit(0x2e);
-  LCD_WriteData_8Bit(0x30);
-  LCD_WriteData_8Bit(0x30);
-  LCD_WriteData_8Bit(0x39);
-  LCD_WriteData_8Bit(0x3f);
-  LCD_WriteData_8Bit(0x00);
-  LCD_WriteData_8Bit(0x07);
-  LCD_WriteData_8Bit(0x03);
-  LCD_WriteData_8Bit(0x10);
-
-  LCD_WriteReg(0xF0); // Enable test command
-  LCD_WriteData_8Bit(0x01);
-
-  LCD_WriteReg(0xF6); // Disable ram power save mode
-  LCD_WriteData_8Bit(0x00);
-
-  LCD_WriteReg(0x3A); // 65k mode
-  LCD_WriteData_8Bit(0x05);
+const uint8_t *LCD_ST7735S::LCD_WriteCommandEntries(const uint8_t *Table,
+                                                    uint32_t *Delay_ms) {
+  while (*Table != LCD_CMD_END) {
+    uint8_t Reg = *Table++;
+    uint8_t Len = *Table++;
+    uint8_t Params = Len & ~LCD_CMD_DELAY;
+    transport->WriteCommand(Reg, Table, Params);
+    Table += Params;
+    if (Len & LCD_CMD_DELAY) {
+      // The delay only starts once the command is on the wire
+      transport->Wait();
+      *Delay_ms = *Table++;
+      return Table;
+    }
+  }
+  transport->Wait();
+  return nullptr;
 }
 
 /********************************************************************************
@@ -248,12 +245,12 @@ void LCD_ST7735S::LCD_SetGramScanWay(LCD_SCAN_DIR Scan_dir) {
   }
 
   // Set the read / write scan direction of the frame memory
-  LCD_WriteReg(0x36); // MX, MY, RGB mode
 #if defined(LCD_1IN44)
-  LCD_WriteData_8Bit(MemoryAccessReg_Data | 0x08); // 0x08 set RGB
+  uint8_t MemoryAccess = MemoryAccessReg_Data | 0x08; // 0x08 set RGB
 #elif defined(LCD_1IN8)
-  LCD_WriteData_8Bit(MemoryAccessReg_Data & 0xf7); // RGB color filter panel
+  uint8_t MemoryAccess = MemoryAccessReg_Data & 0xf7; // RGB color filter panel
 #endif
+  transport->WriteCommand(0x36, &MemoryAccess, 1); // MX, MY, RGB mode
 }
 
 /***********************************************************************************************************************
@@ -270,28 +267,124 @@ function:
                         initialization
 ********************************************************************************/
 void LCD_ST7735S::LCD_Init(LCD_SCAN_DIR Lcd_ScanDir) {
+  LCD_InitStart(Lcd_ScanDir);
+  while (!LCD_InitStep()) {
+    uint64_t Now = transport->Time_us();
+    if (init_deadline_us > Now) {
+      transport->Delay_us(init_deadline_us - Now);
+    }
+  }
+}
+
+/********************************************************************************
+function:	Start a non-blocking initialization
+parameter:
+                Lcd_ScanDir :   Scan direction
+note:
+                Every waiting period of the sequence (reset pulse, reset
+                recovery, sleep out) is a deadline instead of a sleep.
+                LCD_InitPoll tells whether the current deadline has passed,
+                LCD_InitStep performs the work that was waiting for it. In
+                between, the application is free to bring up other
+                peripherals. The delays are the datasheet minimums plus
+                LCD_INIT_MARGIN_PERCENT.
+********************************************************************************/
+void LCD_ST7735S::LCD_InitStart(LCD_SCAN_DIR Lcd_ScanDir) {
+  init_scan_dir = Lcd_ScanDir;
+
   // Turn on the backlight
-  Write_BL(1);
+  transport->Write_BL(1);
+
+  // Bus resources (DMA channels, state machine)
+  transport->Init();
 
   // Hardware reset
-  LCD_Reset();
+  transport->Write_RST(0);
+  init_state = LCD_INIT_RESET;
+  LCD_InitDelay(transport->Time_us(), LCD_RESET_PULSE_US);
+}
+
+/********************************************************************************
+function:	Whether the current deadline of the initialization has passed
+********************************************************************************/
+bool LCD_ST7735S::LCD_InitPoll(void) {
+  return init_state != LCD_INIT_IDLE && init_state != LCD_INIT_DONE &&
+         transport->Time_us() >= init_deadline_us;
+}
 
-  // Set the initialization register
-  LCD_InitReg();
+/********************************************************************************
+function:	Advance the initialization
+return:
+                true once the display is ready to draw
+********************************************************************************/
+bool LCD_ST7735S::LCD_InitStep(void) {
+  uint32_t Delay_ms;
+
+  while (LCD_InitPoll()) {
+    switch (init_state) {
+    case LCD_INIT_RESET:
+      transport->Write_RST(1);
+      init_reset_us = transport->Time_us();
+      init_table = LCD_INIT_TABLE;
+      init_state = LCD_INIT_REGISTER;
+      LCD_InitDelay(init_reset_us, LCD_RESET_CMD_US);
+      break;
+
+    case LCD_INIT_REGISTER:
+      // Set the initialization register
+      init_table = LCD_WriteCommandEntries(init_table, &Delay_ms);
+      if (init_table) {
+        LCD_InitDelay(transport->Time_us(), Delay_ms * 1000);
+        break;
+      }
+
+      // Set the display scan and color transfer modes
+      LCD_SetGramScanWay(init_scan_dir);
+      init_state = LCD_INIT_SLEEP_OUT;
+      LCD_InitDelay(init_reset_us, LCD_RESET_SLPOUT_US);
+      break;
+
+    case LCD_INIT_SLEEP_OUT:
+      init_table = LCD_POWERON_TABLE;
+      init_state = LCD_INIT_POWER_ON;
+      break;
+
+    case LCD_INIT_POWER_ON:
+      // sleep out and turn on the LCD display
+      init_table = LCD_WriteCommandEntries(init_table, &Delay_ms);
+      if (init_table) {
+        LCD_InitDelay(transport->Time_us(), Delay_ms * 1000);
+        break;
+      }
+
+      // clear
+      LCD_Clear(WHITE);
+      init_state = LCD_INIT_DONE;
+      break;
 
-  // Set the display scan and color transfer modes
-  LCD_SetGramScanWay(Lcd_ScanDir);
-  sleep_ms(200);
+    default:
+      break;
+    }
+  }
+  return init_state == LCD_INIT_DONE;
+}
+
+LCD_INIT_STATE LCD_ST7735S::LCD_InitState(void) { return init_state; }
 
-  // sleep out
-  LCD_WriteReg(0x11);
-  sleep_ms(120);
+/********************************************************************************
+function:	Time (us since boot) the initialization is waiting for
+********************************************************************************/
+uint64_t LCD_ST7735S::LCD_InitDeadline(void) { return init_deadline_us; }
 
-  // Turn on the LCD display
-  LCD_WriteReg(0x29);
+uint64_t LCD_ST7735S::LCD_Time_us(void) { return transport->Time_us(); }
+
+void LCD_ST7735S::LCD_Delay_us(uint32_t Delay_us) {
+  transport->Delay_us(Delay_us);
+}
 
-  // clear
-  LCD_Clear(WHITE);
+void LCD_ST7735S::LCD_InitDelay(uint64_t From_us, uint32_t Delay_us) {
+  init_deadline_us =
+      From_us + Delay_us + (uint64_t)Delay_us * LCD_INIT_MARGIN_PERCENT / 100;
 }
 
 /********************************************************************************
@@ -305,27 +398,19 @@ parameter:
 void LCD_ST7735S::LCD_SetWindows(LCD_POINT Xstart, LCD_POINT Ystart,
                                  LCD_POINT Xend, LCD_POINT Yend) {
 
-  // set the X coordinates
-  LCD_WriteReg(0x2A);
-  LCD_WriteData_8Bit(
-      0x00); // Set the horizontal starting point to the high octet
-  LCD_WriteData_8Bit(
-      (Xstart & 0xff) +
-      sLCD_DIS
-          .LCD_X_Adjust); // Set the horizontal starting point to the low octet
-  LCD_WriteData_8Bit(0x00); // Set the horizontal end to the high octet
-  LCD_WriteData_8Bit(
-      ((Xend - 1) & 0xff) +
-      sLCD_DIS.LCD_X_Adjust); // Set the horizontal end to the low octet
+  // set the X coordinates, high and low octet of start and end
+  uint8_t Column[4] = {0x00, (uint8_t)((Xstart & 0xff) + sLCD_DIS.LCD_X_Adjust),
+                       0x00,
+                       (uint8_t)(((Xend - 1) & 0xff) + sLCD_DIS.LCD_X_Adjust)};
+  transport->WriteCommand(0x2A, Column, sizeof(Column));
 
   // set the Y coordinates
-  LCD_WriteReg(0x2B);
-  LCD_WriteData_8Bit(0x00);
-  LCD_WriteData_8Bit((Ystart & 0xff) + sLCD_DIS.LCD_Y_Adjust);
-  LCD_WriteData_8Bit(0x00);
-  LCD_WriteData_8Bit(((Yend - 1) & 0xff) + sLCD_DIS.LCD_Y_Adjust);
+  uint8_t Page[4] = {0x00, (uint8_t)((Ystart & 0xff) + sLCD_DIS.LCD_Y_Adjust),
+                     0x00,
+                     (uint8_t)(((Yend - 1) & 0xff) + sLCD_DIS.LCD_Y_Adjust)};
+  transport->WriteCommand(0x2B, Page, sizeof(Page));
 
-  LCD_WriteReg(0x2C);
+  transport->WriteCommand(0x2C, nullptr, 0);
 }
 
 /********************************************************************************
@@ -359,6 +444,19 @@ parameter:
 ********************************************************************************/
 void LCD_ST7735S::LCD_SetPointlColor(LCD_POINT Xpoint, LCD_POINT Ypoint,
                                      LCD_COLOR Color) {
+  if (index_buffer) {
+    LCD_FB_Fill(Xpoint, Ypoint, Xpoint + 1, Ypoint + 1, Color);
+    return;
+  }
+  if (frame_buffer) {
+    if ((Xpoint < sLCD_DIS.LCD_Dis_Column) && (Ypoint >= fb_top) &&
+        (Ypoint < fb_bottom)) {
+      frame_buffer[(uint32_t)(Ypoint - fb_top) * sLCD_DIS.LCD_Dis_Column +
+                   Xpoint] = Color;
+      LCD_MarkDirty(Xpoint, Ypoint, Xpoint + 1, Ypoint + 1);
+    }
+    return;
+  }
   if ((Xpoint <= sLCD_DIS.LCD_Dis_Column) &&
       (Ypoint <= sLCD_DIS.LCD_Dis_Page)) {
     LCD_SetCursor(Xpoint, Ypoint);
@@ -378,6 +476,10 @@ parameter:
 void LCD_ST7735S::LCD_SetArealColor(LCD_POINT Xstart, LCD_POINT Ystart,
                                     LCD_POINT Xend, LCD_POINT Yend,
                                     LCD_COLOR Color) {
+  if (frame_buffer || index_buffer) {
+    LCD_FB_Fill(Xstart, Ystart, Xend, Yend, Color);
+    return;
+  }
   if ((Xend > Xstart) && (Yend > Ystart)) {
     LCD_SetWindows(Xstart, Ystart, Xend, Yend);
     LCD_SetColor(Color, Xend - Xstart, Yend - Ystart);
@@ -395,291 +497,1794 @@ void LCD_ST7735S::LCD_Clear(LCD_COLOR Color) {
 }
 
 /********************************************************************************
-function:	Draw Point (Xpoint, Ypoint) Fill the color
+function:	Draw a RGB565 bitmap
 parameter:
-                        Xpoint		:   The x coordinate of the point
-                        Ypoint		:   The y coordinate of the point
-                        Color		:   Set color
-                        Dot_Pixel	:	point size
+                Xpoint :   Upper left x coordinate
+                Ypoint :   Upper left y coordinate
+                Width  :   Bitmap width
+                Height :   Bitmap height
+                Bitmap :   Width * Height pixels, row by row
 ********************************************************************************/
-void LCD_ST7735S::LCD_DrawPoint(LCD_POINT Xpoint, LCD_POINT Ypoint,
-                                LCD_COLOR Color, DOT_PIXEL Dot_Pixel,
-                                DOT_STYLE DOT_STYLE) {
-
-  if (Xpoint > sLCD_DIS.LCD_Dis_Column || Ypoint > sLCD_DIS.LCD_Dis_Page) {
-    return;
-  }
-
-  uint16_t XDir_Num, YDir_Num;
-  if (DOT_STYLE == DOT_FILL_AROUND) {
-    for (XDir_Num = 0; XDir_Num < 2 * Dot_Pixel - 1; XDir_Num++) {
-      for (YDir_Num = 0; YDir_Num < 2 * Dot_Pixel - 1; YDir_Num++) {
-        LCD_SetPointlColor(Xpoint + XDir_Num - Dot_Pixel,
-                           Ypoint + YDir_Num - Dot_Pixel, Color);
-      }
-    }
-  } else {
-    for (XDir_Num = 0; XDir_Num < Dot_Pixel; XDir_Num++) {
-      for (YDir_Num = 0; YDir_Num < Dot_Pixel; YDir_Num++) {
-        LCD_SetPointlColor(Xpoint + XDir_Num - 1, Ypoint + YDir_Num - 1, Color);
-      }
-    }
+void LCD_ST7735S::LCD_DrawBitmap(LCD_POINT Xpoint, LCD_POINT Ypoint,
+                                 LCD_LENGTH Width, LCD_LENGTH Height,
+                                 const LCD_COLOR *Bitmap) {
+  LCD_DrawBitmap_Async(Xpoint, Ypoint, Width, Height, Bitmap);
+  if (!frame_buffer && !index_buffer) {
+    LCD_Wait();
   }
 }
 
 /********************************************************************************
-function:	Draw a line of arbitrary slope
-parameter:
-                        Xstart ：Starting x point coordinates
-                        Ystart ：Starting x point coordinates
-                        Xend   ：End point x coordinate
-                        Yend   ：End point y coordinate
-                        Color  ：The color of the line segment
+function:	Asynchronous versions of LCD_SetArealColor, LCD_Clear and
+                LCD_DrawBitmap. They return as soon as the pixel transfer
+                is started; completion is reported through Callback (from
+                the DMA interrupt) or polled with LCD_Busy / LCD_Wait.
 ********************************************************************************/
-void LCD_ST7735S::LCD_DrawLine(LCD_POINT Xstart, LCD_POINT Ystart,
-                               LCD_POINT Xend, LCD_POINT Yend, LCD_COLOR Color,
-                               LINE_STYLE Line_Style, DOT_PIXEL Dot_Pixel) {
-
-  if (Xstart > sLCD_DIS.LCD_Dis_Column || Ystart > sLCD_DIS.LCD_Dis_Page ||
-      Xend > sLCD_DIS.LCD_Dis_Column || Yend > sLCD_DIS.LCD_Dis_Page) {
+void LCD_ST7735S::LCD_SetArealColor_Async(LCD_POINT Xstart, LCD_POINT Ystart,
+                                          LCD_POINT Xend, LCD_POINT Yend,
+                                          LCD_COLOR Color,
+                                          LCD_CALLBACK Callback,
+                                          void *User_Data) {
+  if (frame_buffer || index_buffer) {
+    LCD_FB_Fill(Xstart, Ystart, Xend, Yend, Color);
+    if (Callback) {
+      Callback(User_Data);
+    }
     return;
   }
+  if ((Xend > Xstart) && (Yend > Ystart)) {
+    LCD_SetWindows(Xstart, Ystart, Xend, Yend);
+    LCD_StartData_NLen16Bit(Color, (uint32_t)(Xend - Xstart) * (Yend - Ystart),
+                            Callback, User_Data);
+  } else if (Callback) {
+    Callback(User_Data);
+  }
+}
 
-  LCD_POINT Xpoint = Xstart;
-  LCD_POINT Ypoint = Ystart;
-  int32_t dx =
-      (int32_t)Xend - (int32_t)Xstart >= 0 ? Xend - Xstart : Xstart - Xend;
-  int32_t dy =
-      (int32_t)Yend - (int32_t)Ystart <= 0 ? Yend - Ystart : Ystart - Yend;
-
-  // Increment direction, 1 is positive, -1 is counter;
-  int32_t XAddway = Xstart < Xend ? 1 : -1;
-  int32_t YAddway = Ystart < Yend ? 1 : -1;
-
-  // Cumulative error
-  int32_t Esp = dx + dy;
-  int8_t Line_Style_Temp = 0;
+void LCD_ST7735S::LCD_Clear_Async(LCD_COLOR Color, LCD_CALLBACK Callback,
+                                  void *User_Data) {
+  LCD_SetArealColor_Async(0, 0, sLCD_DIS.LCD_Dis_Column, sLCD_DIS.LCD_Dis_Page,
+                          Color, Callback, User_Data);
+}
 
-  for (;;) {
-    Line_Style_Temp++;
-    // Painted dotted line, 2 point is really virtual
-    if (Line_Style == LINE_DOTTED && Line_Style_Temp % 3 == 0) {
-      LCD_DrawPoint(Xpoint, Ypoint, LCD_BACKGROUND, Dot_Pixel, DOT_STYLE_DFT);
-      Line_Style_Temp = 0;
-    } else {
-      LCD_DrawPoint(Xpoint, Ypoint, Color, Dot_Pixel, DOT_STYLE_DFT);
+void LCD_ST7735S::LCD_DrawBitmap_Async(LCD_POINT Xpoint, LCD_POINT Ypoint,
+                                       LCD_LENGTH Width, LCD_LENGTH Height,
+                                       const LCD_COLOR *Bitmap,
+                                       LCD_CALLBACK Callback,
+                                       void *User_Data) {
+  if (Width == 0 || Height == 0 ||
+      Xpoint + Width > sLCD_DIS.LCD_Dis_Column ||
+      Ypoint + Height > sLCD_DIS.LCD_Dis_Page) {
+    if (Callback) {
+      Callback(User_Data);
     }
-    if (2 * Esp >= dy) {
-      if (Xpoint == Xend)
-        break;
-      Esp += dy;
-      Xpoint += XAddway;
+    return;
+  }
+  if (index_buffer) {
+    LCD_MarkDirty(Xpoint, Ypoint, Xpoint + Width, Ypoint + Height);
+    for (LCD_POINT Row = Ypoint; Row < Ypoint + Height; Row++) {
+      LCD_IndexPack(Xpoint, Row, Width, Bitmap);
+      Bitmap += Width;
     }
-    if (2 * Esp <= dx) {
-      if (Ypoint == Yend)
-        break;
-      Esp += dx;
-      Ypoint += YAddway;
+    if (Callback) {
+      Callback(User_Data);
+    }
+    return;
+  }
+  if (frame_buffer) {
+    LCD_MarkDirty(Xpoint, Ypoint, Xpoint + Width, Ypoint + Height);
+    // Rows of the bitmap within the canvas
+    LCD_POINT Top = Ypoint > fb_top ? Ypoint : fb_top;
+    LCD_POINT Bottom = Ypoint + Height < fb_bottom ? Ypoint + Height : fb_bottom;
+    Bitmap += (uint32_t)(Top - Ypoint) * Width;
+    for (LCD_POINT Row = Top; Row < Bottom; Row++) {
+      memcpy(&frame_buffer[(uint32_t)(Row - fb_top) * sLCD_DIS.LCD_Dis_Column +
+                           Xpoint],
+             Bitmap, Width * sizeof(LCD_COLOR));
+      Bitmap += Width;
+    }
+    if (Callback) {
+      Callback(User_Data);
     }
+    return;
   }
+  LCD_SetWindows(Xpoint, Ypoint, Xpoint + Width, Ypoint + Height);
+  LCD_StartData_Buffer(Bitmap, (uint32_t)Width * Height, Callback, User_Data);
 }
 
 /********************************************************************************
-function:	Draw a rectangle
-parameter:
-                        Xstart ：Rectangular  Starting x point coordinates
-                        Ystart ：Rectangular  Starting x point coordinates
-                        Xend   ：Rectangular  End point x coordinate
-                        Yend   ：Rectangular  End point y coordinate
-                        Color  ：The color of the Rectangular segment
-                        Filled : Whether it is filled--- 1 solid 0：empty
+function:	Fill an area of the framebuffer, clipped to the canvas
 ********************************************************************************/
-void LCD_ST7735S::LCD_DrawRectangle(LCD_POINT Xstart, LCD_POINT Ystart,
-                                    LCD_POINT Xend, LCD_POINT Yend,
-                                    LCD_COLOR Color, DRAW_FILL Filled,
-                                    DOT_PIXEL Dot_Pixel) {
+void LCD_ST7735S::LCD_FB_Fill(LCD_POINT Xstart, LCD_POINT Ystart,
+                              LCD_POINT Xend, LCD_POINT Yend,
+                              LCD_COLOR Color) {
+  if (Xend > sLCD_DIS.LCD_Dis_Column) {
+    Xend = sLCD_DIS.LCD_Dis_Column;
+  }
+  if (Ystart < fb_top) {
+    Ystart = fb_top;
+  }
+  if (Yend > fb_bottom) {
+    Yend = fb_bottom;
+  }
+  if ((Xend <= Xstart) || (Yend <= Ystart)) {
+    return;
+  }
+  LCD_MarkDirty(Xstart, Ystart, Xend, Yend);
 
-  if (Xstart > sLCD_DIS.LCD_Dis_Column || Ystart > sLCD_DIS.LCD_Dis_Page ||
-      Xend > sLCD_DIS.LCD_Dis_Column || Yend > sLCD_DIS.LCD_Dis_Page) {
+  if (index_buffer) {
+    uint8_t Index = LCD_PaletteIndex(Color);
+    for (LCD_POINT Y = Ystart; Y < Yend; Y++) {
+      LCD_IndexFill(Xstart, Y, Xend, Index);
+    }
     return;
   }
 
-  if (Filled) {
-    LCD_SetArealColor(Xstart, Ystart, Xend, Yend, Color);
-  } else {
-    LCD_DrawLine(Xstart, Ystart, Xend, Ystart, Color, LINE_SOLID, Dot_Pixel);
-    LCD_DrawLine(Xstart, Ystart, Xstart, Yend, Color, LINE_SOLID, Dot_Pixel);
-    LCD_DrawLine(Xend, Yend, Xend, Ystart, Color, LINE_SOLID, Dot_Pixel);
-    LCD_DrawLine(Xend, Yend, Xstart, Yend, Color, LINE_SOLID, Dot_Pixel);
+  LCD_COLOR *Row = &frame_buffer[(uint32_t)(Ystart - fb_top) *
+                                     sLCD_DIS.LCD_Dis_Column +
+                                 Xstart];
+  for (LCD_POINT Y = Ystart; Y < Yend; Y++) {
+    for (LCD_POINT X = 0; X < Xend - Xstart; X++) {
+      Row[X] = Color;
+    }
+    Row += sLCD_DIS.LCD_Dis_Column;
   }
 }
 
 /********************************************************************************
-function:	Use the 8-point method to draw a circle of the
-                                specified size at the specified position.
+function:	Select the drawing target
 parameter:
-                        X_Center ：Center X coordinate
-                        Y_Center ：Center Y coordinate
-                        Radius   ：circle Radius
-                        Color  ：The color of the ：circle segment
-                        Filled : Whether it is filled: 1 filling 0：Do not
+                Buffer :   LCD_FRAMEBUFFER_SIZE pixels to render into, or
+                           nullptr to draw straight to the panel
+note:
+                In framebuffer mode every drawing primitive only writes RAM,
+                LCD_Flush pushes the canvas with a single window and burst.
+                The layout follows the scan direction set by LCD_Init.
 ********************************************************************************/
-void LCD_ST7735S::LCD_DrawCircle(LCD_POINT X_Center, LCD_POINT Y_Center,
-                                 LCD_LENGTH Radius, LCD_COLOR Color,
-                                 DRAW_FILL Draw_Fill, DOT_PIXEL Dot_Pixel) {
+void LCD_ST7735S::LCD_SetFramebuffer(LCD_COLOR *Buffer) {
+  LCD_Wait();
+  frame_buffer = Buffer;
+  index_buffer = nullptr;
+  fb_top = 0;
+  fb_bottom = sLCD_DIS.LCD_Dis_Page;
+  dirty_count = 0;
+  LCD_MarkDirty(0, 0, sLCD_DIS.LCD_Dis_Column, sLCD_DIS.LCD_Dis_Page);
+}
 
-  if (X_Center > sLCD_DIS.LCD_Dis_Column || Y_Center >= sLCD_DIS.LCD_Dis_Page) {
-    return;
+/********************************************************************************
+function:	Render into a strip of rows instead of the whole display
+parameter:
+                Buffer :   LCD_Dis_Column x Rows pixels
+                Ystart :   Display row of the first row of Buffer
+                Rows   :   Rows of Buffer
+note:
+                Drawing outside of the strip is clipped. The whole strip is
+                marked for the next flush. A flush of another buffer may
+                still be running, so the next strip can be drawn while the
+                last one is sent; only a strip that is on the bus is waited
+                for.
+********************************************************************************/
+void LCD_ST7735S::LCD_SetStrip(LCD_COLOR *Buffer, LCD_POINT Ystart,
+                               LCD_LENGTH Rows) {
+  if (flush_active && flush_buffer == Buffer) {
+    LCD_Wait();
   }
+  frame_buffer = Buffer;
+  index_buffer = nullptr;
+  fb_top = Ystart;
+  fb_bottom = Ystart + Rows;
+  dirty_count = 0;
+  LCD_MarkDirty(0, Ystart, sLCD_DIS.LCD_Dis_Column, Ystart + Rows);
+}
 
-  // Draw a circle from (0, R) as a starting point
-  int16_t XCurrent, YCurrent;
-  XCurrent = 0;
-  YCurrent = Radius;
-
-  // Cumulative error,judge the next point of the logo
-  int16_t Esp = 3 - (Radius << 1);
-
-  int16_t sCountY;
-  if (Draw_Fill) {
-    while (XCurrent <= YCurrent) { // Realistic circles
-      for (sCountY = XCurrent; sCountY <= YCurrent; sCountY++) {
-        LCD_SetPointlColor(X_Center + XCurrent, Y_Center + sCountY, Color); // 1
-        LCD_SetPointlColor(X_Center - XCurrent, Y_Center + sCountY, Color); // 2
-        LCD_SetPointlColor(X_Center - sCountY, Y_Center + XCurrent, Color); // 3
-        LCD_SetPointlColor(X_Center - sCountY, Y_Center - XCurrent, Color); // 4
-        LCD_SetPointlColor(X_Center - XCurrent, Y_Center - sCountY, Color); // 5
-        LCD_SetPointlColor(X_Center + XCurrent, Y_Center - sCountY, Color); // 6
-        LCD_SetPointlColor(X_Center + sCountY, Y_Center - XCurrent, Color); // 7
-        LCD_SetPointlColor(X_Center + sCountY, Y_Center + XCurrent, Color); // 0
-      }
-      if (Esp < 0)
-        Esp += 4 * XCurrent + 6;
-      else {
-        Esp += 10 + 4 * (XCurrent - YCurrent);
-        YCurrent--;
-      }
-      XCurrent++;
-    }
-  } else { // Draw a hollow circle
-    while (XCurrent <= YCurrent) {
-      LCD_DrawPoint(X_Center + XCurrent, Y_Center + YCurrent, Color, Dot_Pixel,
-                    DOT_STYLE_DFT); // 1
-      LCD_DrawPoint(X_Center - XCurrent, Y_Center + YCurrent, Color, Dot_Pixel,
-                    DOT_STYLE_DFT); // 2
-      LCD_DrawPoint(X_Center - YCurrent, Y_Center + XCurrent, Color, Dot_Pixel,
-                    DOT_STYLE_DFT); // 3
-      LCD_DrawPoint(X_Center - YCurrent, Y_Center - XCurrent, Color, Dot_Pixel,
-                    DOT_STYLE_DFT); // 4
-      LCD_DrawPoint(X_Center - XCurrent, Y_Center - YCurrent, Color, Dot_Pixel,
-                    DOT_STYLE_DFT); // 5
-      LCD_DrawPoint(X_Center + XCurrent, Y_Center - YCurrent, Color, Dot_Pixel,
-                    DOT_STYLE_DFT); // 6
-      LCD_DrawPoint(X_Center + YCurrent, Y_Center - XCurrent, Color, Dot_Pixel,
-                    DOT_STYLE_DFT); // 7
-      LCD_DrawPoint(X_Center + YCurrent, Y_Center + XCurrent, Color, Dot_Pixel,
-                    DOT_STYLE_DFT); // 0
-
-      if (Esp < 0)
-        Esp += 4 * XCurrent + 6;
-      else {
-        Esp += 10 + 4 * (XCurrent - YCurrent);
-        YCurrent--;
+/********************************************************************************
+function:	Swap a full framebuffer for another right after LCD_Flush_Async
+parameter:
+                Buffer :   LCD_FRAMEBUFFER_SIZE pixels, holding the canvas as
+                           it was before the changes being flushed
+note:
+                The regions of the flush are copied from the canvas, so
+                Buffer ends up equal to it and only the changes made from
+                now on are marked. The canvas is only read while its flush
+                runs; only a flush of Buffer itself is waited for.
+********************************************************************************/
+void LCD_ST7735S::LCD_SwapFramebuffer(LCD_COLOR *Buffer) {
+  if (flush_active && flush_buffer == Buffer) {
+    LCD_Wait();
+  }
+  // With nothing flushed from the canvas, Buffer is already equal to it
+  if (frame_buffer && flush_buffer == frame_buffer && Buffer != frame_buffer) {
+    for (uint8_t i = 0; i < flush_count; i++) {
+      const LCD_RECT *Rect = &flush_rect[i];
+      for (LCD_POINT Y = Rect->Ystart; Y < Rect->Yend; Y++) {
+        uint32_t Offset = (uint32_t)Y * sLCD_DIS.LCD_Dis_Column + Rect->Xstart;
+        memcpy(&Buffer[Offset], &frame_buffer[Offset],
+               (Rect->Xend - Rect->Xstart) * sizeof(LCD_COLOR));
       }
-      XCurrent++;
     }
   }
+  frame_buffer = Buffer;
+  index_buffer = nullptr;
+  fb_top = 0;
+  fb_bottom = sLCD_DIS.LCD_Dis_Page;
+  dirty_count = 0;
 }
 
+LCD_COLOR *LCD_ST7735S::LCD_GetFramebuffer(void) { return frame_buffer; }
+
 /********************************************************************************
-function:	Show English characters
+function:	Render into a framebuffer of palette indices
 parameter:
-                        Xpoint ：X coordinate
-                        Ypoint ：Y coordinate
-                        Acsii_Char   ：To display the English characters
-                        Font  ：A structure pointer that displays a character
-size Color_Background : Select the background color of the English character
-                        Color_Foreground : Select the foreground color of the
-English character
+                Buffer  :   LCD_INDEXED_SIZE(Bpp) bytes
+                Bpp     :   8 or 4 bits per pixel, two pixels a byte with the
+                            left one in the high nibble
+                Palette :   1 << Bpp RGB565 colors, kept by the caller
+                Colors  :   Entries of Palette already set
+note:
+                Drawing looks each color up in the palette. A color not
+                in it takes the next free entry, or the closest one once
+                the palette is full, which LCD_PaletteFull then reports.
+                LCD_Flush expands the dirty regions
+                a scanline at a time into text_line, one line filled while
+                the other is sent.
 ********************************************************************************/
-void LCD_ST7735S::LCD_DisplayChar(LCD_POINT Xpoint, LCD_POINT Ypoint,
-                                  const char Acsii_Char, sFONT *Font,
-                                  LCD_COLOR Color_Background,
-                                  LCD_COLOR Color_Foreground) {
-  LCD_POINT Page, Column;
+void LCD_ST7735S::LCD_SetIndexedFramebuffer(uint8_t *Buffer, uint8_t Bpp,
+                                            LCD_COLOR *Palette,
+                                            uint16_t Colors) {
+  LCD_Wait();
+  frame_buffer = nullptr;
+  index_buffer = Buffer;
+  index_bpp = Bpp == 4 ? 4 : 8;
+  palette = Palette;
+  palette_used = Colors;
+  palette_full = false;
+  index_cached = false;
+  fb_top = 0;
+  fb_bottom = sLCD_DIS.LCD_Dis_Page;
+  dirty_count = 0;
+  LCD_MarkDirty(0, 0, sLCD_DIS.LCD_Dis_Column, sLCD_DIS.LCD_Dis_Page);
+}
 
-  if (Xpoint >= sLCD_DIS.LCD_Dis_Column || Ypoint >= sLCD_DIS.LCD_Dis_Page) {
+uint8_t *LCD_ST7735S::LCD_GetIndexedFramebuffer(void) { return index_buffer; }
+
+bool LCD_ST7735S::LCD_PaletteFull(void) { return palette_full; }
+
+/********************************************************************************
+function:	Change a palette entry
+note:
+                The pixels of the entry are not redrawn, the whole canvas
+                is marked so the next flush shows them in the new color.
+********************************************************************************/
+void LCD_ST7735S::LCD_SetPalette(uint8_t Index, LCD_COLOR Color) {
+  if (!index_buffer || Index >= (1 << index_bpp)) {
     return;
   }
+  palette[Index] = Color;
+  if (Index >= palette_used) {
+    palette_used = Index + 1;
+  }
+  index_cached = false;
+  LCD_MarkDirty(0, 0, sLCD_DIS.LCD_Dis_Column, sLCD_DIS.LCD_Dis_Page);
+}
 
-  uint32_t Char_Offset = (Acsii_Char - ' ') * Font->Height *
-                         (Font->Width / 8 + (Font->Width % 8 ? 1 : 0));
-  const unsigned char *ptr = &Font->table[Char_Offset];
-
-  for (Page = 0; Page < Font->Height; Page++) {
-    for (Column = 0; Column < Font->Width; Column++) {
+/********************************************************************************
+function:	Palette entry of a color
+********************************************************************************/
+uint8_t LCD_ST7735S::LCD_PaletteIndex(LCD_COLOR Color) {
+  if (index_cached && index_color == Color) {
+    return index_last;
+  }
 
-      // To determine whether the font background color and screen background
-      // color is consistent
-      if (FONT_BACKGROUND ==
-          Color_Background) { // this process is to speed up the scan
-        if (*ptr & (0x80 >> (Column % 8)))
-          LCD_SetPointlColor(Xpoint + Column, Ypoint + Page, Color_Foreground);
-      } else {
-        if (*ptr & (0x80 >> (Column % 8))) {
-          LCD_SetPointlColor(Xpoint + Column, Ypoint + Page, Color_Foreground);
-        } else {
-          LCD_SetPointlColor(Xpoint + Column, Ypoint + Page, Color_Background);
-        }
-      }
-      // One pixel is 8 bits
-      if (Column % 8 == 7) {
-        ptr++;
-      }
-    } /* Write a line */
-    if (Font->Width % 8 != 0) {
-      ptr++;
+  // Closest entry, red and blue scaled to 6 bits like green
+  uint16_t Best = 0;
+  uint32_t Best_Distance = UINT32_MAX;
+  for (uint16_t i = 0; i < palette_used && Best_Distance; i++) {
+    int32_t R = ((palette[i] >> 11) - (Color >> 11)) * 2;
+    int32_t G = ((palette[i] >> 5) & 0x3F) - ((Color >> 5) & 0x3F);
+    int32_t B = ((palette[i] & 0x1F) - (Color & 0x1F)) * 2;
+    uint32_t Distance = R * R + G * G + B * B;
+    if (Distance < Best_Distance) {
+      Best = i;
+      Best_Distance = Distance;
     }
-  } /* Write all */
+  }
+  if (Best_Distance && palette_used < (1 << index_bpp)) {
+    Best = palette_used++;
+    palette[Best] = Color;
+  } else if (Best_Distance) {
+    palette_full = true;
+  }
+
+  index_cached = true;
+  index_color = Color;
+  index_last = Best;
+  return Best;
+}
+
+uint8_t *LCD_ST7735S::LCD_IndexRow(LCD_POINT Ypoint) {
+  return &index_buffer[(uint32_t)Ypoint * sLCD_DIS.LCD_Dis_Column *
+                       index_bpp / 8];
 }
 
 /********************************************************************************
-function:	Display the string
-parameter:
-                        Xstart ：X coordinate
-                        Ystart ：Y coordinate
-                        pString   ：The first address of the English string to
-be displayed Font  ：A structure pointer that displays a character size
-                        Color_Background : Select the background color of the
-English character Color_Foreground : Select the foreground color of the English
-character
+function:	Set the pixels [Xstart, Xend) of a row of the indexed canvas
 ********************************************************************************/
-void LCD_ST7735S::LCD_DisplayString(LCD_POINT Xstart, LCD_POINT Ystart,
-                                    const char *pString, sFONT *Font,
-                                    LCD_COLOR Color_Background,
-                                    LCD_COLOR Color_Foreground) {
-  LCD_POINT Xpoint = Xstart;
-  LCD_POINT Ypoint = Ystart;
-
-  if (Xstart >= sLCD_DIS.LCD_Dis_Column || Ystart >= sLCD_DIS.LCD_Dis_Page) {
+void LCD_ST7735S::LCD_IndexFill(LCD_POINT Xstart, LCD_POINT Ypoint,
+                                LCD_POINT Xend, uint8_t Index) {
+  uint8_t *Row = LCD_IndexRow(Ypoint);
+  if (index_bpp == 8) {
+    memset(&Row[Xstart], Index, Xend - Xstart);
     return;
   }
 
-  while (*pString != '\0') {
-    // if X direction filled , reposition to(Xstart,Ypoint),Ypoint is Y
-    // direction plus the height of the character
-    if ((Xpoint + Font->Width) > sLCD_DIS.LCD_Dis_Column) {
-      Xpoint = Xstart;
-      Ypoint += Font->Height;
-    }
+  LCD_POINT X = Xstart;
+  if ((X & 1) && X < Xend) {
+    Row[X / 2] = (Row[X / 2] & 0xF0) | Index;
+    X++;
+  }
+  LCD_POINT Pairs_End = Xend & ~1;
+  if (Pairs_End > X) {
+    memset(&Row[X / 2], Index * 0x11, (Pairs_End - X) / 2);
+    X = Pairs_End;
+  }
+  if (X < Xend) {
+    Row[X / 2] = (Row[X / 2] & 0x0F) | (Index << 4);
+  }
+}
 
-    // If the Y direction is full, reposition to (Xstart, Ystart)
-    if ((Ypoint + Font->Height) > sLCD_DIS.LCD_Dis_Page) {
-      Xpoint = Xstart;
+/********************************************************************************
+function:	Store a row of colors into the indexed canvas
+note:
+                The entries are written straight into the row, two a byte
+                in 4bpp; only a lone pixel at either end keeps the other
+                half of its byte.
+********************************************************************************/
+void LCD_ST7735S::LCD_IndexPack(LCD_POINT Xstart, LCD_POINT Ypoint,
+                                LCD_LENGTH Width, const LCD_COLOR *Colors) {
+  uint8_t *Row = LCD_IndexRow(Ypoint);
+  LCD_POINT X = Xstart;
+  LCD_POINT Xend = Xstart + Width;
+  if (index_bpp == 8) {
+    for (; X < Xend; X++) {
+      Row[X] = LCD_PaletteIndex(*Colors++);
+    }
+    return;
+  }
+
+  if ((X & 1) && X < Xend) {
+    Row[X / 2] = (Row[X / 2] & 0xF0) | LCD_PaletteIndex(*Colors++);
+    X++;
+  }
+  for (; X + 1 < Xend; X += 2) {
+    uint8_t Left = LCD_PaletteIndex(*Colors++);
+    Row[X / 2] = (Left << 4) | LCD_PaletteIndex(*Colors++);
+  }
+  if (X < Xend) {
+    Row[X / 2] = (Row[X / 2] & 0x0F) | (LCD_PaletteIndex(*Colors) << 4);
+  }
+}
+
+/********************************************************************************
+function:	Draw a glyph row into the indexed canvas
+note:
+                The row is split into runs of lit and unlit pixels, each
+                filled at once, so 4bpp pairs inside a run are set a byte
+                at a time.
+********************************************************************************/
+void LCD_ST7735S::LCD_IndexGlyph(LCD_POINT Xpoint, LCD_POINT Ypoint,
+                                 const uint8_t *Glyph, LCD_LENGTH Width,
+                                 uint8_t Foreground, uint8_t Background,
+                                 bool Opaque) {
+  LCD_LENGTH Column = 0;
+  while (Column < Width) {
+    bool Lit = Glyph[Column / 8] & (0x80 >> (Column % 8));
+    LCD_LENGTH Run_Start = Column;
+    while (Column < Width &&
+           (bool)(Glyph[Column / 8] & (0x80 >> (Column % 8))) == Lit) {
+      Column++;
+    }
+    if (Lit || Opaque) {
+      LCD_IndexFill(Xpoint + Run_Start, Ypoint, Xpoint + Column,
+                    Lit ? Foreground : Background);
+    }
+  }
+}
+
+/********************************************************************************
+function:	Colors of the pixels [Xstart, Xend) of a row of an indexed canvas
+********************************************************************************/
+void LCD_ST7735S::LCD_IndexExpand(const uint8_t *Indices, LCD_POINT Ypoint,
+                                  LCD_POINT Xstart, LCD_POINT Xend,
+                                  LCD_COLOR *Dst) {
+  const uint8_t *Row =
+      &Indices[(uint32_t)Ypoint * sLCD_DIS.LCD_Dis_Column * index_bpp / 8];
+  if (index_bpp == 8) {
+    for (LCD_POINT X = Xstart; X < Xend; X++) {
+      *Dst++ = palette[Row[X]];
+    }
+    return;
+  }
+  for (LCD_POINT X = Xstart; X < Xend; X++) {
+    *Dst++ = palette[X & 1 ? Row[X / 2] & 0x0F : Row[X / 2] >> 4];
+  }
+}
+
+/********************************************************************************
+function:	Send the changed regions of the framebuffer to the panel
+note:
+                Each region is sent with one LCD_SetWindows; full width
+                regions go out in a single burst, narrower ones row by row
+                from the DMA completion. The window of a region is a
+                blocking command write, so it is never sent from the
+                interrupt: a region after the first waits until LCD_Poll,
+                LCD_Busy or LCD_Wait is called.
+********************************************************************************/
+void LCD_ST7735S::LCD_Flush(void) {
+  LCD_Flush_Async();
+  LCD_Wait();
+}
+
+void LCD_ST7735S::LCD_Flush_Async(LCD_CALLBACK Callback, void *User_Data) {
+  LCD_Wait();
+  if ((!frame_buffer && !index_buffer) || dirty_count == 0) {
+    if (Callback) {
+      Callback(User_Data);
+    }
+    return;
+  }
+
+  // Drawing may continue while the flush runs, start a new dirty list
+  memcpy(flush_rect, dirty_rect, dirty_count * sizeof(LCD_RECT));
+  flush_count = dirty_count;
+  dirty_count = 0;
+
+  flush_index = 0;
+  flush_row = flush_rect[0].Ystart;
+  flush_buffer = frame_buffer;
+  flush_top = fb_top;
+  flush_indices = index_buffer;
+  flush_callback = Callback;
+  flush_callback_data = User_Data;
+  flush_active = true;
+  LCD_FlushNext(true);
+}
+
+void LCD_ST7735S::LCD_FlushCallback(void *User_Data) {
+  ((LCD_ST7735S *)User_Data)->LCD_FlushNext(false);
+}
+
+/********************************************************************************
+function:	Send the next burst of the flush
+parameter:
+                Thread :   Called from thread context, false from the DMA
+                           completion
+********************************************************************************/
+void LCD_ST7735S::LCD_FlushNext(bool Thread) {
+  while (flush_index < flush_count) {
+    const LCD_RECT *Rect = &flush_rect[flush_index];
+    if (flush_row == Rect->Ystart) {
+      if (!Thread) {
+        flush_window = true;
+        return;
+      }
+      LCD_SetWindows(Rect->Xstart, Rect->Ystart, Rect->Xend, Rect->Yend);
+      if (flush_indices) {
+        LCD_IndexExpand(flush_indices, flush_row, Rect->Xstart, Rect->Xend,
+                        text_line[flush_row & 1]);
+      }
+    }
+    if (flush_indices && flush_row < Rect->Yend) {
+      // Send the expanded row, then expand the next one while it goes out
+      const LCD_COLOR *Src = text_line[flush_row & 1];
+      flush_row++;
+      LCD_StartData_Buffer(Src, Rect->Xend - Rect->Xstart, LCD_FlushCallback,
+                           this);
+      if (flush_row < Rect->Yend) {
+        LCD_IndexExpand(flush_indices, flush_row, Rect->Xstart, Rect->Xend,
+                        text_line[flush_row & 1]);
+      }
+      return;
+    }
+    if (flush_row < Rect->Yend) {
+      // Rows of a full width region are contiguous in the framebuffer
+      LCD_LENGTH Width = Rect->Xend - Rect->Xstart;
+      LCD_LENGTH Rows =
+          Width == sLCD_DIS.LCD_Dis_Column ? Rect->Yend - flush_row : 1;
+      const LCD_COLOR *Src =
+          &flush_buffer[(uint32_t)(flush_row - flush_top) *
+                            sLCD_DIS.LCD_Dis_Column +
+                        Rect->Xstart];
+      flush_row += Rows;
+      LCD_StartData_Buffer(Src, (uint32_t)Width * Rows, LCD_FlushCallback,
+                           this);
+      return;
+    }
+    flush_index++;
+    if (flush_index < flush_count) {
+      flush_row = flush_rect[flush_index].Ystart;
+    }
+  }
+
+  LCD_CALLBACK Callback = flush_callback;
+  void *User_Data = flush_callback_data;
+  flush_callback = nullptr;
+  flush_callback_data = nullptr;
+  flush_active = false;
+  if (Callback) {
+    Callback(User_Data);
+  }
+}
+
+/********************************************************************************
+function:	Cost of sending a region, in bytes on the bus
+********************************************************************************/
+static uint32_t LCD_RectCost(const LCD_RECT *Rect) {
+  uint32_t Width = Rect->Xend - Rect->Xstart;
+  uint32_t Height = Rect->Yend - Rect->Ystart;
+  uint32_t Cost = LCD_DIRTY_WINDOW_COST + 2 * Width * Height;
+  if (Width != sLCD_DIS.LCD_Dis_Column) {
+    Cost += LCD_DIRTY_ROW_COST * Height;
+  }
+  return Cost;
+}
+
+static LCD_RECT LCD_RectUnion(const LCD_RECT *A, const LCD_RECT *B) {
+  LCD_RECT Rect;
+  Rect.Xstart = A->Xstart < B->Xstart ? A->Xstart : B->Xstart;
+  Rect.Ystart = A->Ystart < B->Ystart ? A->Ystart : B->Ystart;
+  Rect.Xend = A->Xend > B->Xend ? A->Xend : B->Xend;
+  Rect.Yend = A->Yend > B->Yend ? A->Yend : B->Yend;
+  return Rect;
+}
+
+/********************************************************************************
+function:	Mark an area of the framebuffer as changed
+parameter:
+                Xstart :   Start point x coordinate
+                Ystart :   Start point y coordinate
+                Xend   :   End point x coordinate (exclusive)
+                Yend   :   End point y coordinate (exclusive)
+note:
+                The area is merged with a tracked region whenever sending the
+                union costs less than paying a second window setup. When all
+                LCD_DIRTY_RECTS regions are in use, it is merged with the one
+                whose union grows the least.
+********************************************************************************/
+void LCD_ST7735S::LCD_MarkDirty(LCD_POINT Xstart, LCD_POINT Ystart,
+                                LCD_POINT Xend, LCD_POINT Yend) {
+  if (!frame_buffer && !index_buffer) {
+    return;
+  }
+  if (Xend > sLCD_DIS.LCD_Dis_Column) {
+    Xend = sLCD_DIS.LCD_Dis_Column;
+  }
+  if (Ystart < fb_top) {
+    Ystart = fb_top;
+  }
+  if (Yend > fb_bottom) {
+    Yend = fb_bottom;
+  }
+  if ((Xend <= Xstart) || (Yend <= Ystart)) {
+    return;
+  }
+
+  // Already covered, the common case for pixels of a marked primitive
+  uint8_t i;
+  for (i = 0; i < dirty_count; i++) {
+    if (dirty_rect[i].Xstart <= Xstart && dirty_rect[i].Ystart <= Ystart &&
+        dirty_rect[i].Xend >= Xend && dirty_rect[i].Yend >= Yend) {
+      return;
+    }
+  }
+
+  LCD_RECT Rect = {Xstart, Ystart, Xend, Yend};
+  bool Merged = true;
+  while (Merged) {
+    Merged = false;
+    uint8_t Best = dirty_count;
+    uint32_t Best_Growth = UINT32_MAX;
+    for (i = 0; i < dirty_count; i++) {
+      LCD_RECT Union = LCD_RectUnion(&Rect, &dirty_rect[i]);
+      uint32_t Union_Cost = LCD_RectCost(&Union);
+      uint32_t Split_Cost = LCD_RectCost(&Rect) + LCD_RectCost(&dirty_rect[i]);
+      if (Union_Cost <= Split_Cost) {
+        Best = i;
+        break;
+      }
+      if (dirty_count == LCD_DIRTY_RECTS &&
+          Union_Cost - Split_Cost < Best_Growth) {
+        Best = i;
+        Best_Growth = Union_Cost - Split_Cost;
+      }
+    }
+    if (Best < dirty_count) {
+      Rect = LCD_RectUnion(&Rect, &dirty_rect[Best]);
+      dirty_rect[Best] = dirty_rect[--dirty_count];
+      Merged = true;
+    }
+  }
+  dirty_rect[dirty_count++] = Rect;
+}
+
+/********************************************************************************
+function:	Mark an area given in signed coordinates, clipped at 0
+********************************************************************************/
+void LCD_ST7735S::LCD_MarkDirtyArea(int32_t Xstart, int32_t Ystart,
+                                    int32_t Xend, int32_t Yend) {
+  if ((!frame_buffer && !index_buffer) || Xend <= 0 || Yend <= 0) {
+    return;
+  }
+  LCD_MarkDirty(Xstart < 0 ? 0 : Xstart, Ystart < 0 ? 0 : Ystart,
+                Xend > UINT16_MAX ? UINT16_MAX : Xend,
+                Yend > UINT16_MAX ? UINT16_MAX : Yend);
+}
+
+/********************************************************************************
+function:	Whether a pixel transfer is still running
+********************************************************************************/
+bool LCD_ST7735S::LCD_Busy(void) {
+  LCD_Poll();
+  return transport->Busy() || flush_active;
+}
+
+/********************************************************************************
+function:	Block until the running pixel transfer has completed
+********************************************************************************/
+void LCD_ST7735S::LCD_Wait(void) {
+  // The flush chain starts its next burst from the completion of the last
+  do {
+    transport->Wait();
+    LCD_Poll();
+  } while (flush_active);
+}
+
+/********************************************************************************
+function:	Send the window of the next region of a flush, if it waits
+********************************************************************************/
+void LCD_ST7735S::LCD_Poll(void) {
+  if (flush_window) {
+    flush_window = false;
+    LCD_FlushNext(true);
+  }
+}
+
+/********************************************************************************
+function:	Fill an area given in signed coordinates, clipped to the display
+parameter:
+                Xstart :   Start point x coordinate
+                Ystart :   Start point y coordinate
+                Xend   :   End point x coordinate (exclusive)
+                Yend   :   End point y coordinate (exclusive)
+                Color  :   Set the color
+********************************************************************************/
+void LCD_ST7735S::LCD_FillClipped(int32_t Xstart, int32_t Ystart, int32_t Xend,
+                                  int32_t Yend, LCD_COLOR Color) {
+  if (Xstart < 0) {
+    Xstart = 0;
+  }
+  if (Ystart < 0) {
+    Ystart = 0;
+  }
+  if (Xend > sLCD_DIS.LCD_Dis_Column) {
+    Xend = sLCD_DIS.LCD_Dis_Column;
+  }
+  if (Yend > sLCD_DIS.LCD_Dis_Page) {
+    Yend = sLCD_DIS.LCD_Dis_Page;
+  }
+  if ((Xend > Xstart) && (Yend > Ystart)) {
+    LCD_SetArealColor(Xstart, Ystart, Xend, Yend, Color);
+  }
+}
+
+/********************************************************************************
+function:	Collect spans and fill them, merged across scanlines
+parameter:
+                Vertical :   Scanlines are columns instead of rows
+                Line     :   Row (or column) of the span
+                Start    :   First pixel of the span
+                End      :   End of the span (exclusive)
+note:
+                Spans of adjacent scanlines covering the same pixels are sent
+                as one rectangle. Scanlines may come in either order.
+********************************************************************************/
+void LCD_ST7735S::LCD_SpanBegin(bool Vertical, LCD_COLOR Color) {
+  span_vertical = Vertical;
+  span_color = Color;
+  span_open = false;
+}
+
+void LCD_ST7735S::LCD_Span(int32_t Line, int32_t Start, int32_t End) {
+  if (span_open && Start == span_start && End == span_end) {
+    if (Line == span_line_end) {
+      span_line_end++;
+      return;
+    }
+    if (Line == span_line_start - 1) {
+      span_line_start--;
+      return;
+    }
+  }
+  LCD_SpanEnd();
+  span_open = true;
+  span_line_start = Line;
+  span_line_end = Line + 1;
+  span_start = Start;
+  span_end = End;
+}
+
+void LCD_ST7735S::LCD_SpanEnd(void) {
+  if (!span_open) {
+    return;
+  }
+  span_open = false;
+  if (span_vertical) {
+    LCD_FillClipped(span_line_start, span_start, span_line_end, span_end,
+                    span_color);
+  } else {
+    LCD_FillClipped(span_start, span_line_start, span_end, span_line_end,
+                    span_color);
+  }
+}
+
+/********************************************************************************
+function:	Draw Point (Xpoint, Ypoint) Fill the color
+parameter:
+                        Xpoint		:   The x coordinate of the point
+                        Ypoint		:   The y coordinate of the point
+                        Color		:   Set color
+                        Dot_Pixel	:	point size
+note:
+                The point is a square, sent as a single fill.
+                DOT_FILL_AROUND covers [Xpoint - Dot_Pixel, Xpoint +
+                Dot_Pixel - 2], DOT_FILL_RIGHTUP [Xpoint - 1, Xpoint +
+                Dot_Pixel - 2], likewise in y.
+********************************************************************************/
+void LCD_ST7735S::LCD_DrawPoint(LCD_POINT Xpoint, LCD_POINT Ypoint,
+                                LCD_COLOR Color, DOT_PIXEL Dot_Pixel,
+                                DOT_STYLE DOT_STYLE) {
+
+  if (Xpoint > sLCD_DIS.LCD_Dis_Column || Ypoint > sLCD_DIS.LCD_Dis_Page) {
+    return;
+  }
+
+  if (DOT_STYLE == DOT_FILL_AROUND) {
+    LCD_FillClipped((int32_t)Xpoint - Dot_Pixel, (int32_t)Ypoint - Dot_Pixel,
+                    Xpoint + Dot_Pixel - 1, Ypoint + Dot_Pixel - 1, Color);
+  } else {
+    LCD_FillClipped((int32_t)Xpoint - 1, (int32_t)Ypoint - 1,
+                    Xpoint + Dot_Pixel - 1, Ypoint + Dot_Pixel - 1, Color);
+  }
+}
+
+/********************************************************************************
+function:	Draw a line of arbitrary slope
+parameter:
+                        Xstart ：Starting x point coordinates
+                        Ystart ：Starting x point coordinates
+                        Xend   ：End point x coordinate
+                        Yend   ：End point y coordinate
+                        Color  ：The color of the line segment
+note:
+                A solid line covers the same pixels as a LCD_DrawPoint on
+                every Bresenham step, but is sent as spans: rows for a
+                shallow line, columns for a steep one. The steps sharing a
+                scanline form a run; a span is the union of the runs within
+                reach of the square, so a thin line costs one fill per run
+                and a thick one a swept band without overdraw. Spans that
+                line up (axis aligned lines) merge into a single fill.
+                Dotted lines keep drawing point by point, their background
+                points overwrite the previous ones.
+********************************************************************************/
+void LCD_ST7735S::LCD_DrawLine(LCD_POINT Xstart, LCD_POINT Ystart,
+                               LCD_POINT Xend, LCD_POINT Yend, LCD_COLOR Color,
+                               LINE_STYLE Line_Style, DOT_PIXEL Dot_Pixel) {
+
+  if (Xstart > sLCD_DIS.LCD_Dis_Column || Ystart > sLCD_DIS.LCD_Dis_Page ||
+      Xend > sLCD_DIS.LCD_Dis_Column || Yend > sLCD_DIS.LCD_Dis_Page) {
+    return;
+  }
+
+  // Every point is a square of Dot_Pixel, see LCD_DrawPoint
+  LCD_MarkDirtyArea((Xstart < Xend ? Xstart : Xend) - Dot_Pixel,
+                    (Ystart < Yend ? Ystart : Yend) - Dot_Pixel,
+                    (Xstart > Xend ? Xstart : Xend) + Dot_Pixel - 1,
+                    (Ystart > Yend ? Ystart : Yend) + Dot_Pixel - 1);
+
+  LCD_POINT Xpoint = Xstart;
+  LCD_POINT Ypoint = Ystart;
+  int32_t dx =
+      (int32_t)Xend - (int32_t)Xstart >= 0 ? Xend - Xstart : Xstart - Xend;
+  int32_t dy =
+      (int32_t)Yend - (int32_t)Ystart <= 0 ? Yend - Ystart : Ystart - Yend;
+
+  // Increment direction, 1 is positive, -1 is counter;
+  int32_t XAddway = Xstart < Xend ? 1 : -1;
+  int32_t YAddway = Ystart < Yend ? 1 : -1;
+
+  // Cumulative error
+  int32_t Esp = dx + dy;
+  int8_t Line_Style_Temp = 0;
+
+  if (Line_Style == LINE_DOTTED) {
+    for (;;) {
+      Line_Style_Temp++;
+      // Painted dotted line, 2 point is really virtual
+      if (Line_Style_Temp % 3 == 0) {
+        LCD_DrawPoint(Xpoint, Ypoint, LCD_BACKGROUND, Dot_Pixel,
+                      DOT_STYLE_DFT);
+        Line_Style_Temp = 0;
+      } else {
+        LCD_DrawPoint(Xpoint, Ypoint, Color, Dot_Pixel, DOT_STYLE_DFT);
+      }
+      if (2 * Esp >= dy) {
+        if (Xpoint == Xend)
+          break;
+        Esp += dy;
+        Xpoint += XAddway;
+      }
+      if (2 * Esp <= dx) {
+        if (Ypoint == Yend)
+          break;
+        Esp += dx;
+        Ypoint += YAddway;
+      }
+    }
+    return;
+  }
+
+  // Scanlines are rows of a shallow line, columns of a steep one; the runs
+  // advance by one scanline at a time in the direction Step
+  bool Vertical = -dy > dx;
+  int32_t Step = Vertical ? XAddway : YAddway;
+
+  // The square of a point spans [Line + Near, Line + Far] across scanlines
+  const int32_t Near = -(int32_t)Dot_Pixel;
+  const int32_t Far = Dot_Pixel - 2;
+  const int32_t Reach = 2 * Dot_Pixel - 1;
+
+  // The last Reach runs, a span needs exactly those
+  struct {
+    int32_t Line;
+    int32_t Start;
+    int32_t End;
+  } Run[2 * DOT_PIXEL_8X8 - 1];
+  int32_t Runs = 0;
+  int32_t Run_Line = Vertical ? Xpoint : Ypoint;
+  int32_t Run_Start = Vertical ? Ypoint : Xpoint;
+  int32_t Run_End = Run_Start;
+  int32_t Next_Span = Run_Line + (Step > 0 ? Near : Far);
+
+  LCD_SpanBegin(Vertical, Color);
+  for (;;) {
+    bool Done = false;
+    if (2 * Esp >= dy) {
+      if (Xpoint == Xend) {
+        Done = true;
+      } else {
+        Esp += dy;
+        Xpoint += XAddway;
+      }
+    }
+    if (!Done && 2 * Esp <= dx) {
+      if (Ypoint == Yend) {
+        Done = true;
+      } else {
+        Esp += dx;
+        Ypoint += YAddway;
+      }
+    }
+
+    int32_t Line = Vertical ? Xpoint : Ypoint;
+    int32_t Pos = Vertical ? Ypoint : Xpoint;
+    if (!Done && Line == Run_Line) {
+      Run_Start = Pos < Run_Start ? Pos : Run_Start;
+      Run_End = Pos > Run_End ? Pos : Run_End;
+      continue;
+    }
+
+    // The run is complete, emit the scanlines it completes
+    Run[Runs % Reach].Line = Run_Line;
+    Run[Runs % Reach].Start = Run_Start;
+    Run[Runs % Reach].End = Run_End;
+    Runs++;
+    int32_t Last_Span = Run_Line + (Step > 0 ? Near : Far);
+    if (Done) {
+      Last_Span = Run_Line + (Step > 0 ? Far : Near);
+    }
+    for (;; Next_Span += Step) {
+      int32_t Start = INT32_MAX, End = INT32_MIN;
+      for (int32_t i = 0; i < Runs && i < Reach; i++) {
+        if (Run[i].Line >= Next_Span - Far && Run[i].Line <= Next_Span - Near) {
+          Start = Run[i].Start < Start ? Run[i].Start : Start;
+          End = Run[i].End > End ? Run[i].End : End;
+        }
+      }
+      LCD_Span(Next_Span, Start + Near, End + Far + 1);
+      if (Next_Span == Last_Span) {
+        Next_Span += Step;
+        break;
+      }
+    }
+    if (Done) {
+      break;
+    }
+    Run_Line = Line;
+    Run_Start = Pos;
+    Run_End = Pos;
+  }
+  LCD_SpanEnd();
+}
+
+/********************************************************************************
+function:	Draw a rectangle
+parameter:
+                        Xstart ：Rectangular  Starting x point coordinates
+                        Ystart ：Rectangular  Starting x point coordinates
+                        Xend   ：Rectangular  End point x coordinate
+                        Yend   ：Rectangular  End point y coordinate
+                        Color  ：The color of the Rectangular segment
+                        Filled : Whether it is filled--- 1 solid 0：empty
+note:
+                The outline covers the same pixels as lines between the
+                corners, a band of LCD_DrawPoint squares along each edge. It
+                is sent as four fills: top and bottom across the full width,
+                left and right in between.
+********************************************************************************/
+void LCD_ST7735S::LCD_DrawRectangle(LCD_POINT Xstart, LCD_POINT Ystart,
+                                    LCD_POINT Xend, LCD_POINT Yend,
+                                    LCD_COLOR Color, DRAW_FILL Filled,
+                                    DOT_PIXEL Dot_Pixel) {
+
+  if (Xstart > sLCD_DIS.LCD_Dis_Column || Ystart > sLCD_DIS.LCD_Dis_Page ||
+      Xend > sLCD_DIS.LCD_Dis_Column || Yend > sLCD_DIS.LCD_Dis_Page) {
+    return;
+  }
+
+  if (Filled) {
+    LCD_SetArealColor(Xstart, Ystart, Xend, Yend, Color);
+    return;
+  }
+
+  int32_t X0 = Xstart < Xend ? Xstart : Xend;
+  int32_t X1 = Xstart < Xend ? Xend : Xstart;
+  int32_t Y0 = Ystart < Yend ? Ystart : Yend;
+  int32_t Y1 = Ystart < Yend ? Yend : Ystart;
+
+  // Edges are [Edge + Near, Edge + Far] thick, see LCD_DrawPoint
+  const int32_t Near = -(int32_t)Dot_Pixel;
+  const int32_t Far = Dot_Pixel - 2;
+
+  // Only the pixels not covered by an earlier band
+  int32_t Top_End = Y0 + Far + 1;
+  int32_t Bottom_Start = Y1 + Near > Top_End ? Y1 + Near : Top_End;
+  int32_t Left_End = X0 + Far + 1;
+  int32_t Right_Start = X1 + Near > Left_End ? X1 + Near : Left_End;
+
+  LCD_MarkDirtyArea(X0 + Near, Y0 + Near, X1 + Far + 1, Y1 + Far + 1);
+  LCD_FillClipped(X0 + Near, Y0 + Near, X1 + Far + 1, Top_End, Color);
+  LCD_FillClipped(X0 + Near, Bottom_Start, X1 + Far + 1, Y1 + Far + 1, Color);
+  LCD_FillClipped(X0 + Near, Top_End, Left_End, Y1 + Near, Color);
+  LCD_FillClipped(Right_Start, Top_End, X1 + Far + 1, Y1 + Near, Color);
+}
+
+/********************************************************************************
+function:	Draw a rectangle with rounded corners
+parameter:
+                        Xstart ：Rectangular  Starting x point coordinates
+                        Ystart ：Rectangular  Starting x point coordinates
+                        Xend   ：Rectangular  End point x coordinate
+                        Yend   ：Rectangular  End point y coordinate
+                        Radius ：Corner radius
+                        Color  ：The color of the Rectangular segment
+                        Filled : Whether it is filled--- 1 solid 0：empty
+note:
+                Same extent as LCD_DrawRectangle: the outline runs through
+                the corners, the filled area ends before Xend and Yend. The
+                corners are quarters of LCD_DrawCircle, every row is sent
+                as spans.
+********************************************************************************/
+void LCD_ST7735S::LCD_DrawRoundRectangle(LCD_POINT Xstart, LCD_POINT Ystart,
+                                         LCD_POINT Xend, LCD_POINT Yend,
+                                         LCD_LENGTH Radius, LCD_COLOR Color,
+                                         DRAW_FILL Filled,
+                                         DOT_PIXEL Dot_Pixel) {
+
+  if (Xstart > sLCD_DIS.LCD_Dis_Column || Ystart > sLCD_DIS.LCD_Dis_Page ||
+      Xend > sLCD_DIS.LCD_Dis_Column || Yend > sLCD_DIS.LCD_Dis_Page) {
+    return;
+  }
+
+  int32_t X0 = Xstart < Xend ? Xstart : Xend;
+  int32_t X1 = Xstart < Xend ? Xend : Xstart;
+  int32_t Y0 = Ystart < Yend ? Ystart : Yend;
+  int32_t Y1 = Ystart < Yend ? Yend : Ystart;
+  if (Filled) {
+    if (X1 == X0 || Y1 == Y0) {
+      return;
+    }
+    X1--;
+    Y1--;
+  }
+
+  // The corners may not overlap
+  int32_t Max_Radius = (X1 - X0 < Y1 - Y0 ? X1 - X0 : Y1 - Y0) / 2;
+  if (Radius > Max_Radius) {
+    Radius = Max_Radius;
+  }
+
+  if (!Filled) {
+    LCD_MarkDirtyArea(X0 - Dot_Pixel, Y0 - Dot_Pixel, X1 + Dot_Pixel - 1,
+                      Y1 + Dot_Pixel - 1);
+  }
+
+  // Quarter circle, see LCD_DrawCircle
+  int16_t XCurrent = 0;
+  int16_t YCurrent = Radius;
+  int16_t Esp = 3 - (Radius << 1);
+  LCD_CurveBegin(Radius);
+  while (XCurrent <= YCurrent) {
+    LCD_CurvePoint(XCurrent, YCurrent);
+    LCD_CurvePoint(YCurrent, XCurrent);
+    if (Esp < 0)
+      Esp += 4 * XCurrent + 6;
+    else {
+      Esp += 10 + 4 * (XCurrent - YCurrent);
+      YCurrent--;
+    }
+    XCurrent++;
+  }
+  LCD_CurveDraw(X0 + Radius, Y0 + Radius, X1 - Radius, Y1 - Radius, Color,
+                Filled, Dot_Pixel);
+}
+
+/********************************************************************************
+function:	Draw a filled rectangle with a border
+parameter:
+                        Xstart       ：Starting x point coordinates
+                        Ystart       ：Starting y point coordinates
+                        Xend         ：End point x coordinate (exclusive)
+                        Yend         ：End point y coordinate (exclusive)
+                        Color        ：Inner color
+                        Border_Color ：Border color
+                        Dot_Pixel    ：Border width
+note:
+                The border lies inside the area, five fills without overlap.
+********************************************************************************/
+void LCD_ST7735S::LCD_DrawBorderedRectangle(LCD_POINT Xstart, LCD_POINT Ystart,
+                                            LCD_POINT Xend, LCD_POINT Yend,
+                                            LCD_COLOR Color,
+                                            LCD_COLOR Border_Color,
+                                            DOT_PIXEL Dot_Pixel) {
+  if ((Xend <= Xstart) || (Yend <= Ystart)) {
+    return;
+  }
+
+  int32_t Border = Dot_Pixel;
+  int32_t Top_End = Ystart + Border < Yend ? Ystart + Border : Yend;
+  int32_t Bottom_Start = Yend - Border > Top_End ? Yend - Border : Top_End;
+  int32_t Left_End = Xstart + Border < Xend ? Xstart + Border : Xend;
+  int32_t Right_Start = Xend - Border > Left_End ? Xend - Border : Left_End;
+
+  LCD_FillClipped(Xstart, Ystart, Xend, Top_End, Border_Color);
+  LCD_FillClipped(Xstart, Top_End, Left_End, Bottom_Start, Border_Color);
+  LCD_FillClipped(Left_End, Top_End, Right_Start, Bottom_Start, Color);
+  LCD_FillClipped(Right_Start, Top_End, Xend, Bottom_Start, Border_Color);
+  LCD_FillClipped(Xstart, Bottom_Start, Xend, Yend, Border_Color);
+}
+
+/********************************************************************************
+function:	Use the 8-point method to draw a circle of the
+                                specified size at the specified position.
+parameter:
+                        X_Center ：Center X coordinate
+                        Y_Center ：Center Y coordinate
+                        Radius   ：circle Radius
+                        Color  ：The color of the ：circle segment
+                        Filled : Whether it is filled: 1 filling 0：Do not
+note:
+                The 8-point walk only collects the pixels of each row, the
+                circle is sent as spans, see LCD_CurveDraw. The squares of
+                an outline are clipped to the display, also those centered
+                off it.
+********************************************************************************/
+void LCD_ST7735S::LCD_DrawCircle(LCD_POINT X_Center, LCD_POINT Y_Center,
+                                 LCD_LENGTH Radius, LCD_COLOR Color,
+                                 DRAW_FILL Draw_Fill, DOT_PIXEL Dot_Pixel) {
+
+  if (X_Center > sLCD_DIS.LCD_Dis_Column || Y_Center >= sLCD_DIS.LCD_Dis_Page) {
+    return;
+  }
+
+  if (Draw_Fill) {
+    LCD_MarkDirtyArea((int32_t)X_Center - Radius, (int32_t)Y_Center - Radius,
+                      X_Center + Radius + 1, Y_Center + Radius + 1);
+  } else {
+    LCD_MarkDirtyArea((int32_t)X_Center - Radius - Dot_Pixel,
+                      (int32_t)Y_Center - Radius - Dot_Pixel,
+                      X_Center + Radius + Dot_Pixel - 1,
+                      Y_Center + Radius + Dot_Pixel - 1);
+  }
+
+  // Draw a circle from (0, R) as a starting point
+  int16_t XCurrent, YCurrent;
+  XCurrent = 0;
+  YCurrent = Radius;
+
+  // Cumulative error,judge the next point of the logo
+  int16_t Esp = 3 - (Radius << 1);
+
+  LCD_CurveBegin(Radius);
+  while (XCurrent <= YCurrent) {
+    // One octant, the other is its mirror image on the diagonal
+    LCD_CurvePoint(XCurrent, YCurrent);
+    LCD_CurvePoint(YCurrent, XCurrent);
+
+    if (Esp < 0)
+      Esp += 4 * XCurrent + 6;
+    else {
+      Esp += 10 + 4 * (XCurrent - YCurrent);
+      YCurrent--;
+    }
+    XCurrent++;
+  }
+  LCD_CurveDraw(X_Center, Y_Center, X_Center, Y_Center, Color, Draw_Fill,
+                Dot_Pixel);
+}
+
+/********************************************************************************
+function:	Draw an ellipse
+parameter:
+                        X_Center ：Center X coordinate
+                        Y_Center ：Center Y coordinate
+                        X_Radius ：Horizontal radius
+                        Y_Radius ：Vertical radius
+                        Color    ：The color of the ellipse
+                        Filled   : Whether it is filled: 1 filling 0：Do not
+                        Dot_Pixel：Outline width
+note:
+                Midpoint algorithm, sent as spans like LCD_DrawCircle.
+********************************************************************************/
+void LCD_ST7735S::LCD_DrawEllipse(LCD_POINT X_Center, LCD_POINT Y_Center,
+                                  LCD_LENGTH X_Radius, LCD_LENGTH Y_Radius,
+                                  LCD_COLOR Color, DRAW_FILL Draw_Fill,
+                                  DOT_PIXEL Dot_Pixel) {
+
+  if (X_Center > sLCD_DIS.LCD_Dis_Column || Y_Center >= sLCD_DIS.LCD_Dis_Page) {
+    return;
+  }
+
+  int64_t Rx2 = (int64_t)X_Radius * X_Radius;
+  int64_t Ry2 = (int64_t)Y_Radius * Y_Radius;
+  int32_t X = 0, Y = Y_Radius;
+  int64_t Px = 0, Py = 2 * Rx2 * Y;
+
+  LCD_CurveBegin(Y_Radius);
+
+  // Region 1, slope above -1. The decision variables are scaled by 4
+  int64_t P = 4 * Ry2 - 4 * Rx2 * Y_Radius + Rx2;
+  while (Px < Py) {
+    LCD_CurvePoint(X, Y);
+    X++;
+    Px += 2 * Ry2;
+    if (P < 0) {
+      P += 4 * (Ry2 + Px);
+    } else {
+      Y--;
+      Py -= 2 * Rx2;
+      P += 4 * (Ry2 + Px - Py);
+    }
+  }
+
+  // Region 2, down to the horizontal axis
+  P = Ry2 * (4 * (int64_t)X * X + 4 * X + 1) +
+      4 * Rx2 * ((int64_t)(Y - 1) * (Y - 1)) - 4 * Rx2 * Ry2;
+  while (Y >= 0) {
+    LCD_CurvePoint(X, Y);
+    Y--;
+    Py -= 2 * Rx2;
+    if (P > 0) {
+      P += 4 * (Rx2 - Py);
+    } else {
+      X++;
+      Px += 2 * Ry2;
+      P += 4 * (Rx2 - Py + Px);
+    }
+  }
+  // A flat ellipse never leaves the first region
+  LCD_CurvePoint(X_Radius, 0);
+
+  LCD_CurveDraw(X_Center, Y_Center, X_Center, Y_Center, Color, Draw_Fill,
+                Dot_Pixel);
+}
+
+/********************************************************************************
+function:	Start collecting the quadrant of a curve
+parameter:
+                Radius :   Distance of the farthest row from the center
+********************************************************************************/
+void LCD_ST7735S::LCD_CurveBegin(LCD_LENGTH Radius) {
+  curve_rows = Radius < LCD_CURVE_ROWS ? Radius + 1 : LCD_CURVE_ROWS;
+  for (LCD_LENGTH Row = 0; Row < curve_rows; Row++) {
+    curve_lo[Row] = UINT16_MAX;
+    curve_hi[Row] = 0;
+  }
+}
+
+/********************************************************************************
+function:	Add a pixel of the quadrant
+parameter:
+                X   :   Distance from the center column
+                Row :   Distance from the center row
+********************************************************************************/
+void LCD_ST7735S::LCD_CurvePoint(int32_t X, int32_t Row) {
+  if (Row < 0 || Row >= curve_rows) {
+    return;
+  }
+  if (X < curve_lo[Row]) {
+    curve_lo[Row] = X;
+  }
+  if (X > curve_hi[Row]) {
+    curve_hi[Row] = X;
+  }
+}
+
+/********************************************************************************
+function:	Send the collected curve mirrored to all four quadrants
+parameter:
+                X_Left, Y_Top     :   Center of the upper left quadrant
+                X_Right, Y_Bottom :   Center of the lower right quadrant
+note:
+                The quadrants are pulled apart to the four centers, the rows
+                and columns in between repeat the axis of the curve (rounded
+                rectangles); a circle has all four centers in one point.
+                Filled, each row is one span out to the outermost pixel.
+                Outlined, every pixel stands for a LCD_DrawPoint square; on
+                a row, the squares of the rows within reach form one span
+                on each side, or a single one where both sides meet. The
+                left sides are sent first, then the right ones, so that the
+                spans of adjacent rows can merge.
+********************************************************************************/
+void LCD_ST7735S::LCD_CurveDraw(int32_t X_Left, int32_t Y_Top,
+                                int32_t X_Right, int32_t Y_Bottom,
+                                LCD_COLOR Color, DRAW_FILL Draw_Fill,
+                                DOT_PIXEL Dot_Pixel) {
+  int32_t Rows = curve_rows;
+
+  if (Draw_Fill) {
+    LCD_SpanBegin(false, Color);
+    for (int32_t Y = Y_Top - Rows + 1; Y < Y_Bottom + Rows; Y++) {
+      if (Y < 0 || Y >= sLCD_DIS.LCD_Dis_Page) {
+        continue;
+      }
+      int32_t Row = Y < Y_Top ? Y_Top - Y : (Y > Y_Bottom ? Y - Y_Bottom : 0);
+      int32_t Hi = curve_hi[Row];
+      LCD_Span(Y, X_Left - Hi, X_Right + Hi + 1);
+    }
+    LCD_SpanEnd();
+    return;
+  }
+
+  // The square of a pixel spans [Row + Near, Row + Far], see LCD_DrawPoint
+  const int32_t Near = -(int32_t)Dot_Pixel;
+  const int32_t Far = Dot_Pixel - 2;
+
+  for (int Side = 0; Side < 2; Side++) {
+    LCD_SpanBegin(false, Color);
+    for (int32_t Y = Y_Top - Rows + 1 + Near; Y < Y_Bottom + Rows + Far;
+         Y++) {
+      if (Y < 0 || Y >= sLCD_DIS.LCD_Dis_Page) {
+        continue;
+      }
+
+      // Pixels within reach lie on rows Y - Far .. Y - Near
+      int32_t Lo = INT32_MAX, Hi = -1;
+      bool Edge = false;
+      for (int32_t Reach = Y - Far; Reach <= Y - Near; Reach++) {
+        int32_t Row = Reach < Y_Top
+                          ? Y_Top - Reach
+                          : (Reach > Y_Bottom ? Reach - Y_Bottom : 0);
+        if (Row < Rows) {
+          Lo = curve_lo[Row] < Lo ? curve_lo[Row] : Lo;
+          Hi = curve_hi[Row] > Hi ? curve_hi[Row] : Hi;
+          Edge |= Reach == Y_Top - Rows + 1 || Reach == Y_Bottom + Rows - 1;
+        }
+      }
+      if (Hi < 0) {
+        continue;
+      }
+
+      // Right side [Lo + Near, Hi + Far], the left one mirrored. The
+      // outermost rows also cover the straight edge in between
+      int32_t Left_Start = X_Left - Hi + Near;
+      int32_t Left_End = X_Left - Lo + Far + 1;
+      int32_t Right_Start = X_Right + Lo + Near;
+      int32_t Right_End = X_Right + Hi + Far + 1;
+      if (Edge || Left_End >= Right_Start) {
+        if (Side == 0) {
+          LCD_Span(Y, Left_Start, Right_End);
+        }
+      } else if (Side == 0) {
+        LCD_Span(Y, Left_Start, Left_End);
+      } else {
+        LCD_Span(Y, Right_Start, Right_End);
+      }
+    }
+    LCD_SpanEnd();
+  }
+}
+
+/********************************************************************************
+function:	Select the colors of LCD_GlyphRow
+note:
+                glyph_lut maps a font byte to its eight pixels. It is built
+                for one background / foreground pair and kept until the
+                colors change.
+********************************************************************************/
+void LCD_ST7735S::LCD_GlyphColors(LCD_COLOR Color_Background,
+                                  LCD_COLOR Color_Foreground) {
+  if (glyph_lut_valid && glyph_lut_background == Color_Background &&
+      glyph_lut_foreground == Color_Foreground) {
+    return;
+  }
+  for (uint32_t Byte = 0; Byte < 256; Byte++) {
+    for (uint32_t Bit = 0; Bit < 8; Bit++) {
+      glyph_lut[Byte][Bit] =
+          (Byte & (0x80 >> Bit)) ? Color_Foreground : Color_Background;
+    }
+  }
+  glyph_lut_background = Color_Background;
+  glyph_lut_foreground = Color_Foreground;
+  glyph_lut_valid = true;
+}
+
+/********************************************************************************
+function:	Expand a row of a 1 bit glyph to RGB565
+parameter:
+                Row        :   Glyph row, MSB first
+                Width      :   Pixels to expand
+                Dst        :   Width pixels
+note:
+                Colors as set by LCD_GlyphColors. Every font byte is one
+                16 byte copy of its table entry, done in words where Dst
+                allows.
+********************************************************************************/
+void LCD_ST7735S::LCD_GlyphRow(const uint8_t *Row, LCD_LENGTH Width,
+                               LCD_COLOR *Dst) {
+  LCD_LENGTH Column = 0;
+  for (; Column + 8 <= Width; Column += 8) {
+    memcpy(&Dst[Column], glyph_lut[*Row++], sizeof(glyph_lut[0]));
+  }
+  if (Column < Width) {
+    memcpy(&Dst[Column], glyph_lut[*Row], (Width - Column) * sizeof(LCD_COLOR));
+  }
+}
+
+/********************************************************************************
+function:	Select the glyph cache
+parameter:
+                Cache :   Cache of opaque cells, or nullptr
+note:
+                Cells are looked up by font, character and both colors.
+                Clear the cache when a font table changes.
+********************************************************************************/
+void LCD_ST7735S::LCD_SetGlyphCache(LCD_Glyph_Cache *Cache) {
+  LCD_Wait();
+  glyph_cache = Cache;
+}
+
+/********************************************************************************
+function:	Expanded cell of a character from the glyph cache
+note:
+                A missed cell is expanded into a free or the least recently
+                used slot. Returns nullptr without a cache or when the cell
+                does not fit a slot.
+********************************************************************************/
+const LCD_COLOR *LCD_ST7735S::LCD_GlyphCell(sFONT *Font, char Char,
+                                            LCD_COLOR Color_Background,
+                                            LCD_COLOR Color_Foreground) {
+  if (!glyph_cache) {
+    return nullptr;
+  }
+  const LCD_COLOR *Cell =
+      glyph_cache->LCD_Find(Font, Char, Color_Background, Color_Foreground);
+  if (Cell) {
+    return Cell;
+  }
+  LCD_COLOR *Slot =
+      glyph_cache->LCD_Insert(Font, Char, Color_Background, Color_Foreground);
+  if (!Slot) {
+    return nullptr;
+  }
+
+  uint32_t Row_Bytes = Font->Width / 8 + (Font->Width % 8 ? 1 : 0);
+  const uint8_t *Glyph = &Font->table[(Char - ' ') * Font->Height * Row_Bytes];
+  LCD_GlyphColors(Color_Background, Color_Foreground);
+  for (LCD_LENGTH Page = 0; Page < Font->Height; Page++) {
+    LCD_GlyphRow(Glyph, Font->Width, &Slot[Page * Font->Width]);
+    Glyph += Row_Bytes;
+  }
+  return Slot;
+}
+
+/********************************************************************************
+function:	Next row of a glyph, read in place from a sFONT table
+********************************************************************************/
+static inline const uint8_t *LCD_GlyphNext(sGLYPH_DECODER *Decoder,
+                                           uint8_t *Row, LCD_LENGTH Width) {
+  if (Decoder->Encoding == FONT_GLYPH_TABLE) {
+    const uint8_t *Table_Row = Decoder->Data;
+    Decoder->Data += Decoder->Width / 8 + (Decoder->Width % 8 ? 1 : 0);
+    return Table_Row;
+  }
+  Font_DecodeRow(Decoder, Row, Width);
+  return Row;
+}
+
+/********************************************************************************
+function:	Draw a glyph with its background
+parameter:
+                Decoder   :   Rows of the glyph
+                Width     :   Columns of the glyph on the display
+                Height    :   Rows of the glyph on the display
+note:
+                The cell is sent with one window, its rows expanded into
+                glyph_buffer and pushed as a single burst (a cell larger
+                than LCD_GLYPH_BUFFER continues the same RAMWR in parts).
+********************************************************************************/
+void LCD_ST7735S::LCD_GlyphOpaque(LCD_POINT Xpoint, LCD_POINT Ypoint,
+                                  sGLYPH_DECODER *Decoder, LCD_LENGTH Width,
+                                  LCD_LENGTH Height,
+                                  LCD_COLOR Color_Background,
+                                  LCD_COLOR Color_Foreground) {
+  uint8_t Row[LCD_GLYPH_ROW];
+  if (index_buffer) {
+    uint8_t Background = LCD_PaletteIndex(Color_Background);
+    uint8_t Foreground = LCD_PaletteIndex(Color_Foreground);
+    for (LCD_LENGTH Page = 0; Page < Height; Page++) {
+      LCD_IndexGlyph(Xpoint, Ypoint + Page, LCD_GlyphNext(Decoder, Row, Width),
+                     Width, Foreground, Background, true);
+    }
+    return;
+  }
+  LCD_GlyphColors(Color_Background, Color_Foreground);
+  if (frame_buffer) {
+    for (LCD_LENGTH Page = 0; Page < Height; Page++) {
+      const uint8_t *Glyph = LCD_GlyphNext(Decoder, Row, Width);
+      LCD_POINT Y = Ypoint + Page;
+      if (Y >= fb_bottom) {
+        break;
+      }
+      if (Y >= fb_top) {
+        LCD_GlyphRow(Glyph, Width,
+                     &frame_buffer[(uint32_t)(Y - fb_top) *
+                                       sLCD_DIS.LCD_Dis_Column +
+                                   Xpoint]);
+      }
+    }
+    return;
+  }
+
+  LCD_SetWindows(Xpoint, Ypoint, Xpoint + Width, Ypoint + Height);
+  uint32_t Fill = 0;
+  for (LCD_LENGTH Page = 0; Page < Height; Page++) {
+    const uint8_t *Glyph = LCD_GlyphNext(Decoder, Row, Width);
+    LCD_GlyphRow(Glyph, Width, &glyph_buffer[Fill]);
+    Fill += Width;
+    if (Fill + Width > LCD_GLYPH_BUFFER || Page == Height - 1) {
+      LCD_WriteData_Buffer(glyph_buffer, Fill);
+      Fill = 0;
+    }
+  }
+}
+
+/********************************************************************************
+function:	Draw the foreground pixels of a glyph only
+parameter:
+                Decoder   :   Rows of the glyph
+                Width     :   Columns of the glyph on the display
+                Height    :   Rows of the glyph on the display
+note:
+                Lit pixels are grouped into horizontal runs, each run is a
+                fill; equal runs of consecutive rows (stems) merge into one.
+********************************************************************************/
+void LCD_ST7735S::LCD_GlyphTransparent(LCD_POINT Xpoint, LCD_POINT Ypoint,
+                                       sGLYPH_DECODER *Decoder,
+                                       LCD_LENGTH Width, LCD_LENGTH Height,
+                                       LCD_COLOR Color_Foreground) {
+  uint8_t Row[LCD_GLYPH_ROW];
+  if (index_buffer) {
+    uint8_t Foreground = LCD_PaletteIndex(Color_Foreground);
+    for (LCD_LENGTH Page = 0; Page < Height; Page++) {
+      LCD_IndexGlyph(Xpoint, Ypoint + Page, LCD_GlyphNext(Decoder, Row, Width),
+                     Width, Foreground, 0, false);
+    }
+    return;
+  }
+  if (frame_buffer) {
+    for (LCD_LENGTH Page = 0; Page < Height; Page++) {
+      const uint8_t *Glyph = LCD_GlyphNext(Decoder, Row, Width);
+      LCD_POINT Y = Ypoint + Page;
+      if (Y >= fb_bottom) {
+        break;
+      }
+      if (Y < fb_top) {
+        continue;
+      }
+      LCD_COLOR *Dst =
+          &frame_buffer[(uint32_t)(Y - fb_top) * sLCD_DIS.LCD_Dis_Column +
+                        Xpoint];
+      for (LCD_LENGTH Column = 0; Column < Width; Column++) {
+        if (Glyph[Column / 8] & (0x80 >> (Column % 8))) {
+          Dst[Column] = Color_Foreground;
+        }
+      }
+    }
+    return;
+  }
+
+  LCD_SpanBegin(false, Color_Foreground);
+  for (LCD_LENGTH Page = 0; Page < Height; Page++) {
+    const uint8_t *Glyph = LCD_GlyphNext(Decoder, Row, Width);
+    LCD_LENGTH Column = 0;
+    while (Column < Width) {
+      if (!(Glyph[Column / 8] & (0x80 >> (Column % 8)))) {
+        Column++;
+        continue;
+      }
+      LCD_LENGTH Run_Start = Column;
+      while (Column < Width && (Glyph[Column / 8] & (0x80 >> (Column % 8)))) {
+        Column++;
+      }
+      LCD_Span(Ypoint + Page, Xpoint + Run_Start, Xpoint + Column);
+    }
+  }
+  LCD_SpanEnd();
+}
+
+/********************************************************************************
+function:	Show English characters
+parameter:
+                        Xpoint ：X coordinate
+                        Ypoint ：Y coordinate
+                        Acsii_Char   ：To display the English characters
+                        Font  ：A structure pointer that displays a character
+size Color_Background : Select the background color of the English character
+                        Color_Foreground : Select the foreground color of the
+English character
+note:
+                A background of FONT_BACKGROUND is transparent, only the
+                character is drawn. The cell is clipped to the display.
+********************************************************************************/
+void LCD_ST7735S::LCD_DisplayChar(LCD_POINT Xpoint, LCD_POINT Ypoint,
+                                  const char Acsii_Char, sFONT *Font,
+                                  LCD_COLOR Color_Background,
+                                  LCD_COLOR Color_Foreground) {
+  if (Xpoint >= sLCD_DIS.LCD_Dis_Column || Ypoint >= sLCD_DIS.LCD_Dis_Page) {
+    return;
+  }
+
+  LCD_MarkDirty(Xpoint, Ypoint, Xpoint + Font->Width, Ypoint + Font->Height);
+
+  sGLYPH_DECODER Decoder;
+  Font_DecodeTable(&Decoder, Font, Acsii_Char);
+
+  // Part of the cell on the display
+  LCD_LENGTH Width = Font->Width;
+  LCD_LENGTH Height = Font->Height;
+  if (Xpoint + Width > sLCD_DIS.LCD_Dis_Column) {
+    Width = sLCD_DIS.LCD_Dis_Column - Xpoint;
+  }
+  if (Ypoint + Height > sLCD_DIS.LCD_Dis_Page) {
+    Height = sLCD_DIS.LCD_Dis_Page - Ypoint;
+  }
+
+  // To determine whether the font background color and screen background
+  // color is consistent
+  if (FONT_BACKGROUND == Color_Background) {
+    LCD_GlyphTransparent(Xpoint, Ypoint, &Decoder, Width, Height,
+                         Color_Foreground);
+    return;
+  }
+
+  // A whole cell from the glyph cache is sent as it is
+  const LCD_COLOR *Cell = nullptr;
+  if (!index_buffer && Width == Font->Width && Height == Font->Height) {
+    Cell = LCD_GlyphCell(Font, Acsii_Char, Color_Background, Color_Foreground);
+  }
+  if (Cell) {
+    LCD_DrawBitmap(Xpoint, Ypoint, Width, Height, Cell);
+  } else {
+    LCD_GlyphOpaque(Xpoint, Ypoint, &Decoder, Width, Height, Color_Background,
+                    Color_Foreground);
+  }
+}
+
+/********************************************************************************
+function:	Show a character of a packed font
+parameter:
+                        Xpoint ：X coordinate
+                        Ypoint ：Y coordinate
+                        Acsii_Char       ：Character to display
+                        Font             ：Packed font
+                        Color_Background ：Background color, FONT_BACKGROUND
+                                           for none
+                        Color_Foreground ：Foreground color
+note:
+                The cell is the advance of the glyph by the line height,
+                pixels of the glyph outside of it are not drawn. The rows
+                are decoded straight into the glyph blitter.
+********************************************************************************/
+void LCD_ST7735S::LCD_DisplayChar(LCD_POINT Xpoint, LCD_POINT Ypoint,
+                                  const char Acsii_Char, const sPFONT *Font,
+                                  LCD_COLOR Color_Background,
+                                  LCD_COLOR Color_Foreground) {
+  if (Xpoint >= sLCD_DIS.LCD_Dis_Column || Ypoint >= sLCD_DIS.LCD_Dis_Page) {
+    return;
+  }
+  const sGLYPH *Glyph = Font_FindGlyph(Font, Acsii_Char);
+  LCD_LENGTH Advance = Font_Advance(Font, Glyph);
+  if (Advance == 0) {
+    return;
+  }
+
+  LCD_MarkDirty(Xpoint, Ypoint, Xpoint + Advance, Ypoint + Font->Height);
+
+  sGLYPH_DECODER Decoder;
+  Font_DecodePacked(&Decoder, Font, Glyph);
+
+  LCD_LENGTH Width = Advance;
+  LCD_LENGTH Height = Font->Height;
+  if (Xpoint + Width > sLCD_DIS.LCD_Dis_Column) {
+    Width = sLCD_DIS.LCD_Dis_Column - Xpoint;
+  }
+  if (Ypoint + Height > sLCD_DIS.LCD_Dis_Page) {
+    Height = sLCD_DIS.LCD_Dis_Page - Ypoint;
+  }
+
+  if (FONT_BACKGROUND == Color_Background) {
+    LCD_GlyphTransparent(Xpoint, Ypoint, &Decoder, Width, Height,
+                         Color_Foreground);
+  } else {
+    LCD_GlyphOpaque(Xpoint, Ypoint, &Decoder, Width, Height, Color_Background,
+                    Color_Foreground);
+  }
+}
+
+/********************************************************************************
+function:	Draw characters side by side on one line of text
+parameter:
+                        Xpoint  ：X coordinate of the first character
+                        Ypoint  ：Y coordinate
+                        pString ：Characters to draw
+                        Length  ：Number of characters
+note:
+                The line is clipped to the display and sent with a single
+                window. Each scanline is rasterized into text_line while the
+                previous one is on the bus.
+********************************************************************************/
+void LCD_ST7735S::LCD_TextRun(LCD_POINT Xpoint, LCD_POINT Ypoint,
+                              const char *pString, uint32_t Length,
+                              sFONT *Font, LCD_COLOR Color_Background,
+                              LCD_COLOR Color_Foreground) {
+  uint32_t Width = Length * Font->Width;
+  LCD_LENGTH Height = Font->Height;
+  if (Xpoint + Width > sLCD_DIS.LCD_Dis_Column) {
+    Width = sLCD_DIS.LCD_Dis_Column - Xpoint;
+  }
+  if (Ypoint + Height > sLCD_DIS.LCD_Dis_Page) {
+    Height = sLCD_DIS.LCD_Dis_Page - Ypoint;
+  }
+
+  uint32_t Row_Bytes = Font->Width / 8 + (Font->Width % 8 ? 1 : 0);
+  uint32_t Char_Bytes = Font->Height * Row_Bytes;
+
+  // Cells of the cached characters. With at most one character per slot,
+  // none of them is evicted before the line is sent
+  bool Cached = glyph_cache && Length <= LCD_TEXT_CELLS &&
+                Length <= glyph_cache->LCD_Slots();
+  for (uint32_t i = 0; Cached && i < Length; i++) {
+    text_cell[i] =
+        LCD_GlyphCell(Font, pString[i], Color_Background, Color_Foreground);
+  }
+
+  LCD_GlyphColors(Color_Background, Color_Foreground);
+  LCD_SetWindows(Xpoint, Ypoint, Xpoint + Width, Ypoint + Height);
+  for (LCD_LENGTH Page = 0; Page < Height; Page++) {
+    // Free again, the transfer started before the last one has completed
+    LCD_COLOR *Line = text_line[Page % 2];
+    for (uint32_t Column = 0, i = 0; Column < Width;
+         Column += Font->Width, i++) {
+      LCD_LENGTH Columns =
+          Width - Column < Font->Width ? Width - Column : Font->Width;
+      if (Cached && text_cell[i]) {
+        memcpy(&Line[Column], &text_cell[i][Page * Font->Width],
+               Columns * sizeof(LCD_COLOR));
+        continue;
+      }
+      const uint8_t *Glyph = &Font->table[(pString[i] - ' ') * Char_Bytes +
+                                          Page * Row_Bytes];
+      LCD_GlyphRow(Glyph, Columns, &Line[Column]);
+    }
+    LCD_StartData_Buffer(Line, Width, nullptr, nullptr);
+  }
+  transport->Wait();
+}
+
+/********************************************************************************
+function:	Display the string
+parameter:
+                        Xstart ：X coordinate
+                        Ystart ：Y coordinate
+                        pString   ：The first address of the English string to
+be displayed Font  ：A structure pointer that displays a character size
+                        Color_Background : Select the background color of the
+English character Color_Foreground : Select the foreground color of the English
+character
+note:
+                A line that is full wraps to Xstart below, a full display
+                starts over at (Xstart, Ystart).
+********************************************************************************/
+void LCD_ST7735S::LCD_DisplayString(LCD_POINT Xstart, LCD_POINT Ystart,
+                                    const char *pString, sFONT *Font,
+                                    LCD_COLOR Color_Background,
+                                    LCD_COLOR Color_Foreground) {
+  LCD_POINT Xpoint = Xstart;
+  LCD_POINT Ypoint = Ystart;
+
+  if (Xstart >= sLCD_DIS.LCD_Dis_Column || Ystart >= sLCD_DIS.LCD_Dis_Page) {
+    return;
+  }
+
+  // One line of text, or everything below Ystart once it wraps
+  uint32_t Length = strlen(pString);
+  if (Xstart + Length * Font->Width <= sLCD_DIS.LCD_Dis_Column) {
+    LCD_MarkDirty(Xstart, Ystart, Xstart + Length * Font->Width,
+                  Ystart + Font->Height);
+  } else {
+    LCD_MarkDirty(Xstart, Ystart, sLCD_DIS.LCD_Dis_Column,
+                  sLCD_DIS.LCD_Dis_Page);
+  }
+
+  // With a background, each line of text goes out as one window. A
+  // transparent background or the framebuffer take the glyph path
+  bool Streamed =
+      !frame_buffer && !index_buffer && Color_Background != FONT_BACKGROUND;
+  const char *Run = pString;
+  uint32_t Run_Length = 0;
+  LCD_POINT Run_X = Xstart, Run_Y = Ystart;
+
+  while (*pString != '\0') {
+    // if X direction filled , reposition to(Xstart,Ypoint),Ypoint is Y
+    // direction plus the height of the character
+    if ((Xpoint + Font->Width) > sLCD_DIS.LCD_Dis_Column) {
+      Xpoint = Xstart;
+      Ypoint += Font->Height;
+    }
+
+    // If the Y direction is full, reposition to (Xstart, Ystart)
+    if ((Ypoint + Font->Height) > sLCD_DIS.LCD_Dis_Page) {
+      Xpoint = Xstart;
       Ypoint = Ystart;
     }
-    LCD_DisplayChar(Xpoint, Ypoint, *pString, Font, Color_Background,
+
+    if (Streamed) {
+      // Characters following each other on a line are sent together
+      if (Run_Length &&
+          (Ypoint != Run_Y || Xpoint != Run_X + Run_Length * Font->Width)) {
+        LCD_TextRun(Run_X, Run_Y, Run, Run_Length, Font, Color_Background,
                     Color_Foreground);
+        Run_Length = 0;
+      }
+      if (Run_Length == 0) {
+        Run = pString;
+        Run_X = Xpoint;
+        Run_Y = Ypoint;
+      }
+      Run_Length++;
+    } else {
+      LCD_DisplayChar(Xpoint, Ypoint, *pString, Font, Color_Background,
+                      Color_Foreground);
+    }
 
     // The next character of the address
     pString++;
@@ -687,6 +2292,214 @@ void LCD_ST7735S::LCD_DisplayString(LCD_POINT Xstart, LCD_POINT Ystart,
     // The next word of the abscissa increases the font of the broadband
     Xpoint += Font->Width;
   }
+
+  if (Run_Length) {
+    LCD_TextRun(Run_X, Run_Y, Run, Run_Length, Font, Color_Background,
+                Color_Foreground);
+  }
+}
+
+/********************************************************************************
+function:	Display a string in a packed font
+parameter:
+                        Xstart ：X coordinate
+                        Ystart ：Y coordinate
+                        pString          ：String to display
+                        Font             ：Packed font
+                        Color_Background ：Background color, FONT_BACKGROUND
+                                           for none
+                        Color_Foreground ：Foreground color
+note:
+                Each character advances by its own glyph; wrapping and the
+                restart at (Xstart, Ystart) as LCD_DisplayString.
+********************************************************************************/
+void LCD_ST7735S::LCD_DisplayString(LCD_POINT Xstart, LCD_POINT Ystart,
+                                    const char *pString, const sPFONT *Font,
+                                    LCD_COLOR Color_Background,
+                                    LCD_COLOR Color_Foreground) {
+  LCD_POINT Xpoint = Xstart;
+  LCD_POINT Ypoint = Ystart;
+
+  if (Xstart >= sLCD_DIS.LCD_Dis_Column || Ystart >= sLCD_DIS.LCD_Dis_Page) {
+    return;
+  }
+
+  while (*pString != '\0') {
+    LCD_LENGTH Advance = Font_Advance(Font, Font_FindGlyph(Font, *pString));
+
+    if ((Xpoint + Advance) > sLCD_DIS.LCD_Dis_Column) {
+      Xpoint = Xstart;
+      Ypoint += Font->Height;
+    }
+    if ((Ypoint + Font->Height) > sLCD_DIS.LCD_Dis_Page) {
+      Xpoint = Xstart;
+      Ypoint = Ystart;
+    }
+    LCD_DisplayChar(Xpoint, Ypoint, *pString, Font, Color_Background,
+                    Color_Foreground);
+
+    pString++;
+    Xpoint += Advance;
+  }
+}
+
+/********************************************************************************
+function:	Pad the parts of a layout line its characters leave free
+parameter:
+                        Xstart ：X coordinate of the box
+                        Ypoint ：Y coordinate of the line
+                        Layout ：Layout of the string
+                        Line   ：Index of the line in the layout
+                        Color_Background ：Fill color
+note:
+                Together with the characters this covers the box width, so
+                an opaque readout is redrawn without clearing it first.
+********************************************************************************/
+void LCD_ST7735S::LCD_TextPad(LCD_POINT Xstart, LCD_POINT Ypoint,
+                              const LCD_LAYOUT *Layout, uint8_t Line,
+                              LCD_COLOR Color_Background) {
+  int32_t Left = Xstart + Layout->Line[Line].X;
+  int32_t Right = Left + Layout->Line[Line].Width;
+  int32_t Bottom = Ypoint + Layout->Line_Height;
+  LCD_FillClipped(Xstart, Ypoint, Left, Bottom, Color_Background);
+  LCD_FillClipped(Right, Ypoint, Xstart + Layout->Box_Width, Bottom,
+                  Color_Background);
+}
+
+/********************************************************************************
+function:	Display a string as laid out by LCD_Text_Layout
+parameter:
+                        Xstart ：X coordinate of the box
+                        Ystart ：Y coordinate of the box
+                        pString ：String the layout was measured from
+                        Layout  ：LCD_Text_Layout::LCD_Measure of pString
+                        Font    ：Font the layout was measured with
+                        Color_Background ：Background color, FONT_BACKGROUND
+                                           for none
+                        Color_Foreground ：Foreground color
+note:
+                With a background the whole box of Layout->Box_Width by
+                Layout->Height is drawn, so a shorter string overwrites a
+                longer one in place. Lines are clipped, they do not wrap.
+********************************************************************************/
+void LCD_ST7735S::LCD_DisplayText(LCD_POINT Xstart, LCD_POINT Ystart,
+                                  const char *pString,
+                                  const LCD_LAYOUT *Layout, sFONT *Font,
+                                  LCD_COLOR Color_Background,
+                                  LCD_COLOR Color_Foreground) {
+  bool Opaque = Color_Background != FONT_BACKGROUND;
+  bool Streamed = !frame_buffer && !index_buffer && Opaque;
+
+  for (uint8_t n = 0; n < Layout->Lines; n++) {
+    const LCD_LAYOUT_LINE *Line = &Layout->Line[n];
+    LCD_POINT Ypoint = Ystart + n * Layout->Line_Height;
+    LCD_POINT Xpoint = Xstart + Line->X;
+    if (Ypoint >= sLCD_DIS.LCD_Dis_Page) {
+      break;
+    }
+    if (Opaque) {
+      LCD_TextPad(Xstart, Ypoint, Layout, n, Color_Background);
+    }
+    if (Line->Length == 0 || Xpoint >= sLCD_DIS.LCD_Dis_Column) {
+      continue;
+    }
+
+    const char *Text = &pString[Line->Start];
+    if (Streamed) {
+      LCD_MarkDirty(Xpoint, Ypoint, Xpoint + Line->Width,
+                    Ypoint + Layout->Line_Height);
+      LCD_TextRun(Xpoint, Ypoint, Text, Line->Length, Font, Color_Background,
+                  Color_Foreground);
+      continue;
+    }
+    for (uint16_t i = 0; i < Line->Length; i++) {
+      LCD_DisplayChar(Xpoint, Ypoint, Text[i], Font, Color_Background,
+                      Color_Foreground);
+      Xpoint += Font->Width;
+    }
+  }
+}
+
+void LCD_ST7735S::LCD_DisplayText(LCD_POINT Xstart, LCD_POINT Ystart,
+                                  const char *pString,
+                                  const LCD_LAYOUT *Layout,
+                                  const sPFONT *Font,
+                                  LCD_COLOR Color_Background,
+                                  LCD_COLOR Color_Foreground) {
+  for (uint8_t n = 0; n < Layout->Lines; n++) {
+    const LCD_LAYOUT_LINE *Line = &Layout->Line[n];
+    LCD_POINT Ypoint = Ystart + n * Layout->Line_Height;
+    LCD_POINT Xpoint = Xstart + Line->X;
+    if (Ypoint >= sLCD_DIS.LCD_Dis_Page) {
+      break;
+    }
+    if (Color_Background != FONT_BACKGROUND) {
+      LCD_TextPad(Xstart, Ypoint, Layout, n, Color_Background);
+    }
+
+    const char *Text = &pString[Line->Start];
+    for (uint16_t i = 0; i < Line->Length; i++) {
+      LCD_DisplayChar(Xpoint, Ypoint, Text[i], Font, Color_Background,
+                      Color_Foreground);
+      Xpoint += Font_Advance(Font, Font_FindGlyph(Font, Text[i]));
+    }
+  }
+}
+
+/********************************************************************************
+function:	Run a recorded drawing command
+parameter:
+                        Command ：Command of LCD_Command_Writer
+********************************************************************************/
+void LCD_ST7735S::LCD_Execute(const LCD_COMMAND *Command) {
+  switch (Command->Op) {
+  case LCD_OP_INIT:
+    LCD_Init((LCD_SCAN_DIR)Command->Style);
+    break;
+  case LCD_OP_CLEAR:
+    LCD_Clear(Command->Color);
+    break;
+  case LCD_OP_FILL:
+    LCD_SetArealColor(Command->X0, Command->Y0, Command->X1, Command->Y1,
+                      Command->Color);
+    break;
+  case LCD_OP_BITMAP:
+    LCD_DrawBitmap(Command->X0, Command->Y0, Command->X1, Command->Y1,
+                   Command->Bitmap);
+    break;
+  case LCD_OP_POINT:
+    LCD_DrawPoint(Command->X0, Command->Y0, Command->Color,
+                  (DOT_PIXEL)Command->Dot_Pixel, (DOT_STYLE)Command->Style);
+    break;
+  case LCD_OP_LINE:
+    LCD_DrawLine(Command->X0, Command->Y0, Command->X1, Command->Y1,
+                 Command->Color, (LINE_STYLE)Command->Style,
+                 (DOT_PIXEL)Command->Dot_Pixel);
+    break;
+  case LCD_OP_RECTANGLE:
+    LCD_DrawRectangle(Command->X0, Command->Y0, Command->X1, Command->Y1,
+                      Command->Color, (DRAW_FILL)Command->Style,
+                      (DOT_PIXEL)Command->Dot_Pixel);
+    break;
+  case LCD_OP_CIRCLE:
+    LCD_DrawCircle(Command->X0, Command->Y0, Command->X1, Command->Color,
+                   (DRAW_FILL)Command->Style, (DOT_PIXEL)Command->Dot_Pixel);
+    break;
+  case LCD_OP_STRING:
+    LCD_DisplayString(Command->X0, Command->Y0, LCD_CommandText(Command),
+                      (sFONT *)Command->Font, Command->Color, Command->Color2);
+    break;
+  case LCD_OP_PACKED_STRING:
+    LCD_DisplayString(Command->X0, Command->Y0, LCD_CommandText(Command),
+                      Command->Packed, Command->Color, Command->Color2);
+    break;
+  case LCD_OP_FLUSH:
+    LCD_Flush();
+    break;
+  case LCD_OP_CALL:
+    Command->Call(this, Command->User_Data);
+    break;
+  }
 }
 
 /********************************************************************************
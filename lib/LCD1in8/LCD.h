@@ -2,8 +2,14 @@
 #define __LCD_H
 
 #include "fonts.h"
+#include "LCD_Transport.h"
+#if defined(LCD_HOST)
+#include <stdbool.h>
+#include <sys/types.h>
+#else
 #include "pico/stdlib.h"
-#include "hardware/spi.h"
+#include "LCD_SPI.h"
+#endif
 
 #define LCD_COLOR uint16_t  // The variable type of the color
 #define LCD_POINT uint16_t  // The type of coordinate
@@ -23,6 +29,33 @@
 #define LCD_HEIGHT 128 // LCD height
 #endif
 
+#define LCD_FRAMEBUFFER_SIZE (LCD_WIDTH * LCD_HEIGHT) // pixels
+
+// Bytes of an indexed framebuffer of Bpp (8 or 4) bits per pixel
+#define LCD_INDEXED_SIZE(Bpp) (LCD_FRAMEBUFFER_SIZE * (Bpp) / 8)
+
+// Dirty region tracking of the framebuffer
+#define LCD_DIRTY_RECTS 8        // Regions flushed with their own window
+#define LCD_DIRTY_WINDOW_COST 64 // Window setup cost, in pixel data bytes
+#define LCD_DIRTY_ROW_COST 8     // Extra cost per row of a partial width region
+
+// Rows of a circle or ellipse kept for span drawing, enough for any row
+// within reach of the display
+#define LCD_CURVE_ROWS                                                         \
+  ((LCD_WIDTH > LCD_HEIGHT ? LCD_WIDTH : LCD_HEIGHT) + 2 * DOT_PIXEL_8X8)
+
+// Pixels of a glyph cell sent in one burst, a Font24 character
+#define LCD_GLYPH_BUFFER (MAX_WIDTH_FONT * MAX_HEIGHT_FONT)
+
+// Pixels of a line buffer of LCD_DisplayString, the longer panel side
+#define LCD_TEXT_LINE (LCD_WIDTH > LCD_HEIGHT ? LCD_WIDTH : LCD_HEIGHT)
+
+// Bytes of a decoded glyph row, one bit per pixel
+#define LCD_GLYPH_ROW ((LCD_TEXT_LINE + 7) / 8)
+
+// Characters of a line of text taken from the glyph cache at once
+#define LCD_TEXT_CELLS 32
+
 #define LCD_X 2
 #define LCD_Y 1
 #define LCD_X_MAXPIXEL 132 // LCD width maximum memory
@@ -125,33 +158,201 @@ typedef enum {
 #define BRRED 0XFC07
 #define GRAY 0X8430
 
+/********************************************************************************
+  function:
+                        Initialization timing, ST7735S datasheet minimums
+********************************************************************************/
+#define LCD_RESET_PULSE_US 10      // RESX low pulse width
+#define LCD_RESET_CMD_US 5000      // RESX release to the first command
+#define LCD_RESET_SLPOUT_US 120000 // RESX release to Sleep Out
+#ifndef LCD_INIT_MARGIN_PERCENT
+#define LCD_INIT_MARGIN_PERCENT 20 // Safety margin added to every delay
+#endif
+
+typedef enum {
+  LCD_INIT_IDLE = 0,  // LCD_InitStart not called yet
+  LCD_INIT_RESET,     // RESX held low
+  LCD_INIT_REGISTER,  // Sending the register table
+  LCD_INIT_SLEEP_OUT, // Waiting until Sleep Out is allowed
+  LCD_INIT_POWER_ON,  // Sending the power on table
+  LCD_INIT_DONE,      // Ready to draw
+} LCD_INIT_STATE;
+
+/********************************************************************************
+  function:
+                        Rectangle, the end coordinates are exclusive
+********************************************************************************/
+typedef struct {
+  LCD_POINT Xstart;
+  LCD_POINT Ystart;
+  LCD_POINT Xend;
+  LCD_POINT Yend;
+} LCD_RECT;
+
+class LCD_Glyph_Cache;
+typedef struct _tLayout LCD_LAYOUT;
+typedef struct _tCommand LCD_COMMAND;
+
 /********************************************************************************
   function:
                         Macro definition variable name
 ********************************************************************************/
 class LCD_ST7735S {
-  void LCD_Reset(void);
-  void Write_CS(bool Val);
-  void Write_DC(bool Val);
-  void Write_RST(bool Val);
-  void Write_BL(bool Val);
-  void LCD_WriteReg(uint8_t Reg);
-  void LCD_WriteData_8Bit(uint8_t Data);
+  void LCD_Attach(LCD_Transport *transport);
+  void LCD_WriteCommandTable(const uint8_t *Table);
+  const uint8_t *LCD_WriteCommandEntries(const uint8_t *Table,
+                                         uint32_t *Delay_ms);
   void LCD_WriteData_16Bit(uint16_t Data);
   void LCD_WriteData_NLen16Bit(uint16_t Data, uint32_t DataLen);
+  void LCD_WriteData_Buffer(const LCD_COLOR *Buffer, uint32_t DataLen);
+  void LCD_StartData_NLen16Bit(uint16_t Data, uint32_t DataLen,
+                               LCD_CALLBACK Callback, void *User_Data);
+  void LCD_StartData_Buffer(const LCD_COLOR *Buffer, uint32_t DataLen,
+                            LCD_CALLBACK Callback, void *User_Data);
   void LCD_InitReg(void);
   void LCD_SetGramScanWay(LCD_SCAN_DIR Scan_dir);
 
-  spi_inst_t* spi_port;
-  uint pin_cs;
-  uint pin_dc;
-  uint pin_rst;
-  uint pin_bl;
+  // Bus to the panel
+  LCD_Transport *transport;
+#if !defined(LCD_HOST)
+  LCD_SPI_Transport spi_transport;
+#endif
+
+  // Cooperative initialization
+  LCD_INIT_STATE init_state;
+  LCD_SCAN_DIR init_scan_dir;
+  const uint8_t *init_table;
+  uint64_t init_reset_us;
+  uint64_t init_deadline_us;
+  void LCD_InitDelay(uint64_t From_us, uint32_t Delay_us);
+
+  // Optional in-RAM canvas, LCD_Dis_Column pixels wide, holding the rows
+  // [fb_top, fb_bottom) of the display
+  LCD_COLOR *frame_buffer;
+  LCD_POINT fb_top;
+  LCD_POINT fb_bottom;
+  void LCD_FB_Fill(LCD_POINT Xstart, LCD_POINT Ystart, LCD_POINT Xend,
+                   LCD_POINT Yend, LCD_COLOR Color);
+
+  // Optional indexed canvas, LCD_Dis_Column x LCD_Dis_Page pixels of
+  // index_bpp bits into palette, expanded into text_line when flushed
+  uint8_t *index_buffer;
+  uint8_t index_bpp;
+  LCD_COLOR *palette;
+  uint16_t palette_used;  // Entries taken, the rest is handed out on use
+  bool palette_full;      // A color fell back to its closest entry
+  bool index_cached;      // Last color looked up and its entry
+  LCD_COLOR index_color;
+  uint8_t index_last;
+  uint8_t LCD_PaletteIndex(LCD_COLOR Color);
+  uint8_t *LCD_IndexRow(LCD_POINT Ypoint);
+  void LCD_IndexFill(LCD_POINT Xstart, LCD_POINT Ypoint, LCD_POINT Xend,
+                     uint8_t Index);
+  void LCD_IndexPack(LCD_POINT Xstart, LCD_POINT Ypoint, LCD_LENGTH Width,
+                     const LCD_COLOR *Colors);
+  void LCD_IndexGlyph(LCD_POINT Xpoint, LCD_POINT Ypoint, const uint8_t *Glyph,
+                      LCD_LENGTH Width, uint8_t Foreground, uint8_t Background,
+                      bool Opaque);
+  void LCD_IndexExpand(const uint8_t *Indices, LCD_POINT Ypoint,
+                       LCD_POINT Xstart, LCD_POINT Xend, LCD_COLOR *Dst);
+
+  // Regions of the framebuffer changed since the last flush
+  LCD_RECT dirty_rect[LCD_DIRTY_RECTS];
+  uint8_t dirty_count;
+  void LCD_MarkDirtyArea(int32_t Xstart, int32_t Ystart, int32_t Xend,
+                         int32_t Yend);
+
+  // Flush in progress, advanced from the DMA completion
+  LCD_RECT flush_rect[LCD_DIRTY_RECTS];
+  uint8_t flush_count;
+  uint8_t flush_index;
+  LCD_POINT flush_row;
+  const LCD_COLOR *flush_buffer; // Canvas being sent, whose first row is
+  LCD_POINT flush_top;           // flush_top
+  const uint8_t *flush_indices;  // Or indexed canvas being sent
+  volatile bool flush_active;
+  volatile bool flush_window; // Next region waits for LCD_Poll
+  LCD_CALLBACK flush_callback;
+  void *flush_callback_data;
+  void LCD_FlushNext(bool Thread);
+  static void LCD_FlushCallback(void *User_Data);
+
+  // Fills given in signed coordinates, clipped to the display
+  void LCD_FillClipped(int32_t Xstart, int32_t Ystart, int32_t Xend,
+                       int32_t Yend, LCD_COLOR Color);
+
+  // Spans of adjacent scanlines merged into one fill while they line up
+  bool span_vertical;
+  bool span_open;
+  LCD_COLOR span_color;
+  int32_t span_line_start;
+  int32_t span_line_end;
+  int32_t span_start;
+  int32_t span_end;
+  void LCD_SpanBegin(bool Vertical, LCD_COLOR Color);
+  void LCD_Span(int32_t Line, int32_t Start, int32_t End);
+  void LCD_SpanEnd(void);
+
+  // Quadrant of a circle or ellipse: extent of its pixels on each row,
+  // indexed by the distance from the center row
+  LCD_LENGTH curve_lo[LCD_CURVE_ROWS];
+  LCD_LENGTH curve_hi[LCD_CURVE_ROWS];
+  LCD_LENGTH curve_rows;
+  void LCD_CurveBegin(LCD_LENGTH Radius);
+  void LCD_CurvePoint(int32_t X, int32_t Row);
+  void LCD_CurveDraw(int32_t X_Left, int32_t Y_Top, int32_t X_Right,
+                     int32_t Y_Bottom, LCD_COLOR Color, DRAW_FILL Draw_Fill,
+                     DOT_PIXEL Dot_Pixel);
+
+  // Glyph cell expanded to RGB565
+  LCD_COLOR glyph_buffer[LCD_GLYPH_BUFFER];
+
+  // Pixels of every font byte in the current glyph colors
+  alignas(4) LCD_COLOR glyph_lut[256][8];
+  bool glyph_lut_valid;
+  LCD_COLOR glyph_lut_background;
+  LCD_COLOR glyph_lut_foreground;
+  void LCD_GlyphColors(LCD_COLOR Color_Background, LCD_COLOR Color_Foreground);
+  void LCD_GlyphRow(const uint8_t *Row, LCD_LENGTH Width, LCD_COLOR *Dst);
+
+  // Optional cache of expanded cells
+  LCD_Glyph_Cache *glyph_cache;
+  const LCD_COLOR *LCD_GlyphCell(sFONT *Font, char Char,
+                                 LCD_COLOR Color_Background,
+                                 LCD_COLOR Color_Foreground);
+  void LCD_GlyphOpaque(LCD_POINT Xpoint, LCD_POINT Ypoint,
+                       sGLYPH_DECODER *Decoder, LCD_LENGTH Width,
+                       LCD_LENGTH Height, LCD_COLOR Color_Background,
+                       LCD_COLOR Color_Foreground);
+  void LCD_GlyphTransparent(LCD_POINT Xpoint, LCD_POINT Ypoint,
+                            sGLYPH_DECODER *Decoder, LCD_LENGTH Width,
+                            LCD_LENGTH Height, LCD_COLOR Color_Foreground);
+
+  // Scanlines of a line of text, one filled while the other is sent
+  LCD_COLOR text_line[2][LCD_TEXT_LINE];
+  const LCD_COLOR *text_cell[LCD_TEXT_CELLS];
+  void LCD_TextRun(LCD_POINT Xpoint, LCD_POINT Ypoint, const char *pString,
+                   uint32_t Length, sFONT *Font, LCD_COLOR Color_Background,
+                   LCD_COLOR Color_Foreground);
+  void LCD_TextPad(LCD_POINT Xstart, LCD_POINT Ypoint, const LCD_LAYOUT *Layout,
+                   uint8_t Line, LCD_COLOR Color_Background);
 
 public:
+  LCD_ST7735S(LCD_Transport *transport);
+#if !defined(LCD_HOST)
   LCD_ST7735S(spi_inst_t *spi_port, uint pin_cs, uint pin_dc, uint pin_rst, uint pin_bl);
+#endif
   void LCD_Init(LCD_SCAN_DIR Lcd_ScanDir);
 
+  // Non-blocking initialization, call LCD_InitStep until it returns true
+  void LCD_InitStart(LCD_SCAN_DIR Lcd_ScanDir);
+  bool LCD_InitPoll(void);
+  bool LCD_InitStep(void);
+  LCD_INIT_STATE LCD_InitState(void);
+  uint64_t LCD_InitDeadline(void);
+  uint64_t LCD_Time_us(void); // Clock of the transport
+  void LCD_Delay_us(uint32_t Delay_us);
+
   // LCD set cursor + windows + color
   void LCD_SetWindows(LCD_POINT Xstart, LCD_POINT Ystart, LCD_POINT Xend,
                       LCD_POINT Yend);
@@ -161,6 +362,49 @@ public:
   void LCD_SetArealColor(LCD_POINT Xstart, LCD_POINT Ystart, LCD_POINT Xend,
                          LCD_POINT Yend, LCD_COLOR Color);
   void LCD_Clear(LCD_COLOR Color);
+  void LCD_DrawBitmap(LCD_POINT Xpoint, LCD_POINT Ypoint, LCD_LENGTH Width,
+                      LCD_LENGTH Height, const LCD_COLOR *Bitmap);
+
+  // Asynchronous transfers, the buffers must stay valid until completion
+  void LCD_SetArealColor_Async(LCD_POINT Xstart, LCD_POINT Ystart,
+                               LCD_POINT Xend, LCD_POINT Yend, LCD_COLOR Color,
+                               LCD_CALLBACK Callback = nullptr,
+                               void *User_Data = nullptr);
+  void LCD_Clear_Async(LCD_COLOR Color, LCD_CALLBACK Callback = nullptr,
+                       void *User_Data = nullptr);
+  void LCD_DrawBitmap_Async(LCD_POINT Xpoint, LCD_POINT Ypoint,
+                            LCD_LENGTH Width, LCD_LENGTH Height,
+                            const LCD_COLOR *Bitmap,
+                            LCD_CALLBACK Callback = nullptr,
+                            void *User_Data = nullptr);
+  bool LCD_Busy(void);
+  void LCD_Wait(void);
+  // Start the next region of a flush, call from the main loop
+  void LCD_Poll(void);
+
+  // Framebuffer mode, Buffer holds LCD_FRAMEBUFFER_SIZE pixels
+  void LCD_SetFramebuffer(LCD_COLOR *Buffer);
+  // Canvas of Rows rows from Ystart, drawing elsewhere is clipped
+  void LCD_SetStrip(LCD_COLOR *Buffer, LCD_POINT Ystart, LCD_LENGTH Rows);
+  // Draw into Buffer, brought up to date, while the canvas is flushed
+  void LCD_SwapFramebuffer(LCD_COLOR *Buffer);
+  LCD_COLOR *LCD_GetFramebuffer(void);
+  // Indexed framebuffer mode, Buffer holds LCD_INDEXED_SIZE(Bpp) bytes and
+  // Palette 1 << Bpp colors, of which the first Colors are set. A new color
+  // takes the next free entry; once all are taken it is drawn in the
+  // nearest entry instead, and LCD_PaletteFull turns true.
+  void LCD_SetIndexedFramebuffer(uint8_t *Buffer, uint8_t Bpp,
+                                 LCD_COLOR *Palette, uint16_t Colors = 0);
+  uint8_t *LCD_GetIndexedFramebuffer(void);
+  // A color was drawn in a nearest entry since LCD_SetIndexedFramebuffer
+  bool LCD_PaletteFull(void);
+  // Recolor every pixel of an entry at the next flush
+  void LCD_SetPalette(uint8_t Index, LCD_COLOR Color);
+  void LCD_Flush(void);
+  void LCD_Flush_Async(LCD_CALLBACK Callback = nullptr,
+                       void *User_Data = nullptr);
+  void LCD_MarkDirty(LCD_POINT Xstart, LCD_POINT Ystart, LCD_POINT Xend,
+                     LCD_POINT Yend);
 
   // Drawing
   void LCD_DrawPoint(LCD_POINT Xpoint, LCD_POINT Ypoint, LCD_COLOR Color,
@@ -171,9 +415,24 @@ public:
   void LCD_DrawRectangle(LCD_POINT Xstart, LCD_POINT Ystart, LCD_POINT Xend,
                          LCD_POINT Yend, LCD_COLOR Color, DRAW_FILL Filled,
                          DOT_PIXEL Dot_Pixel);
+  void LCD_DrawRoundRectangle(LCD_POINT Xstart, LCD_POINT Ystart,
+                              LCD_POINT Xend, LCD_POINT Yend,
+                              LCD_LENGTH Radius, LCD_COLOR Color,
+                              DRAW_FILL Filled, DOT_PIXEL Dot_Pixel);
+  void LCD_DrawBorderedRectangle(LCD_POINT Xstart, LCD_POINT Ystart,
+                                 LCD_POINT Xend, LCD_POINT Yend,
+                                 LCD_COLOR Color, LCD_COLOR Border_Color,
+                                 DOT_PIXEL Dot_Pixel);
   void LCD_DrawCircle(LCD_POINT X_Center, LCD_POINT Y_Center, LCD_LENGTH Radius,
                       LCD_COLOR Color, DRAW_FILL Draw_Fill,
                       DOT_PIXEL Dot_Pixel);
+  void LCD_DrawEllipse(LCD_POINT X_Center, LCD_POINT Y_Center,
+                       LCD_LENGTH X_Radius, LCD_LENGTH Y_Radius,
+                       LCD_COLOR Color, DRAW_FILL Draw_Fill,
+                       DOT_PIXEL Dot_Pixel);
+
+  // Cache for opaque text, or nullptr
+  void LCD_SetGlyphCache(LCD_Glyph_Cache *Cache);
 
   // Display string
   void LCD_DisplayChar(LCD_POINT Xstart, LCD_POINT Ystart,
@@ -183,10 +442,27 @@ public:
                          const char *pString, sFONT *Font,
                          LCD_COLOR Color_Background,
                          LCD_COLOR Color_Foreground);
+  void LCD_DisplayChar(LCD_POINT Xstart, LCD_POINT Ystart,
+                       const char Acsii_Char, const sPFONT *Font,
+                       LCD_COLOR Color_Background, LCD_COLOR Color_Foreground);
+  void LCD_DisplayString(LCD_POINT Xstart, LCD_POINT Ystart,
+                         const char *pString, const sPFONT *Font,
+                         LCD_COLOR Color_Background,
+                         LCD_COLOR Color_Foreground);
+  // Lines measured by LCD_Text_Layout, aligned in the box at (Xstart, Ystart)
+  void LCD_DisplayText(LCD_POINT Xstart, LCD_POINT Ystart, const char *pString,
+                       const LCD_LAYOUT *Layout, sFONT *Font,
+                       LCD_COLOR Color_Background, LCD_COLOR Color_Foreground);
+  void LCD_DisplayText(LCD_POINT Xstart, LCD_POINT Ystart, const char *pString,
+                       const LCD_LAYOUT *Layout, const sPFONT *Font,
+                       LCD_COLOR Color_Background, LCD_COLOR Color_Foreground);
   void LCD_DisplayNum(LCD_POINT Xpoint, LCD_POINT Ypoint, int32_t Nummber,
                       sFONT *Font, LCD_COLOR Color_Background,
                       LCD_COLOR Color_Foreground);
   void LCD_Show(void);
+
+  // Command recorded by a LCD_Command_Writer
+  void LCD_Execute(const LCD_COMMAND *Command);
 };
 extern LCD_ST7735S LCD;
 #endif
@@ -0,0 +1,191 @@
+/***********************************************************************************************************************
+  | file      	:	LCD_Command.cpp
+  | function	:	Drawing calls recorded as commands
+***********************************************************************************************************************/
+
+#include "LCD_Command.h"
+
+#include <string.h>
+
+/*******************************************************************************
+function:
+                Copy a string too long for a command to the writer's text
+note:
+                Returns nullptr when the string fits the command, or the
+                writer keeps no text.
+*******************************************************************************/
+const char *LCD_Command_Writer::LCD_StoreText(const char *pString,
+                                              uint32_t *End) {
+  uint32_t Size = strlen(pString) + 1;
+  *End = 0;
+  if (Size <= LCD_COMMAND_TEXT) {
+    return nullptr;
+  }
+  char *Text = LCD_ReserveText(&Size, End);
+  if (Text) {
+    memcpy(Text, pString, Size - 1);
+    Text[Size - 1] = '\0';
+  }
+  return Text;
+}
+
+void LCD_Command_Writer::LCD_SetText(LCD_COMMAND *Command,
+                                     const char *pString,
+                                     const char *Long_Text, uint32_t End) {
+  Command->Long_Text = Long_Text;
+  Command->Text_End = End;
+  if (!Long_Text) {
+    strncpy(Command->Text, pString, LCD_COMMAND_TEXT - 1);
+    Command->Text[LCD_COMMAND_TEXT - 1] = '\0';
+  }
+}
+
+void LCD_Command_Writer::LCD_Init(LCD_SCAN_DIR Lcd_ScanDir) {
+  LCD_COMMAND *Command = LCD_Reserve();
+  Command->Op = LCD_OP_INIT;
+  Command->Style = Lcd_ScanDir;
+  LCD_Commit();
+}
+
+void LCD_Command_Writer::LCD_Clear(LCD_COLOR Color) {
+  LCD_COMMAND *Command = LCD_Reserve();
+  Command->Op = LCD_OP_CLEAR;
+  Command->Color = Color;
+  LCD_Commit();
+}
+
+void LCD_Command_Writer::LCD_SetArealColor(LCD_POINT Xstart, LCD_POINT Ystart,
+                                           LCD_POINT Xend, LCD_POINT Yend,
+                                           LCD_COLOR Color) {
+  LCD_COMMAND *Command = LCD_Reserve();
+  Command->Op = LCD_OP_FILL;
+  Command->X0 = Xstart;
+  Command->Y0 = Ystart;
+  Command->X1 = Xend;
+  Command->Y1 = Yend;
+  Command->Color = Color;
+  LCD_Commit();
+}
+
+void LCD_Command_Writer::LCD_DrawBitmap(LCD_POINT Xpoint, LCD_POINT Ypoint,
+                                        LCD_LENGTH Width, LCD_LENGTH Height,
+                                        const LCD_COLOR *Bitmap) {
+  LCD_COMMAND *Command = LCD_Reserve();
+  Command->Op = LCD_OP_BITMAP;
+  Command->X0 = Xpoint;
+  Command->Y0 = Ypoint;
+  Command->X1 = Width;
+  Command->Y1 = Height;
+  Command->Bitmap = Bitmap;
+  LCD_Commit();
+}
+
+void LCD_Command_Writer::LCD_DrawPoint(LCD_POINT Xpoint, LCD_POINT Ypoint,
+                                       LCD_COLOR Color, DOT_PIXEL Dot_Pixel,
+                                       DOT_STYLE Dot_FillWay) {
+  LCD_COMMAND *Command = LCD_Reserve();
+  Command->Op = LCD_OP_POINT;
+  Command->Style = Dot_FillWay;
+  Command->Dot_Pixel = Dot_Pixel;
+  Command->X0 = Xpoint;
+  Command->Y0 = Ypoint;
+  Command->Color = Color;
+  LCD_Commit();
+}
+
+void LCD_Command_Writer::LCD_DrawLine(LCD_POINT Xstart, LCD_POINT Ystart,
+                                      LCD_POINT Xend, LCD_POINT Yend,
+                                      LCD_COLOR Color, LINE_STYLE Line_Style,
+                                      DOT_PIXEL Dot_Pixel) {
+  LCD_COMMAND *Command = LCD_Reserve();
+  Command->Op = LCD_OP_LINE;
+  Command->Style = Line_Style;
+  Command->Dot_Pixel = Dot_Pixel;
+  Command->X0 = Xstart;
+  Command->Y0 = Ystart;
+  Command->X1 = Xend;
+  Command->Y1 = Yend;
+  Command->Color = Color;
+  LCD_Commit();
+}
+
+void LCD_Command_Writer::LCD_DrawRectangle(LCD_POINT Xstart, LCD_POINT Ystart,
+                                           LCD_POINT Xend, LCD_POINT Yend,
+                                           LCD_COLOR Color, DRAW_FILL Filled,
+                                           DOT_PIXEL Dot_Pixel) {
+  LCD_COMMAND *Command = LCD_Reserve();
+  Command->Op = LCD_OP_RECTANGLE;
+  Command->Style = Filled;
+  Command->Dot_Pixel = Dot_Pixel;
+  Command->X0 = Xstart;
+  Command->Y0 = Ystart;
+  Command->X1 = Xend;
+  Command->Y1 = Yend;
+  Command->Color = Color;
+  LCD_Commit();
+}
+
+void LCD_Command_Writer::LCD_DrawCircle(LCD_POINT X_Center, LCD_POINT Y_Center,
+                                        LCD_LENGTH Radius, LCD_COLOR Color,
+                                        DRAW_FILL Draw_Fill,
+                                        DOT_PIXEL Dot_Pixel) {
+  LCD_COMMAND *Command = LCD_Reserve();
+  Command->Op = LCD_OP_CIRCLE;
+  Command->Style = Draw_Fill;
+  Command->Dot_Pixel = Dot_Pixel;
+  Command->X0 = X_Center;
+  Command->Y0 = Y_Center;
+  Command->X1 = Radius;
+  Command->Color = Color;
+  LCD_Commit();
+}
+
+void LCD_Command_Writer::LCD_DisplayString(LCD_POINT Xstart, LCD_POINT Ystart,
+                                           const char *pString,
+                                           const sFONT *Font,
+                                           LCD_COLOR Color_Background,
+                                           LCD_COLOR Color_Foreground) {
+  uint32_t End;
+  const char *Long_Text = LCD_StoreText(pString, &End);
+  LCD_COMMAND *Command = LCD_Reserve();
+  Command->Op = LCD_OP_STRING;
+  Command->X0 = Xstart;
+  Command->Y0 = Ystart;
+  Command->Color = Color_Background;
+  Command->Color2 = Color_Foreground;
+  Command->Font = Font;
+  LCD_SetText(Command, pString, Long_Text, End);
+  LCD_Commit();
+}
+
+void LCD_Command_Writer::LCD_DisplayString(LCD_POINT Xstart, LCD_POINT Ystart,
+                                           const char *pString,
+                                           const sPFONT *Font,
+                                           LCD_COLOR Color_Background,
+                                           LCD_COLOR Color_Foreground) {
+  uint32_t End;
+  const char *Long_Text = LCD_StoreText(pString, &End);
+  LCD_COMMAND *Command = LCD_Reserve();
+  Command->Op = LCD_OP_PACKED_STRING;
+  Command->X0 = Xstart;
+  Command->Y0 = Ystart;
+  Command->Color = Color_Background;
+  Command->Color2 = Color_Foreground;
+  Command->Packed = Font;
+  LCD_SetText(Command, pString, Long_Text, End);
+  LCD_Commit();
+}
+
+void LCD_Command_Writer::LCD_Flush(void) {
+  LCD_COMMAND *Command = LCD_Reserve();
+  Command->Op = LCD_OP_FLUSH;
+  LCD_Commit();
+}
+
+void LCD_Command_Writer::LCD_Call(LCD_COMMAND_CALL Call, void *User_Data) {
+  LCD_COMMAND *Command = LCD_Reserve();
+  Command->Op = LCD_OP_CALL;
+  Command->Call = Call;
+  Command->User_Data = User_Data;
+  LCD_Commit();
+}
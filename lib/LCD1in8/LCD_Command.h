@@ -0,0 +1,123 @@
+#ifndef __LCD_COMMAND_H
+#define __LCD_COMMAND_H
+
+#include "LCD.h"
+
+#ifndef LCD_COMMAND_TEXT
+#define LCD_COMMAND_TEXT 28 // Characters of a string command, terminator included
+#endif
+
+/********************************************************************************
+  function:
+                        Drawing operations of a command
+********************************************************************************/
+typedef enum {
+  LCD_OP_INIT = 0,      // LCD_Init(Style)
+  LCD_OP_CLEAR,         // LCD_Clear(Color)
+  LCD_OP_FILL,          // LCD_SetArealColor
+  LCD_OP_BITMAP,        // LCD_DrawBitmap, X1/Y1 are the size
+  LCD_OP_POINT,         // LCD_DrawPoint, Style is the DOT_STYLE
+  LCD_OP_LINE,          // LCD_DrawLine, Style is the LINE_STYLE
+  LCD_OP_RECTANGLE,     // LCD_DrawRectangle, Style is the DRAW_FILL
+  LCD_OP_CIRCLE,        // LCD_DrawCircle, X1 is the radius
+  LCD_OP_STRING,        // LCD_DisplayString in a sFONT
+  LCD_OP_PACKED_STRING, // LCD_DisplayString in a sPFONT
+  LCD_OP_FLUSH,         // LCD_Flush
+  LCD_OP_CALL,          // Call(lcd, User_Data)
+} LCD_OP;
+
+typedef void (*LCD_COMMAND_CALL)(LCD_ST7735S *Lcd, void *User_Data);
+
+/********************************************************************************
+  function:
+                        One recorded drawing operation, run by LCD_Execute
+********************************************************************************/
+typedef struct _tCommand {
+  uint8_t Op;
+  uint8_t Style;     // Scan direction, dot or line style or fill of the Op
+  uint8_t Dot_Pixel; // DOT_PIXEL of the shapes
+  LCD_POINT X0;
+  LCD_POINT Y0;
+  LCD_POINT X1;
+  LCD_POINT Y1;
+  LCD_COLOR Color;  // Color, or the background of a string
+  LCD_COLOR Color2; // Foreground of a string
+  union {
+    const sFONT *Font;
+    const sPFONT *Packed;
+    const LCD_COLOR *Bitmap; // Must stay valid until the command has run
+    LCD_COMMAND_CALL Call;
+  };
+  void *User_Data;
+  char Text[LCD_COMMAND_TEXT];
+  const char *Long_Text; // Longer text, kept by the writer, or nullptr
+  uint32_t Text_End;     // Writer's arena position after Long_Text, or 0
+} LCD_COMMAND;
+
+// String of a string command
+static inline const char *LCD_CommandText(const LCD_COMMAND *Command) {
+  return Command->Long_Text ? Command->Long_Text : Command->Text;
+}
+
+/********************************************************************************
+  function:
+                        Records drawing calls as commands
+  note:
+                        The methods mirror the driver. Each fills the slot
+                        given by LCD_Reserve and hands it on with
+                        LCD_Commit. Strings are copied into the command;
+                        longer ones go to the writer's LCD_ReserveText, or
+                        are cut at LCD_COMMAND_TEXT - 1 characters when it
+                        has none. Bitmaps are not copied.
+********************************************************************************/
+class LCD_Command_Writer {
+  const char *LCD_StoreText(const char *pString, uint32_t *End);
+  void LCD_SetText(LCD_COMMAND *Command, const char *pString,
+                   const char *Long_Text, uint32_t End);
+
+protected:
+  virtual LCD_COMMAND *LCD_Reserve(void) = 0;
+  virtual void LCD_Commit(void) = 0;
+  // Room for *Size bytes of text outside of the command, before its
+  // LCD_Reserve. *Size may be cut, *End is passed on in Text_End
+  virtual char *LCD_ReserveText(uint32_t *Size, uint32_t *End) {
+    (void)Size;
+    (void)End;
+    return nullptr;
+  }
+
+public:
+  virtual ~LCD_Command_Writer() {}
+
+  void LCD_Init(LCD_SCAN_DIR Lcd_ScanDir);
+  void LCD_Clear(LCD_COLOR Color);
+  void LCD_SetArealColor(LCD_POINT Xstart, LCD_POINT Ystart, LCD_POINT Xend,
+                         LCD_POINT Yend, LCD_COLOR Color);
+  void LCD_DrawBitmap(LCD_POINT Xpoint, LCD_POINT Ypoint, LCD_LENGTH Width,
+                      LCD_LENGTH Height, const LCD_COLOR *Bitmap);
+  void LCD_DrawPoint(LCD_POINT Xpoint, LCD_POINT Ypoint, LCD_COLOR Color,
+                     DOT_PIXEL Dot_Pixel, DOT_STYLE Dot_FillWay);
+  void LCD_DrawLine(LCD_POINT Xstart, LCD_POINT Ystart, LCD_POINT Xend,
+                    LCD_POINT Yend, LCD_COLOR Color, LINE_STYLE Line_Style,
+                    DOT_PIXEL Dot_Pixel);
+  void LCD_DrawRectangle(LCD_POINT Xstart, LCD_POINT Ystart, LCD_POINT Xend,
+                         LCD_POINT Yend, LCD_COLOR Color, DRAW_FILL Filled,
+                         DOT_PIXEL Dot_Pixel);
+  void LCD_DrawCircle(LCD_POINT X_Center, LCD_POINT Y_Center, LCD_LENGTH Radius,
+                      LCD_COLOR Color, DRAW_FILL Draw_Fill,
+                      DOT_PIXEL Dot_Pixel);
+  // Strings of LCD_COMMAND_TEXT characters or more need LCD_ReserveText,
+  // a writer without it keeps only the first LCD_COMMAND_TEXT - 1 (27)
+  void LCD_DisplayString(LCD_POINT Xstart, LCD_POINT Ystart,
+                         const char *pString, const sFONT *Font,
+                         LCD_COLOR Color_Background,
+                         LCD_COLOR Color_Foreground);
+  void LCD_DisplayString(LCD_POINT Xstart, LCD_POINT Ystart,
+                         const char *pString, const sPFONT *Font,
+                         LCD_COLOR Color_Background,
+                         LCD_COLOR Color_Foreground);
+  void LCD_Flush(void);
+  // Anything else, run with the driver the commands are executed on
+  void LCD_Call(LCD_COMMAND_CALL Call, void *User_Data);
+};
+#endif
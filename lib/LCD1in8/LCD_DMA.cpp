@@ -0,0 +1,96 @@
+/***********************************************************************************************************************
+  | file      	:	LCD_DMA.cpp
+  | function	:	DMA completion and pins shared by the Pico transports
+***********************************************************************************************************************/
+
+#include "LCD_DMA.h"
+
+LCD_DMA_Transport *LCD_DMA_Transport::dma_owner[NUM_DMA_CHANNELS];
+
+/**
+ * @params pin_cs pico pin number to connect CS in LCD
+ * @params pin_dc pico pin number to connect DC in LCD
+ * @params pin_rst pico pin number to connect RST in LCD
+ * @params pin_bl pico pin number to connect BL in LCD
+ */
+LCD_DMA_Transport::LCD_DMA_Transport(uint pin_cs, uint pin_dc, uint pin_rst,
+                                     uint pin_bl) {
+  this->pin_cs = pin_cs;
+  this->pin_dc = pin_dc;
+  this->pin_rst = pin_rst;
+  this->pin_bl = pin_bl;
+  this->dma_fill_word = 0;
+  this->dma_busy = false;
+  this->dma_callback = nullptr;
+  this->dma_callback_data = nullptr;
+}
+
+void LCD_DMA_Transport::Write_RST(bool Val) { gpio_put(pin_rst, Val); }
+void LCD_DMA_Transport::Write_BL(bool Val) { gpio_put(pin_bl, Val); }
+void LCD_DMA_Transport::Delay_us(uint32_t Us) { sleep_us(Us); }
+uint64_t LCD_DMA_Transport::Time_us(void) { return time_us_64(); }
+
+/*******************************************************************************
+function:
+                Start streaming the same 16 bit data Count times
+note:
+                The DMA reads a single word with a fixed read address.
+                Returns immediately.
+*******************************************************************************/
+void LCD_DMA_Transport::StartRepeated(uint16_t Data, uint32_t Count,
+                                      LCD_CALLBACK Callback, void *User_Data) {
+  Wait();
+  dma_fill_word = Data;
+  LCD_StartDMA(&dma_fill_word, Count, false, Callback, User_Data);
+}
+
+/*******************************************************************************
+function:
+                Start streaming Count 16 bit words from Pixels
+*******************************************************************************/
+void LCD_DMA_Transport::StartPixels(const uint16_t *Pixels, uint32_t Count,
+                                    LCD_CALLBACK Callback, void *User_Data) {
+  LCD_StartDMA(Pixels, Count, true, Callback, User_Data);
+}
+
+bool LCD_DMA_Transport::Busy(void) { return dma_busy; }
+
+/*******************************************************************************
+function:
+                Mark the transfer as done and run its callback
+*******************************************************************************/
+void LCD_DMA_Transport::LCD_CompleteDMA(void) {
+  LCD_CALLBACK Callback = dma_callback;
+  void *User_Data = dma_callback_data;
+  dma_callback = nullptr;
+  dma_callback_data = nullptr;
+  dma_busy = false;
+  if (Callback) {
+    Callback(User_Data);
+  }
+}
+
+void LCD_DMA_Transport::LCD_DMA_IRQHandler(void) {
+  for (uint Chan = 0; Chan < NUM_DMA_CHANNELS; Chan++) {
+    if (dma_owner[Chan] && dma_channel_get_irq0_status(Chan)) {
+      dma_channel_acknowledge_irq0(Chan);
+      dma_owner[Chan]->LCD_FinishDMA();
+    }
+  }
+}
+
+/*******************************************************************************
+function:
+                Route the completion of DMA channel Chan to LCD_FinishDMA
+*******************************************************************************/
+void LCD_DMA_Transport::LCD_InstallDMAIRQ(uint Chan) {
+  static bool irq_installed = false;
+  dma_owner[Chan] = this;
+  dma_channel_set_irq0_enabled(Chan, true);
+  if (!irq_installed) {
+    irq_add_shared_handler(DMA_IRQ_0, LCD_DMA_IRQHandler,
+                           PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_0, true);
+    irq_installed = true;
+  }
+}
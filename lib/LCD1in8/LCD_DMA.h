@@ -0,0 +1,56 @@
+#ifndef __LCD_DMA_H
+#define __LCD_DMA_H
+
+#include "LCD_Transport.h"
+#include "pico/stdlib.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+
+/********************************************************************************
+  function:
+                        Common part of the Pico transports
+  note:
+                        Pixel bursts are fed by DMA. Their completion is
+                        signalled through DMA_IRQ_0, shared between all
+                        instances, and routed to LCD_FinishDMA of the owner
+                        of the channel.
+********************************************************************************/
+class LCD_DMA_Transport : public LCD_Transport {
+  static void LCD_DMA_IRQHandler(void);
+  static LCD_DMA_Transport *dma_owner[NUM_DMA_CHANNELS];
+
+  uint pin_rst;
+  uint pin_bl;
+
+protected:
+  virtual void LCD_StartDMA(const volatile void *Src, uint32_t Count,
+                            bool Increment, LCD_CALLBACK Callback,
+                            void *User_Data) = 0;
+  virtual void LCD_FinishDMA(void) = 0;
+  void LCD_CompleteDMA(void);
+  void LCD_InstallDMAIRQ(uint Chan);
+
+  uint pin_cs;
+  uint pin_dc;
+
+  // State of the running pixel transfer
+  uint16_t dma_fill_word;
+  volatile bool dma_busy;
+  LCD_CALLBACK dma_callback;
+  void *dma_callback_data;
+
+public:
+  LCD_DMA_Transport(uint pin_cs, uint pin_dc, uint pin_rst, uint pin_bl);
+
+  void StartRepeated(uint16_t Data, uint32_t Count, LCD_CALLBACK Callback,
+                     void *User_Data) override;
+  void StartPixels(const uint16_t *Pixels, uint32_t Count,
+                   LCD_CALLBACK Callback, void *User_Data) override;
+  bool Busy(void) override;
+
+  void Write_RST(bool Val) override;
+  void Write_BL(bool Val) override;
+  void Delay_us(uint32_t Us) override;
+  uint64_t Time_us(void) override;
+};
+#endif
@@ -0,0 +1,358 @@
+/***********************************************************************************************************************
+  | file      	:	LCD_DisplayList.cpp
+  | function	:	Recorded drawing commands, optimized before they are drawn
+***********************************************************************************************************************/
+
+#include "LCD_DisplayList.h"
+
+#include <string.h>
+
+/**
+ * @params lcd driver LCD_Submit draws on
+ * @params arena memory of the commands, must outlive the list
+ * @params capacity commands the arena holds
+ */
+LCD_Display_List::LCD_Display_List(LCD_ST7735S *lcd, LCD_LIST_ENTRY *arena,
+                                   uint32_t capacity) {
+  this->lcd = lcd;
+  this->arena = arena;
+  this->capacity = capacity;
+  this->count = 0;
+  this->optimized = true;
+  LCD_ResetStats();
+}
+
+LCD_COMMAND *LCD_Display_List::LCD_Reserve(void) {
+  if (count == capacity) {
+    LCD_Submit();
+    LCD_Reset();
+  }
+  return &arena[count].Command;
+}
+
+void LCD_Display_List::LCD_Commit(void) {
+  LCD_LIST_ENTRY *Entry = &arena[count++];
+  LCD_Bounds(Entry);
+  Entry->Dropped = false;
+  optimized = false;
+  stats.Recorded++;
+}
+
+/*******************************************************************************
+function:
+                Area a fill covers completely, false for anything else
+note:
+                Fills reaching past the display are not trusted, the
+                driver does not clip them.
+*******************************************************************************/
+static bool LCD_Cover(const LCD_LIST_ENTRY *Entry, LCD_RECT *Rect) {
+  const LCD_COMMAND *Command = &Entry->Command;
+  switch (Command->Op) {
+  case LCD_OP_CLEAR:
+    *Rect = Entry->Bounds;
+    return true;
+  case LCD_OP_FILL:
+    Rect->Xstart = Command->X0;
+    Rect->Ystart = Command->Y0;
+    Rect->Xend = Command->X1;
+    Rect->Yend = Command->Y1;
+    break;
+  case LCD_OP_BITMAP:
+    Rect->Xstart = Command->X0;
+    Rect->Ystart = Command->Y0;
+    Rect->Xend = Command->X0 + Command->X1;
+    Rect->Yend = Command->Y0 + Command->Y1;
+    break;
+  default:
+    return false;
+  }
+  return Rect->Xstart < Rect->Xend && Rect->Ystart < Rect->Yend &&
+         Rect->Xend <= sLCD_DIS.LCD_Dis_Column &&
+         Rect->Yend <= sLCD_DIS.LCD_Dis_Page;
+}
+
+static bool LCD_Empty(const LCD_RECT *Rect) {
+  return Rect->Xstart >= Rect->Xend || Rect->Ystart >= Rect->Yend;
+}
+
+static bool LCD_Inside(const LCD_RECT *Inner, const LCD_RECT *Outer) {
+  return LCD_Empty(Inner) ||
+         (Inner->Xstart >= Outer->Xstart && Inner->Xend <= Outer->Xend &&
+          Inner->Ystart >= Outer->Ystart && Inner->Yend <= Outer->Yend);
+}
+
+static bool LCD_Overlap(const LCD_RECT *A, const LCD_RECT *B) {
+  return !LCD_Empty(A) && !LCD_Empty(B) && A->Xstart < B->Xend &&
+         B->Xstart < A->Xend && A->Ystart < B->Yend && B->Ystart < A->Yend;
+}
+
+/*******************************************************************************
+function:
+                Pixels a command may touch
+note:
+                Shapes reach Dot_Pixel around their coordinates, strings
+                that wrap take the rest of the display below them.
+*******************************************************************************/
+void LCD_Display_List::LCD_Bounds(LCD_LIST_ENTRY *Entry) {
+  LCD_COMMAND *Command = &Entry->Command;
+  int32_t Column = sLCD_DIS.LCD_Dis_Column, Page = sLCD_DIS.LCD_Dis_Page;
+  int32_t X0 = 0, Y0 = 0, X1 = Column, Y1 = Page;
+  int32_t Dot = Command->Dot_Pixel;
+  Entry->Barrier = false;
+
+  // A filled rectangle on the display is the same fill
+  if (Command->Op == LCD_OP_RECTANGLE && Command->Style == DRAW_FULL &&
+      Command->X1 <= Column && Command->Y1 <= Page) {
+    Command->Op = LCD_OP_FILL;
+  }
+
+  switch (Command->Op) {
+  case LCD_OP_INIT:
+  case LCD_OP_FLUSH:
+  case LCD_OP_CALL:
+    Entry->Barrier = true;
+    break;
+  case LCD_OP_CLEAR:
+    break;
+  case LCD_OP_FILL:
+    X0 = Command->X0;
+    Y0 = Command->Y0;
+    X1 = Command->X1;
+    Y1 = Command->Y1;
+    break;
+  case LCD_OP_BITMAP:
+    X0 = Command->X0;
+    Y0 = Command->Y0;
+    X1 = Command->X0 + Command->X1;
+    Y1 = Command->Y0 + Command->Y1;
+    break;
+  case LCD_OP_POINT:
+    X0 = Command->X0 - Dot;
+    Y0 = Command->Y0 - Dot;
+    X1 = Command->X0 + Dot;
+    Y1 = Command->Y0 + Dot;
+    break;
+  case LCD_OP_LINE:
+  case LCD_OP_RECTANGLE:
+    X0 = (Command->X0 < Command->X1 ? Command->X0 : Command->X1) - Dot;
+    Y0 = (Command->Y0 < Command->Y1 ? Command->Y0 : Command->Y1) - Dot;
+    X1 = (Command->X0 < Command->X1 ? Command->X1 : Command->X0) + Dot;
+    Y1 = (Command->Y0 < Command->Y1 ? Command->Y1 : Command->Y0) + Dot;
+    break;
+  case LCD_OP_CIRCLE:
+    X0 = Command->X0 - Command->X1 - Dot;
+    Y0 = Command->Y0 - Command->X1 - Dot;
+    X1 = Command->X0 + Command->X1 + Dot;
+    Y1 = Command->Y0 + Command->X1 + Dot;
+    break;
+  case LCD_OP_STRING:
+  case LCD_OP_PACKED_STRING: {
+    int32_t Width = 0, Height;
+    const char *Text = LCD_CommandText(Command);
+    if (Command->Op == LCD_OP_STRING) {
+      Width = strlen(Text) * Command->Font->Width;
+      Height = Command->Font->Height;
+    } else {
+      for (const char *p = Text; *p != '\0'; p++) {
+        Width +=
+            Font_Advance(Command->Packed, Font_FindGlyph(Command->Packed, *p));
+      }
+      Height = Command->Packed->Height;
+    }
+    X0 = Command->X0;
+    Y0 = Command->Y0;
+    if (X0 + Width <= Column) {
+      X1 = X0 + Width;
+      Y1 = Y0 + Height;
+    }
+    break;
+  }
+  }
+
+  Entry->Bounds.Xstart = X0 < 0 ? 0 : X0 > Column ? Column : X0;
+  Entry->Bounds.Ystart = Y0 < 0 ? 0 : Y0 > Page ? Page : Y0;
+  Entry->Bounds.Xend = X1 < 0 ? 0 : X1 > Column ? Column : X1;
+  Entry->Bounds.Yend = Y1 < 0 ? 0 : Y1 > Page ? Page : Y1;
+}
+
+/*******************************************************************************
+function:
+                Drop the commands a later opaque fill paints over
+*******************************************************************************/
+void LCD_Display_List::LCD_Cull(void) {
+  for (uint32_t i = 0; i < count; i++) {
+    if (arena[i].Barrier) {
+      continue;
+    }
+    for (uint32_t j = i + 1; j < count && !arena[j].Barrier; j++) {
+      LCD_RECT Cover;
+      if (!arena[j].Dropped && LCD_Cover(&arena[j], &Cover) &&
+          LCD_Inside(&arena[i].Bounds, &Cover)) {
+        arena[i].Dropped = true;
+        stats.Culled++;
+        break;
+      }
+    }
+  }
+}
+
+/*******************************************************************************
+function:
+                Join fills of one color that share a whole edge
+note:
+                The earlier fill moves into the later one, so nothing drawn
+                between them may touch it.
+*******************************************************************************/
+void LCD_Display_List::LCD_Merge(void) {
+  bool Changed = true;
+  while (Changed) {
+    Changed = false;
+    for (uint32_t i = 0; i < count; i++) {
+      LCD_RECT A, B;
+      if (arena[i].Dropped || !LCD_Cover(&arena[i], &A) ||
+          arena[i].Command.Op != LCD_OP_FILL) {
+        continue;
+      }
+      for (uint32_t j = i + 1; j < count && !arena[j].Barrier; j++) {
+        LCD_COMMAND *Later = &arena[j].Command;
+        if (arena[j].Dropped || Later->Op != LCD_OP_FILL ||
+            Later->Color != arena[i].Command.Color ||
+            !LCD_Cover(&arena[j], &B)) {
+          continue;
+        }
+        bool Side = A.Ystart == B.Ystart && A.Yend == B.Yend &&
+                    (A.Xend == B.Xstart || B.Xend == A.Xstart);
+        bool Stacked = A.Xstart == B.Xstart && A.Xend == B.Xend &&
+                       (A.Yend == B.Ystart || B.Yend == A.Ystart);
+        if (!Side && !Stacked) {
+          continue;
+        }
+        bool Touched = false;
+        for (uint32_t k = i + 1; k < j && !Touched; k++) {
+          Touched = !arena[k].Dropped && LCD_Overlap(&arena[k].Bounds, &A);
+        }
+        if (Touched) {
+          continue;
+        }
+
+        Later->X0 = A.Xstart < B.Xstart ? A.Xstart : B.Xstart;
+        Later->Y0 = A.Ystart < B.Ystart ? A.Ystart : B.Ystart;
+        Later->X1 = A.Xend > B.Xend ? A.Xend : B.Xend;
+        Later->Y1 = A.Yend > B.Yend ? A.Yend : B.Yend;
+        LCD_Bounds(&arena[j]);
+        arena[i].Dropped = true;
+        stats.Merged++;
+        Changed = true;
+        break;
+      }
+    }
+  }
+}
+
+void LCD_Display_List::LCD_Compact(void) {
+  uint32_t Kept = 0;
+  for (uint32_t i = 0; i < count; i++) {
+    if (!arena[i].Dropped) {
+      arena[Kept++] = arena[i];
+    }
+  }
+  count = Kept;
+}
+
+/*******************************************************************************
+function:
+                Order the commands by the band of their top edge
+note:
+                A command only moves ahead of commands it does not overlap,
+                so the pixels end up the same.
+*******************************************************************************/
+void LCD_Display_List::LCD_Sort(void) {
+  for (uint32_t i = 1; i < count; i++) {
+    if (arena[i].Barrier) {
+      continue;
+    }
+    LCD_LIST_ENTRY Entry = arena[i];
+    uint32_t Band = Entry.Bounds.Ystart / LCD_LIST_BAND;
+    uint32_t k = i;
+    while (k > 0 && !arena[k - 1].Barrier &&
+           arena[k - 1].Bounds.Ystart / LCD_LIST_BAND > Band &&
+           !LCD_Overlap(&arena[k - 1].Bounds, &Entry.Bounds)) {
+      arena[k] = arena[k - 1];
+      k--;
+    }
+    if (k != i) {
+      arena[k] = Entry;
+      stats.Moved++;
+    }
+  }
+}
+
+void LCD_Display_List::LCD_Optimize(void) {
+  if (optimized) {
+    return;
+  }
+  LCD_Cull();
+  LCD_Merge();
+  LCD_Compact();
+  LCD_Sort();
+  optimized = true;
+}
+
+/*******************************************************************************
+function:
+                Optimize the list and draw it on the driver of the list
+*******************************************************************************/
+void LCD_Display_List::LCD_Submit(void) {
+  LCD_Optimize();
+  LCD_Replay(lcd);
+}
+
+/*******************************************************************************
+function:
+                Draw the list as it is on a driver
+*******************************************************************************/
+void LCD_Display_List::LCD_Replay(LCD_ST7735S *Lcd) {
+  for (uint32_t i = 0; i < count; i++) {
+    Lcd->LCD_Execute(&arena[i].Command);
+  }
+  stats.Drawn += count;
+}
+
+/*******************************************************************************
+function:
+                Draw the commands that may touch the rows [Ystart, Yend)
+note:
+                LCD_Init and LCD_Flush are left to the caller, who owns the
+                frame; LCD_Call may draw anywhere and runs for every band.
+*******************************************************************************/
+void LCD_Display_List::LCD_Replay(LCD_ST7735S *Lcd, LCD_POINT Ystart,
+                                  LCD_POINT Yend) {
+  for (uint32_t i = 0; i < count; i++) {
+    const LCD_LIST_ENTRY *Entry = &arena[i];
+    switch (Entry->Command.Op) {
+    case LCD_OP_INIT:
+    case LCD_OP_FLUSH:
+      continue;
+    case LCD_OP_CALL:
+      break;
+    default:
+      if (Entry->Bounds.Ystart >= Yend || Entry->Bounds.Yend <= Ystart ||
+          Entry->Bounds.Xstart >= Entry->Bounds.Xend) {
+        continue;
+      }
+    }
+    Lcd->LCD_Execute(&Entry->Command);
+    stats.Drawn++;
+  }
+}
+
+void LCD_Display_List::LCD_Reset(void) {
+  count = 0;
+  optimized = true;
+}
+
+uint32_t LCD_Display_List::LCD_Count(void) { return count; }
+
+const LCD_LIST_STATS *LCD_Display_List::LCD_GetStats(void) { return &stats; }
+
+void LCD_Display_List::LCD_ResetStats(void) { memset(&stats, 0, sizeof(stats)); }
@@ -0,0 +1,89 @@
+#ifndef __LCD_DISPLAYLIST_H
+#define __LCD_DISPLAYLIST_H
+
+#include "LCD_Command.h"
+
+#ifndef LCD_LIST_BAND
+#define LCD_LIST_BAND 16 // Rows of the screen bands the commands are sorted by
+#endif
+
+/********************************************************************************
+  function:
+                        Recorded command and the pixels it may touch
+********************************************************************************/
+typedef struct {
+  LCD_COMMAND Command;
+  LCD_RECT Bounds; // Clipped to the display, end coordinates exclusive
+  bool Barrier;    // Nothing is moved or culled across the command
+  bool Dropped;    // Removed by the optimizer
+} LCD_LIST_ENTRY;
+
+/********************************************************************************
+  function:
+                        Work of the optimizer since the last LCD_ResetStats
+********************************************************************************/
+typedef struct {
+  uint32_t Recorded; // Commands appended
+  uint32_t Culled;   // Commands hidden under a later opaque fill
+  uint32_t Merged;   // Fills joined to an adjacent one of the same color
+  uint32_t Moved;    // Commands sorted ahead of others into their band
+  uint32_t Drawn;    // Commands run on a display
+} LCD_LIST_STATS;
+
+/********************************************************************************
+  function:
+                        Retained list of drawing commands
+  note:
+                        The drawing methods of LCD_Command_Writer append to
+                        the arena. LCD_Submit optimizes the list and draws
+                        it; the list is kept, so LCD_Replay can draw it
+                        again, on any driver (e.g. the host emulator).
+                        The optimizer keeps what the screen shows:
+                        - a command whose bounds lie inside a later opaque
+                          fill (fill, filled rectangle, bitmap or clear) is
+                          dropped,
+                        - a fill and a later one of the same color sharing
+                          a whole edge become one, when nothing in between
+                          touches the earlier one,
+                        - commands are sorted by the screen band of their
+                          top, moving only past commands they do not
+                          overlap.
+                        LCD_Init, LCD_Flush and LCD_Call are barriers for
+                        all three. A full arena is submitted and emptied
+                        before the next command is appended.
+                        LCD_Replay with a band of rows only runs the
+                        commands that may touch it, for renderers that draw
+                        the screen one strip at a time.
+********************************************************************************/
+class LCD_Display_List : public LCD_Command_Writer {
+  LCD_ST7735S *lcd;
+  LCD_LIST_ENTRY *arena;
+  uint32_t capacity;
+  uint32_t count;
+  bool optimized;
+  LCD_LIST_STATS stats;
+
+  LCD_COMMAND *LCD_Reserve(void) override;
+  void LCD_Commit(void) override;
+
+  void LCD_Bounds(LCD_LIST_ENTRY *Entry);
+  void LCD_Cull(void);
+  void LCD_Merge(void);
+  void LCD_Sort(void);
+  void LCD_Compact(void);
+
+public:
+  LCD_Display_List(LCD_ST7735S *lcd, LCD_LIST_ENTRY *arena,
+                   uint32_t capacity);
+
+  void LCD_Optimize(void);
+  void LCD_Submit(void);
+  void LCD_Replay(LCD_ST7735S *Lcd);
+  void LCD_Replay(LCD_ST7735S *Lcd, LCD_POINT Ystart, LCD_POINT Yend);
+  void LCD_Reset(void);
+  uint32_t LCD_Count(void);
+
+  const LCD_LIST_STATS *LCD_GetStats(void);
+  void LCD_ResetStats(void);
+};
+#endif
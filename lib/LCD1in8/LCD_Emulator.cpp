@@ -0,0 +1,379 @@
+/***********************************************************************************************************************
+  | file      	:	LCD_Emulator.cpp
+  | function	:	ST7735S controller model for host builds
+***********************************************************************************************************************/
+
+#include "LCD_Emulator.h"
+
+#include <string.h>
+
+#define LCD_EMU_MADCTL_MY 0x80
+#define LCD_EMU_MADCTL_MX 0x40
+#define LCD_EMU_MADCTL_MV 0x20
+
+LCD_ST7735S_Emulator::LCD_ST7735S_Emulator(void) {
+  memset(gram, 0, sizeof(gram));
+  memset(&stats, 0, sizeof(stats));
+  LCD_OnReset();
+}
+
+/*******************************************************************************
+function:
+                Registers back to their reset values, the GRAM is kept
+*******************************************************************************/
+void LCD_ST7735S_Emulator::LCD_OnReset(void) {
+  madctl = 0x00;
+  colmod = 0x06;
+  reg = 0x00;
+  param_count = 0;
+  column_start = 0;
+  column_end = LCD_EMU_COLUMNS - 1;
+  row_start = 0;
+  row_end = LCD_EMU_ROWS - 1;
+  column = 0;
+  row = 0;
+  window_changed = true;
+  pixel_fill = 0;
+}
+
+void LCD_ST7735S_Emulator::LCD_OnCommand(uint8_t Reg) {
+  stats.Bytes++;
+  stats.Command_Bytes++;
+  stats.Commands++;
+
+  reg = Reg;
+  param_count = 0;
+  pixel_fill = 0;
+  switch (Reg) {
+  case 0x01: // SWRESET
+    LCD_OnReset();
+    break;
+  case 0x2C: // RAMWR
+    column = column_start;
+    row = row_start;
+    if (window_changed) {
+      stats.Windows++;
+      window_changed = false;
+    }
+    break;
+  default:
+    break;
+  }
+}
+
+void LCD_ST7735S_Emulator::LCD_OnData(const uint8_t *Data, uint32_t Len) {
+  stats.Bytes += Len;
+
+  if (reg != 0x2C) {
+    stats.Command_Bytes += Len;
+    for (uint32_t i = 0; i < Len; i++) {
+      if (param_count < sizeof(params)) {
+        params[param_count] = Data[i];
+      }
+      param_count++;
+      switch (reg) {
+      case 0x2A: // CASET
+        if (param_count == 4) {
+          column_start = (params[0] << 8) | params[1];
+          column_end = (params[2] << 8) | params[3];
+          window_changed = true;
+        }
+        break;
+      case 0x2B: // RASET
+        if (param_count == 4) {
+          row_start = (params[0] << 8) | params[1];
+          row_end = (params[2] << 8) | params[3];
+          window_changed = true;
+        }
+        break;
+      case 0x36: // MADCTL
+        if (param_count == 1) {
+          madctl = params[0];
+        }
+        break;
+      case 0x3A: // COLMOD
+        if (param_count == 1) {
+          colmod = params[0];
+        }
+        break;
+      default:
+        break;
+      }
+    }
+    return;
+  }
+
+  // RAMWR, pixels in the interface format selected by COLMOD
+  stats.Pixel_Bytes += Len;
+  for (uint32_t i = 0; i < Len; i++) {
+    pixel_bytes[pixel_fill++] = Data[i];
+    switch (colmod & 0x07) {
+    case 0x03: // 12 bit, two pixels in three bytes
+      if (pixel_fill == 3) {
+        uint8_t Nibble[6] = {
+            (uint8_t)(pixel_bytes[0] >> 4), (uint8_t)(pixel_bytes[0] & 0x0f),
+            (uint8_t)(pixel_bytes[1] >> 4), (uint8_t)(pixel_bytes[1] & 0x0f),
+            (uint8_t)(pixel_bytes[2] >> 4), (uint8_t)(pixel_bytes[2] & 0x0f)};
+        for (int p = 0; p < 6; p += 3) {
+          uint32_t Rgb666 = 0;
+          for (int c = 0; c < 3; c++) {
+            Rgb666 = (Rgb666 << 6) | (Nibble[p + c] << 2) | (Nibble[p + c] >> 2);
+          }
+          LCD_WritePixel(Rgb666);
+        }
+        pixel_fill = 0;
+      }
+      break;
+    case 0x05: // 16 bit RGB565
+      if (pixel_fill == 2) {
+        uint16_t Color = (pixel_bytes[0] << 8) | pixel_bytes[1];
+        uint32_t R = Color >> 11, G = (Color >> 5) & 0x3f, B = Color & 0x1f;
+        LCD_WritePixel((((R << 1) | (R >> 4)) << 12) | (G << 6) |
+                       ((B << 1) | (B >> 4)));
+        pixel_fill = 0;
+      }
+      break;
+    default: // 18 bit, one byte per component
+      if (pixel_fill == 3) {
+        LCD_WritePixel(((uint32_t)(pixel_bytes[0] >> 2) << 12) |
+                       ((uint32_t)(pixel_bytes[1] >> 2) << 6) |
+                       (pixel_bytes[2] >> 2));
+        pixel_fill = 0;
+      }
+      break;
+    }
+  }
+}
+
+/*******************************************************************************
+function:
+                Physical GRAM position of a column / row address
+parameter:
+                X, Y :   Receive the position, -1 when it is outside the GRAM
+note:
+                MV exchanges the two counters, MX and MY then mirror the
+                physical columns and rows.
+*******************************************************************************/
+void LCD_ST7735S_Emulator::LCD_MapAddress(uint16_t Column, uint16_t Row,
+                                          int *X, int *Y) {
+  int Px = Column, Py = Row;
+  if (madctl & LCD_EMU_MADCTL_MV) {
+    Px = Row;
+    Py = Column;
+  }
+  if (Px >= LCD_EMU_COLUMNS || Py >= LCD_EMU_ROWS) {
+    *X = -1;
+    *Y = -1;
+    return;
+  }
+  if (madctl & LCD_EMU_MADCTL_MX) {
+    Px = LCD_EMU_COLUMNS - 1 - Px;
+  }
+  if (madctl & LCD_EMU_MADCTL_MY) {
+    Py = LCD_EMU_ROWS - 1 - Py;
+  }
+  *X = Px;
+  *Y = Py;
+}
+
+/*******************************************************************************
+function:
+                Store a pixel at the address counter and advance it
+note:
+                A window whose end is below its start keeps writing at the
+                start address, as LCD_SetCursor relies on.
+*******************************************************************************/
+void LCD_ST7735S_Emulator::LCD_WritePixel(uint32_t Rgb666) {
+  stats.Pixels++;
+
+  int X, Y;
+  LCD_MapAddress(column, row, &X, &Y);
+  if (X >= 0) {
+    gram[Y][X] = Rgb666;
+  }
+
+  if (++column > column_end) {
+    column = column_start;
+    if (++row > row_end) {
+      row = row_start;
+    }
+  }
+}
+
+uint32_t LCD_ST7735S_Emulator::LCD_GetGram(uint16_t X, uint16_t Y) {
+  if (X >= LCD_EMU_COLUMNS || Y >= LCD_EMU_ROWS) {
+    return 0;
+  }
+  return gram[Y][X];
+}
+
+LCD_COLOR LCD_ST7735S_Emulator::LCD_GetPixel(LCD_POINT Xpoint,
+                                             LCD_POINT Ypoint) {
+  int X, Y;
+  LCD_MapAddress(Xpoint + sLCD_DIS.LCD_X_Adjust, Ypoint + sLCD_DIS.LCD_Y_Adjust,
+                 &X, &Y);
+  if (X < 0) {
+    return 0;
+  }
+  uint32_t Rgb666 = gram[Y][X];
+  return (((Rgb666 >> 13) & 0x1f) << 11) | (((Rgb666 >> 6) & 0x3f) << 5) |
+         ((Rgb666 >> 1) & 0x1f);
+}
+
+/*******************************************************************************
+function:
+                PNG chunk and zlib helpers, the image data is stored
+                without compression
+*******************************************************************************/
+static uint32_t LCD_Crc32(uint32_t Crc, const uint8_t *Data, size_t Len) {
+  static uint32_t Table[256];
+  if (Table[1] == 0) {
+    for (uint32_t n = 0; n < 256; n++) {
+      uint32_t c = n;
+      for (int k = 0; k < 8; k++) {
+        c = (c & 1) ? 0xedb88320u ^ (c >> 1) : c >> 1;
+      }
+      Table[n] = c;
+    }
+  }
+  Crc = ~Crc;
+  for (size_t i = 0; i < Len; i++) {
+    Crc = Table[(Crc ^ Data[i]) & 0xff] ^ (Crc >> 8);
+  }
+  return ~Crc;
+}
+
+static void LCD_PutBE32(uint8_t *Dst, uint32_t Val) {
+  Dst[0] = Val >> 24;
+  Dst[1] = Val >> 16;
+  Dst[2] = Val >> 8;
+  Dst[3] = Val;
+}
+
+static void LCD_WriteChunk(FILE *File, const char *Type,
+                           const std::vector<uint8_t> &Data) {
+  uint8_t Head[8];
+  LCD_PutBE32(Head, Data.size());
+  memcpy(Head + 4, Type, 4);
+  uint32_t Crc = LCD_Crc32(0, Head + 4, 4);
+  Crc = LCD_Crc32(Crc, Data.data(), Data.size());
+  uint8_t Tail[4];
+  LCD_PutBE32(Tail, Crc);
+  fwrite(Head, 1, 8, File);
+  fwrite(Data.data(), 1, Data.size(), File);
+  fwrite(Tail, 1, 4, File);
+}
+
+static void LCD_WritePNG(FILE *File, uint16_t Width, uint16_t Height,
+                         const std::vector<uint8_t> &Rgb) {
+  static const uint8_t Signature[8] = {0x89, 'P',  'N',  'G',
+                                       '\r', '\n', 0x1a, '\n'};
+  fwrite(Signature, 1, sizeof(Signature), File);
+
+  std::vector<uint8_t> Header(13, 0);
+  LCD_PutBE32(&Header[0], Width);
+  LCD_PutBE32(&Header[4], Height);
+  Header[8] = 8; // bit depth
+  Header[9] = 2; // truecolor
+  LCD_WriteChunk(File, "IHDR", Header);
+
+  // Scanlines with filter type 0
+  std::vector<uint8_t> Raw;
+  for (uint16_t y = 0; y < Height; y++) {
+    Raw.push_back(0);
+    Raw.insert(Raw.end(), Rgb.begin() + (size_t)y * Width * 3,
+               Rgb.begin() + (size_t)(y + 1) * Width * 3);
+  }
+
+  // zlib stream of stored deflate blocks
+  std::vector<uint8_t> Zlib = {0x78, 0x01};
+  size_t Pos = 0;
+  do {
+    size_t Len = Raw.size() - Pos < 65535 ? Raw.size() - Pos : 65535;
+    Zlib.push_back(Pos + Len == Raw.size() ? 1 : 0);
+    Zlib.push_back(Len & 0xff);
+    Zlib.push_back(Len >> 8);
+    Zlib.push_back(~Len & 0xff);
+    Zlib.push_back((~Len >> 8) & 0xff);
+    Zlib.insert(Zlib.end(), Raw.begin() + Pos, Raw.begin() + Pos + Len);
+    Pos += Len;
+  } while (Pos < Raw.size());
+  uint32_t A = 1, B = 0;
+  for (uint8_t Byte : Raw) {
+    A = (A + Byte) % 65521;
+    B = (B + A) % 65521;
+  }
+  Zlib.resize(Zlib.size() + 4);
+  LCD_PutBE32(&Zlib[Zlib.size() - 4], (B << 16) | A);
+  LCD_WriteChunk(File, "IDAT", Zlib);
+
+  LCD_WriteChunk(File, "IEND", std::vector<uint8_t>());
+}
+
+void LCD_ST7735S_Emulator::LCD_Save(const char *Path, LCD_EMU_FORMAT Format,
+                                    uint16_t Width, uint16_t Height,
+                                    bool View) {
+  std::vector<uint8_t> Rgb;
+  Rgb.reserve((size_t)Width * Height * 3);
+  for (uint16_t y = 0; y < Height; y++) {
+    for (uint16_t x = 0; x < Width; x++) {
+      uint32_t R, G, B;
+      if (View) {
+        LCD_COLOR Color = LCD_GetPixel(x, y);
+        R = Color >> 11;
+        G = (Color >> 5) & 0x3f;
+        B = Color & 0x1f;
+        R = (R << 3) | (R >> 2);
+        G = (G << 2) | (G >> 4);
+        B = (B << 3) | (B >> 2);
+      } else {
+        uint32_t Rgb666 = gram[y][x];
+        R = (Rgb666 >> 12) & 0x3f;
+        G = (Rgb666 >> 6) & 0x3f;
+        B = Rgb666 & 0x3f;
+        R = (R << 2) | (R >> 4);
+        G = (G << 2) | (G >> 4);
+        B = (B << 2) | (B >> 4);
+      }
+      Rgb.push_back(R);
+      Rgb.push_back(G);
+      Rgb.push_back(B);
+    }
+  }
+
+  FILE *File = fopen(Path, "wb");
+  if (!File) {
+    perror(Path);
+    return;
+  }
+  if (Format == LCD_EMU_PNG) {
+    LCD_WritePNG(File, Width, Height, Rgb);
+  } else {
+    fprintf(File, "P6\n%u %u\n255\n", Width, Height);
+    fwrite(Rgb.data(), 1, Rgb.size(), File);
+  }
+  fclose(File);
+}
+
+void LCD_ST7735S_Emulator::LCD_SaveGram(const char *Path,
+                                        LCD_EMU_FORMAT Format) {
+  LCD_Save(Path, Format, LCD_EMU_COLUMNS, LCD_EMU_ROWS, false);
+}
+
+void LCD_ST7735S_Emulator::LCD_SaveView(const char *Path,
+                                        LCD_EMU_FORMAT Format) {
+  LCD_Save(Path, Format, sLCD_DIS.LCD_Dis_Column, sLCD_DIS.LCD_Dis_Page, true);
+}
+
+const LCD_EMU_STATS *LCD_ST7735S_Emulator::LCD_GetStats(void) {
+  return &stats;
+}
+
+/*******************************************************************************
+function:
+                Start counting a new frame
+*******************************************************************************/
+void LCD_ST7735S_Emulator::LCD_ResetStats(void) {
+  memset(&stats, 0, sizeof(stats));
+  window_changed = true;
+}
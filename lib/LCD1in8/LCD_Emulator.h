@@ -0,0 +1,98 @@
+#ifndef __LCD_EMULATOR_H
+#define __LCD_EMULATOR_H
+
+#include "LCD.h"
+#include "LCD_Host.h"
+
+#define LCD_EMU_COLUMNS LCD_X_MAXPIXEL // GRAM columns
+#define LCD_EMU_ROWS LCD_Y_MAXPIXEL    // GRAM rows
+
+/********************************************************************************
+  function:
+                        Snapshot file formats
+********************************************************************************/
+typedef enum {
+  LCD_EMU_PPM = 0, // Binary PPM (P6)
+  LCD_EMU_PNG,     // PNG, uncompressed
+} LCD_EMU_FORMAT;
+
+/********************************************************************************
+  function:
+                        Traffic seen since the last LCD_ResetStats
+********************************************************************************/
+typedef struct {
+  uint64_t Bytes;         // All bytes, command bytes included
+  uint64_t Command_Bytes; // Register bytes and their parameters
+  uint64_t Pixel_Bytes;   // Bytes written to the GRAM
+  uint32_t Commands;      // Registers written
+  uint32_t Windows;       // CASET / RASET pairs (counted on RAMWR)
+  uint64_t Pixels;        // Pixels written to the GRAM
+} LCD_EMU_STATS;
+
+/********************************************************************************
+  function:
+                        Software model of the ST7735S controller
+  note:
+                        Listens to a LCD_Host_Transport and interprets
+                        CASET (0x2A), RASET (0x2B), RAMWR (0x2C), MADCTL
+                        (0x36) and COLMOD (0x3A, 12/16/18 bit) into the
+                        132 x 162 GRAM. Other registers are counted but
+                        have no effect; SWRESET and RST reset the model.
+                        Pixels are kept as 18 bit RGB666 like the
+                        controller does, a RGB565 pixel reads back exactly.
+                        The BGR bit of MADCTL is ignored: the GRAM holds
+                        the colors as written.
+********************************************************************************/
+class LCD_ST7735S_Emulator : public LCD_Host_Listener {
+  void LCD_MapAddress(uint16_t Column, uint16_t Row, int *X, int *Y);
+  void LCD_WritePixel(uint32_t Rgb666);
+  void LCD_Save(const char *Path, LCD_EMU_FORMAT Format, uint16_t Width,
+                uint16_t Height, bool View);
+
+  // GRAM, indexed by the physical row and column
+  uint32_t gram[LCD_EMU_ROWS][LCD_EMU_COLUMNS];
+
+  uint8_t madctl;
+  uint8_t colmod;
+
+  // Command being received and its parameters
+  uint8_t reg;
+  uint8_t param_count;
+  uint8_t params[4];
+
+  // Address window and counter
+  uint16_t column_start;
+  uint16_t column_end;
+  uint16_t row_start;
+  uint16_t row_end;
+  uint16_t column;
+  uint16_t row;
+  bool window_changed;
+
+  // Partial pixel of a RAMWR stream
+  uint8_t pixel_bytes[3];
+  uint8_t pixel_fill;
+
+  LCD_EMU_STATS stats;
+
+public:
+  LCD_ST7735S_Emulator(void);
+
+  void LCD_OnReset(void) override;
+  void LCD_OnCommand(uint8_t Reg) override;
+  void LCD_OnData(const uint8_t *Data, uint32_t Len) override;
+
+  // Physical GRAM pixel, RGB666 in bits 17..0
+  uint32_t LCD_GetGram(uint16_t X, uint16_t Y);
+  // Pixel (Xpoint, Ypoint) of the driver's view as RGB565, through the
+  // sLCD_DIS adjust offsets and the current MADCTL
+  LCD_COLOR LCD_GetPixel(LCD_POINT Xpoint, LCD_POINT Ypoint);
+
+  // Whole GRAM, or the LCD_Dis_Column x LCD_Dis_Page view of the driver
+  void LCD_SaveGram(const char *Path, LCD_EMU_FORMAT Format);
+  void LCD_SaveView(const char *Path, LCD_EMU_FORMAT Format);
+
+  const LCD_EMU_STATS *LCD_GetStats(void);
+  void LCD_ResetStats(void);
+};
+#endif
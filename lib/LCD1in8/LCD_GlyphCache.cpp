@@ -0,0 +1,110 @@
+/***********************************************************************************************************************
+  | file      	:	LCD_GlyphCache.cpp
+  | function	:	Cache of expanded character cells
+***********************************************************************************************************************/
+
+#include "LCD_GlyphCache.h"
+
+#include <string.h>
+
+/**
+ * @params pool memory of the cells, must outlive the cache
+ * @params pool_size size of pool in bytes
+ * @params slot_pixels pixels of the largest cell to cache
+ */
+LCD_Glyph_Cache::LCD_Glyph_Cache(LCD_COLOR *pool, uint32_t pool_size,
+                                 uint32_t slot_pixels) {
+  this->pool = pool;
+  this->slot_pixels = slot_pixels;
+  this->slots = slot_pixels ? pool_size / (slot_pixels * sizeof(LCD_COLOR)) : 0;
+  if (this->slots > LCD_GLYPH_CACHE_ENTRIES) {
+    this->slots = LCD_GLYPH_CACHE_ENTRIES;
+  }
+  this->clock = 0;
+  LCD_Clear();
+  LCD_ResetStats();
+}
+
+/*******************************************************************************
+function:
+                Next use stamp
+note:
+                When the clock wraps all cells become equally old.
+*******************************************************************************/
+uint32_t LCD_Glyph_Cache::LCD_Stamp(void) {
+  if (++clock == 0) {
+    for (uint32_t i = 0; i < slots; i++) {
+      if (entry[i].Last_Use) {
+        entry[i].Last_Use = 1;
+      }
+    }
+    clock = 2;
+  }
+  return clock;
+}
+
+const LCD_COLOR *LCD_Glyph_Cache::LCD_Find(const sFONT *Font, char Char,
+                                           LCD_COLOR Color_Background,
+                                           LCD_COLOR Color_Foreground) {
+  for (uint32_t i = 0; i < slots; i++) {
+    LCD_GLYPH_ENTRY *Entry = &entry[i];
+    if (Entry->Last_Use && Entry->Char == Char && Entry->Font == Font &&
+        Entry->Color_Background == Color_Background &&
+        Entry->Color_Foreground == Color_Foreground) {
+      Entry->Last_Use = LCD_Stamp();
+      stats.Hits++;
+      return &pool[i * slot_pixels];
+    }
+  }
+  stats.Misses++;
+  return nullptr;
+}
+
+/*******************************************************************************
+function:
+                Take a slot for a cell, a free one or the least recently used
+note:
+                Returns nullptr when the cell does not fit a slot. The slot
+                holds Font->Width x Font->Height pixels row by row.
+*******************************************************************************/
+LCD_COLOR *LCD_Glyph_Cache::LCD_Insert(const sFONT *Font, char Char,
+                                       LCD_COLOR Color_Background,
+                                       LCD_COLOR Color_Foreground) {
+  if (slots == 0 || (uint32_t)Font->Width * Font->Height > slot_pixels) {
+    return nullptr;
+  }
+
+  uint32_t Victim = 0;
+  for (uint32_t i = 0; i < slots; i++) {
+    if (entry[i].Last_Use < entry[Victim].Last_Use) {
+      Victim = i;
+    }
+  }
+  if (entry[Victim].Last_Use) {
+    stats.Evictions++;
+  }
+
+  LCD_GLYPH_ENTRY *Entry = &entry[Victim];
+  Entry->Font = Font;
+  Entry->Char = Char;
+  Entry->Color_Background = Color_Background;
+  Entry->Color_Foreground = Color_Foreground;
+  Entry->Last_Use = LCD_Stamp();
+  return &pool[Victim * slot_pixels];
+}
+
+/*******************************************************************************
+function:
+                Drop all cells, e.g. after changing a font table
+*******************************************************************************/
+void LCD_Glyph_Cache::LCD_Clear(void) {
+  memset(entry, 0, sizeof(entry));
+}
+
+uint32_t LCD_Glyph_Cache::LCD_Slots(void) { return slots; }
+
+const LCD_GLYPH_CACHE_STATS *LCD_Glyph_Cache::LCD_GetStats(void) {
+  return &stats;
+}
+
+void LCD_Glyph_Cache::LCD_ResetStats(void) { memset(&stats, 0, sizeof(stats)); }
@@ -0,0 +1,72 @@
+#ifndef __LCD_GLYPHCACHE_H
+#define __LCD_GLYPHCACHE_H
+
+#include "LCD.h"
+
+#ifndef LCD_GLYPH_CACHE_ENTRIES
+#define LCD_GLYPH_CACHE_ENTRIES 64 // Most cells kept, whatever the pool size
+#endif
+
+/********************************************************************************
+  function:
+                        Lookups since the last LCD_ResetStats
+********************************************************************************/
+typedef struct {
+  uint32_t Hits;      // Cell found
+  uint32_t Misses;    // Cell expanded from the font
+  uint32_t Evictions; // Cells dropped to make room
+} LCD_GLYPH_CACHE_STATS;
+
+/********************************************************************************
+  function:
+                        One cached cell
+********************************************************************************/
+typedef struct {
+  const sFONT *Font;
+  char Char;
+  LCD_COLOR Color_Background;
+  LCD_COLOR Color_Foreground;
+  uint32_t Last_Use; // Use stamp, 0 while the slot is free
+} LCD_GLYPH_ENTRY;
+
+/********************************************************************************
+  function:
+                        Expanded character cells, least recently used first out
+  note:
+                        The pool is split into slots of Slot_Pixels, one
+                        Width x Height cell of RGB565 pixels each, in the
+                        layout the driver sends them. Cells larger than a
+                        slot are not cached. Attach the cache with
+                        LCD_ST7735S::LCD_SetGlyphCache.
+********************************************************************************/
+class LCD_Glyph_Cache {
+protected:
+  LCD_COLOR *pool;
+  uint32_t slot_pixels;
+  uint32_t slots;
+  uint32_t clock;
+
+  LCD_GLYPH_ENTRY entry[LCD_GLYPH_CACHE_ENTRIES];
+  LCD_GLYPH_CACHE_STATS stats;
+
+  uint32_t LCD_Stamp(void);
+
+public:
+  LCD_Glyph_Cache(LCD_COLOR *pool, uint32_t pool_size,
+                  uint32_t slot_pixels = LCD_GLYPH_BUFFER);
+
+  // Cell of the character, or nullptr when it has to be expanded
+  const LCD_COLOR *LCD_Find(const sFONT *Font, char Char,
+                            LCD_COLOR Color_Background,
+                            LCD_COLOR Color_Foreground);
+  // Slot for a missed cell, to be filled by the caller, or nullptr
+  LCD_COLOR *LCD_Insert(const sFONT *Font, char Char,
+                        LCD_COLOR Color_Background,
+                        LCD_COLOR Color_Foreground);
+  void LCD_Clear(void);
+
+  uint32_t LCD_Slots(void);
+  const LCD_GLYPH_CACHE_STATS *LCD_GetStats(void);
+  void LCD_ResetStats(void);
+};
+#endif
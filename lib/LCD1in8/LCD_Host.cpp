@@ -0,0 +1,249 @@
+/***********************************************************************************************************************
+  | file      	:	LCD_Host.cpp
+  | function	:	Recording ST7735S bus for host builds
+***********************************************************************************************************************/
+
+#include "LCD_Host.h"
+
+#include <inttypes.h>
+
+/**
+ * @params baudrate simulated SCK frequency in Hz
+ */
+LCD_Host_Transport::LCD_Host_Transport(uint32_t baudrate) {
+  this->baudrate = baudrate;
+  this->now_ns = 0;
+  this->bytes = 0;
+  this->transactions = 0;
+  this->listener = nullptr;
+  this->pending = false;
+  this->pending_callback = nullptr;
+  this->pending_callback_data = nullptr;
+}
+
+void LCD_Host_Transport::Init(void) {}
+
+void LCD_Host_Transport::LCD_Record(LCD_HOST_OP Op, uint8_t Reg,
+                                    uint16_t Word, uint32_t Count,
+                                    uint32_t Offset) {
+  LCD_HOST_RECORD Record;
+  Record.Time_us = now_ns / 1000;
+  Record.Op = Op;
+  Record.Reg = Reg;
+  Record.Word = Word;
+  Record.Count = Count;
+  Record.Offset = Offset;
+  records.push_back(Record);
+}
+
+/*******************************************************************************
+function:
+                Account one CS low burst of Bytes on the simulated clock
+*******************************************************************************/
+void LCD_Host_Transport::LCD_Transfer(uint32_t Bytes) {
+  bytes += Bytes;
+  transactions++;
+  now_ns += (uint64_t)Bytes * 8 * 1000000000 / baudrate;
+}
+
+void LCD_Host_Transport::WriteCommand(uint8_t Reg, const uint8_t *Params,
+                                      uint8_t Len) {
+  Wait();
+  LCD_Record(LCD_HOST_COMMAND, Reg, 0, Len, byte_log.size());
+  byte_log.insert(byte_log.end(), Params, Params + Len);
+  LCD_Transfer(1 + Len);
+  if (listener) {
+    listener->LCD_OnCommand(Reg);
+    if (Len) {
+      listener->LCD_OnData(Params, Len);
+    }
+  }
+}
+
+void LCD_Host_Transport::WriteData(const uint8_t *Data, uint32_t Len) {
+  Wait();
+  LCD_Record(LCD_HOST_DATA, 0, 0, Len, byte_log.size());
+  byte_log.insert(byte_log.end(), Data, Data + Len);
+  LCD_Transfer(Len);
+  if (listener) {
+    listener->LCD_OnData(Data, Len);
+  }
+}
+
+/*******************************************************************************
+function:
+                Pass 16 bit words to the listener MSB first
+parameter:
+                Words  :   Words to send, a single word when Repeat is set
+                Count  :   Number of words sent
+                Repeat :   Send Words[0] Count times
+*******************************************************************************/
+void LCD_Host_Transport::LCD_SendWords(const uint16_t *Words, uint32_t Count,
+                                       bool Repeat) {
+  uint8_t Buffer[256];
+  uint32_t Fill = 0;
+  for (uint32_t i = 0; i < Count; i++) {
+    uint16_t Word = Repeat ? Words[0] : Words[i];
+    Buffer[Fill++] = Word >> 8;
+    Buffer[Fill++] = Word & 0xff;
+    if (Fill == sizeof(Buffer)) {
+      listener->LCD_OnData(Buffer, Fill);
+      Fill = 0;
+    }
+  }
+  if (Fill) {
+    listener->LCD_OnData(Buffer, Fill);
+  }
+}
+
+/*******************************************************************************
+function:
+                Leave a started transfer waiting for its completion
+*******************************************************************************/
+void LCD_Host_Transport::LCD_Start(LCD_CALLBACK Callback, void *User_Data) {
+  pending = true;
+  pending_callback = Callback;
+  pending_callback_data = User_Data;
+}
+
+void LCD_Host_Transport::StartRepeated(uint16_t Data, uint32_t Count,
+                                       LCD_CALLBACK Callback,
+                                       void *User_Data) {
+  Wait();
+  LCD_Record(LCD_HOST_REPEATED, 0, Data, Count, 0);
+  LCD_Transfer(Count * 2);
+  if (listener) {
+    LCD_SendWords(&Data, Count, true);
+  }
+  LCD_Start(Callback, User_Data);
+}
+
+void LCD_Host_Transport::StartPixels(const uint16_t *Pixels, uint32_t Count,
+                                     LCD_CALLBACK Callback, void *User_Data) {
+  Wait();
+  LCD_Record(LCD_HOST_PIXELS, 0, 0, Count, 0);
+  LCD_Transfer(Count * 2);
+  if (listener) {
+    LCD_SendWords(Pixels, Count, false);
+  }
+  LCD_Start(Callback, User_Data);
+}
+
+/*******************************************************************************
+function:
+                Complete the running transfer
+note:
+                The callback may start the next transfer (a flush chain),
+                which is completed in turn.
+*******************************************************************************/
+void LCD_Host_Transport::Wait(void) {
+  while (pending) {
+    LCD_CALLBACK Callback = pending_callback;
+    void *User_Data = pending_callback_data;
+    pending = false;
+    pending_callback = nullptr;
+    pending_callback_data = nullptr;
+    if (Callback) {
+      Callback(User_Data);
+    }
+  }
+}
+
+bool LCD_Host_Transport::Busy(void) {
+  Wait();
+  return false;
+}
+
+void LCD_Host_Transport::Write_RST(bool Val) {
+  Wait();
+  LCD_Record(LCD_HOST_RESET, 0, 0, Val, 0);
+  if (listener && !Val) {
+    listener->LCD_OnReset();
+  }
+}
+
+void LCD_Host_Transport::Write_BL(bool Val) {
+  Wait();
+  LCD_Record(LCD_HOST_BACKLIGHT, 0, 0, Val, 0);
+}
+
+void LCD_Host_Transport::Delay_us(uint32_t Us) {
+  Wait();
+  LCD_Record(LCD_HOST_DELAY, 0, 0, Us, 0);
+  now_ns += (uint64_t)Us * 1000;
+}
+
+uint64_t LCD_Host_Transport::Time_us(void) { return now_ns / 1000; }
+
+const std::vector<LCD_HOST_RECORD> &LCD_Host_Transport::LCD_GetRecords(void) {
+  return records;
+}
+
+const uint8_t *LCD_Host_Transport::LCD_GetBytes(const LCD_HOST_RECORD *Record) {
+  return byte_log.data() + Record->Offset;
+}
+
+void LCD_Host_Transport::LCD_SetListener(LCD_Host_Listener *Listener) {
+  Wait();
+  listener = Listener;
+}
+
+uint64_t LCD_Host_Transport::LCD_ByteCount(void) { return bytes; }
+
+uint32_t LCD_Host_Transport::LCD_TransactionCount(void) {
+  return transactions;
+}
+
+/*******************************************************************************
+function:
+                Forget the recorded transactions and counters, the clock
+                keeps running
+*******************************************************************************/
+void LCD_Host_Transport::LCD_ClearRecords(void) {
+  Wait();
+  records.clear();
+  byte_log.clear();
+  bytes = 0;
+  transactions = 0;
+}
+
+/*******************************************************************************
+function:
+                Print the recorded transactions, one per line
+*******************************************************************************/
+void LCD_Host_Transport::LCD_Dump(FILE *File) {
+  for (const LCD_HOST_RECORD &Record : records) {
+    fprintf(File, "%10" PRIu64 " us  ", Record.Time_us);
+    switch (Record.Op) {
+    case LCD_HOST_COMMAND:
+    case LCD_HOST_DATA: {
+      if (Record.Op == LCD_HOST_COMMAND) {
+        fprintf(File, "CMD  %02X", Record.Reg);
+      } else {
+        fprintf(File, "DATA   ");
+      }
+      const uint8_t *Data = LCD_GetBytes(&Record);
+      for (uint32_t i = 0; i < Record.Count; i++) {
+        fprintf(File, " %02X", Data[i]);
+      }
+      fprintf(File, "\n");
+      break;
+    }
+    case LCD_HOST_REPEATED:
+      fprintf(File, "FILL %04X x %u\n", Record.Word, Record.Count);
+      break;
+    case LCD_HOST_PIXELS:
+      fprintf(File, "PIXELS %u\n", Record.Count);
+      break;
+    case LCD_HOST_RESET:
+      fprintf(File, "RST  %u\n", Record.Count);
+      break;
+    case LCD_HOST_BACKLIGHT:
+      fprintf(File, "BL   %u\n", Record.Count);
+      break;
+    case LCD_HOST_DELAY:
+      fprintf(File, "WAIT %u us\n", Record.Count);
+      break;
+    }
+  }
+}
@@ -0,0 +1,111 @@
+#ifndef __LCD_HOST_H
+#define __LCD_HOST_H
+
+#include "LCD_Transport.h"
+
+#include <stdio.h>
+#include <vector>
+
+/********************************************************************************
+  function:
+                        Kind of a recorded transaction
+********************************************************************************/
+typedef enum {
+  LCD_HOST_COMMAND = 0, // Register and its parameters
+  LCD_HOST_DATA,        // Data bytes
+  LCD_HOST_REPEATED,    // Repeated data word
+  LCD_HOST_PIXELS,      // Pixel burst
+  LCD_HOST_RESET,       // RST line written
+  LCD_HOST_BACKLIGHT,   // BL line written
+  LCD_HOST_DELAY,       // Delay_us
+} LCD_HOST_OP;
+
+/********************************************************************************
+  function:
+                        One recorded transaction
+********************************************************************************/
+typedef struct {
+  uint64_t Time_us;  // Start on the simulated clock
+  LCD_HOST_OP Op;
+  uint8_t Reg;       // LCD_HOST_COMMAND: register
+  uint16_t Word;     // LCD_HOST_REPEATED: data word
+  uint32_t Count;    // Parameter/data bytes, data words, line level or us
+  uint32_t Offset;   // LCD_HOST_COMMAND/DATA: first byte in the byte log
+} LCD_HOST_RECORD;
+
+/********************************************************************************
+  function:
+                        Receiver of the byte stream seen by the panel
+********************************************************************************/
+class LCD_Host_Listener {
+public:
+  virtual ~LCD_Host_Listener() {}
+  virtual void LCD_OnReset(void) = 0;                          // RST low
+  virtual void LCD_OnCommand(uint8_t Reg) = 0;                 // DC low
+  virtual void LCD_OnData(const uint8_t *Data, uint32_t Len) = 0; // DC high
+};
+
+/********************************************************************************
+  function:
+                        Host side transport recording every transaction
+  note:
+                        Nothing is sent anywhere. Time is simulated: every
+                        byte advances the clock by 8 bit times at baudrate
+                        and Delay_us advances it without sleeping, so a run
+                        of the driver (initialization included) takes no
+                        wall time and its bus time can be read back.
+                        Transfers complete when Wait or Busy is called, the
+                        way the DMA interrupt would complete them, so the
+                        asynchronous paths of the driver run unchanged.
+********************************************************************************/
+class LCD_Host_Transport : public LCD_Transport {
+  void LCD_Record(LCD_HOST_OP Op, uint8_t Reg, uint16_t Word, uint32_t Count,
+                  uint32_t Offset);
+  void LCD_Transfer(uint32_t Bytes);
+  void LCD_Start(LCD_CALLBACK Callback, void *User_Data);
+  void LCD_SendWords(const uint16_t *Words, uint32_t Count, bool Repeat);
+
+  uint32_t baudrate;
+  uint64_t now_ns;
+
+  std::vector<LCD_HOST_RECORD> records;
+  std::vector<uint8_t> byte_log;
+  uint64_t bytes;
+  uint32_t transactions;
+  LCD_Host_Listener *listener;
+
+  // Transfer waiting for its completion
+  bool pending;
+  LCD_CALLBACK pending_callback;
+  void *pending_callback_data;
+
+public:
+  LCD_Host_Transport(uint32_t baudrate = 62500000);
+
+  void Init(void) override;
+  void WriteCommand(uint8_t Reg, const uint8_t *Params, uint8_t Len) override;
+  void WriteData(const uint8_t *Data, uint32_t Len) override;
+  void StartRepeated(uint16_t Data, uint32_t Count, LCD_CALLBACK Callback,
+                     void *User_Data) override;
+  void StartPixels(const uint16_t *Pixels, uint32_t Count,
+                   LCD_CALLBACK Callback, void *User_Data) override;
+  bool Busy(void) override;
+  void Wait(void) override;
+
+  void Write_RST(bool Val) override;
+  void Write_BL(bool Val) override;
+  void Delay_us(uint32_t Us) override;
+  uint64_t Time_us(void) override;
+
+  // Recorded transactions, parameter and data bytes in LCD_GetBytes
+  const std::vector<LCD_HOST_RECORD> &LCD_GetRecords(void);
+  const uint8_t *LCD_GetBytes(const LCD_HOST_RECORD *Record);
+  uint64_t LCD_ByteCount(void);        // Bytes sent, commands included
+  uint32_t LCD_TransactionCount(void); // CS low bursts
+  void LCD_ClearRecords(void);
+  void LCD_Dump(FILE *File);
+
+  // Forward the byte stream to Listener (an emulated panel), or nullptr
+  void LCD_SetListener(LCD_Host_Listener *Listener);
+};
+#endif
@@ -0,0 +1,97 @@
+#ifndef __LCD_INITTABLE_H
+#define __LCD_INITTABLE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/********************************************************************************
+  function:
+                        Command table format
+  note:
+                        A table is a flat byte array of entries
+                          Reg, Len [| LCD_CMD_DELAY], Params[Len], [Delay_ms]
+                        terminated by LCD_CMD_END. Every entry is sent as one
+                        CS-low burst by LCD_ST7735S::LCD_WriteCommandTable.
+********************************************************************************/
+#define LCD_CMD_END 0x00   // NOP, never needed in a table, ends it
+#define LCD_CMD_DELAY 0x80 // Len flag: a delay in ms follows the params
+
+// Checks at compile time that every entry fits and the table is terminated
+constexpr bool LCD_CommandTableValid(const uint8_t *Table, size_t Size) {
+  size_t i = 0;
+  while (i < Size && Table[i] != LCD_CMD_END) {
+    if (i + 1 >= Size) {
+      return false;
+    }
+    uint8_t Len = Table[i + 1];
+    i += 2 + (Len & ~LCD_CMD_DELAY) + ((Len & LCD_CMD_DELAY) ? 1 : 0);
+  }
+  return i == Size - 1;
+}
+
+/********************************************************************************
+  function:
+                        ST7735S register initialization
+********************************************************************************/
+static constexpr uint8_t LCD_InitTable_ST7735S[] = {
+    // ST7735R Frame Rate
+    0xB1, 3, 0x01, 0x2C, 0x2D,
+    0xB2, 3, 0x01, 0x2C, 0x2D,
+    0xB3, 6, 0x01, 0x2C, 0x2D, 0x01, 0x2C, 0x2D,
+    0xB4, 1, 0x07, // Column inversion
+
+    // ST7735R Power Sequence
+    0xC0, 3, 0xA2, 0x02, 0x84,
+    0xC1, 1, 0xC5,
+    0xC2, 2, 0x0A, 0x00,
+    0xC3, 2, 0x8A, 0x2A,
+    0xC4, 2, 0x8A, 0xEE,
+    0xC5, 1, 0x0E, // VCOM
+
+    // ST7735R Gamma Sequence
+    0xe0, 16, 0x0f, 0x1a, 0x0f, 0x18, 0x2f, 0x28, 0x20, 0x22,
+              0x1f, 0x1b, 0x23, 0x37, 0x00, 0x07, 0x02, 0x10,
+    0xe1, 16, 0x0f, 0x1b, 0x0f, 0x17, 0x33, 0x2c, 0x29, 0x2e,
+              0x30, 0x30, 0x39, 0x3f, 0x00, 0x07, 0x03, 0x10,
+
+    0xF0, 1, 0x01, // Enable test command
+    0xF6, 1, 0x00, // Disable ram power save mode
+    0x3A, 1, 0x05, // 65k mode
+    LCD_CMD_END,
+};
+static_assert(LCD_CommandTableValid(LCD_InitTable_ST7735S,
+                                    sizeof(LCD_InitTable_ST7735S)),
+              "malformed LCD_InitTable_ST7735S");
+
+/********************************************************************************
+  function:
+                        Leave sleep mode and turn the display on
+  note:
+                        Sleep Out must not be sent within LCD_RESET_SLPOUT_US
+                        of the hardware reset, LCD_Init takes care of that
+********************************************************************************/
+static constexpr uint8_t LCD_PowerOnTable_ST7735S[] = {
+    0x11, 0 | LCD_CMD_DELAY, 5, // sleep out, 5ms before the next command
+    0x29, 0,                    // Turn on the LCD display
+    LCD_CMD_END,
+};
+static_assert(LCD_CommandTableValid(LCD_PowerOnTable_ST7735S,
+                                    sizeof(LCD_PowerOnTable_ST7735S)),
+              "malformed LCD_PowerOnTable_ST7735S");
+
+/********************************************************************************
+  function:
+                        Tables of the selected panel
+  note:
+                        A panel variant supplies its own tables here, next to
+                        its LCD_1INxx define in LCD.h
+********************************************************************************/
+#if defined(LCD_1IN44)
+#define LCD_INIT_TABLE LCD_InitTable_ST7735S
+#define LCD_POWERON_TABLE LCD_PowerOnTable_ST7735S
+#elif defined(LCD_1IN8)
+#define LCD_INIT_TABLE LCD_InitTable_ST7735S
+#define LCD_POWERON_TABLE LCD_PowerOnTable_ST7735S
+#endif
+
+#endif
@@ -0,0 +1,170 @@
+/***********************************************************************************************************************
+  | file      	:	LCD_Layout.cpp
+  | function	:	Line breaking, alignment and measuring of strings
+***********************************************************************************************************************/
+
+#include "LCD_Layout.h"
+
+#include <string.h>
+
+LCD_Text_Layout::LCD_Text_Layout(void) {
+  this->clock = 0;
+  memset(&this->scratch, 0, sizeof(this->scratch));
+  LCD_Clear();
+}
+
+/*******************************************************************************
+function:
+                Forget the cached layouts, e.g. after changing a font
+*******************************************************************************/
+void LCD_Text_Layout::LCD_Clear(void) { memset(entry, 0, sizeof(entry)); }
+
+const LCD_LAYOUT *LCD_Text_Layout::LCD_Measure(const char *pString,
+                                               const sFONT *Font,
+                                               LCD_LENGTH Max_Width,
+                                               LCD_ALIGN Align) {
+  return LCD_Layout(pString, Font, nullptr, Max_Width, Align);
+}
+
+const LCD_LAYOUT *LCD_Text_Layout::LCD_Measure(const char *pString,
+                                               const sPFONT *Font,
+                                               LCD_LENGTH Max_Width,
+                                               LCD_ALIGN Align) {
+  return LCD_Layout(pString, nullptr, Font, Max_Width, Align);
+}
+
+/*******************************************************************************
+function:
+                Layout from the cache, or broken into a free or the least
+                recently used entry
+*******************************************************************************/
+const LCD_LAYOUT *LCD_Text_Layout::LCD_Layout(const char *pString,
+                                              const sFONT *Table,
+                                              const sPFONT *Packed,
+                                              LCD_LENGTH Max_Width,
+                                              LCD_ALIGN Align) {
+  const void *Font = Table ? (const void *)Table : (const void *)Packed;
+  size_t Length = strlen(pString);
+  if (Length >= LCD_LAYOUT_TEXT) {
+    LCD_Break(&scratch, pString, Table, Packed, Max_Width, Align);
+    return &scratch;
+  }
+
+  if (++clock == 0) {
+    // All entries become equally old
+    for (uint32_t i = 0; i < LCD_LAYOUT_CACHE; i++) {
+      if (entry[i].Last_Use) {
+        entry[i].Last_Use = 1;
+      }
+    }
+    clock = 2;
+  }
+
+  uint32_t Victim = 0;
+  for (uint32_t i = 0; i < LCD_LAYOUT_CACHE; i++) {
+    LCD_LAYOUT_ENTRY *Entry = &entry[i];
+    if (Entry->Last_Use && Entry->Font == Font &&
+        Entry->Max_Width == Max_Width && Entry->Align == Align &&
+        strcmp(Entry->Text, pString) == 0) {
+      Entry->Last_Use = clock;
+      return &Entry->Layout;
+    }
+    if (Entry->Last_Use < entry[Victim].Last_Use) {
+      Victim = i;
+    }
+  }
+
+  LCD_LAYOUT_ENTRY *Entry = &entry[Victim];
+  memcpy(Entry->Text, pString, Length + 1);
+  Entry->Font = Font;
+  Entry->Max_Width = Max_Width;
+  Entry->Align = Align;
+  Entry->Last_Use = clock;
+  LCD_Break(&Entry->Layout, pString, Table, Packed, Max_Width, Align);
+  return &Entry->Layout;
+}
+
+static LCD_LENGTH LCD_Advance(const sFONT *Table, const sPFONT *Packed,
+                              char Char) {
+  if (Table) {
+    return Table->Width;
+  }
+  return Font_Advance(Packed, Font_FindGlyph(Packed, Char));
+}
+
+/*******************************************************************************
+function:
+                Break a string into lines and align them
+*******************************************************************************/
+void LCD_Text_Layout::LCD_Break(LCD_LAYOUT *Layout, const char *pString,
+                                const sFONT *Table, const sPFONT *Packed,
+                                LCD_LENGTH Max_Width, LCD_ALIGN Align) {
+  uint32_t i = 0;
+  Layout->Lines = 0;
+  Layout->Width = 0;
+  Layout->Line_Height = Table ? Table->Height : Packed->Height;
+
+  while (pString[i] != '\0' && Layout->Lines < LCD_LAYOUT_LINES) {
+    uint32_t Start = i, End;
+    uint32_t Width = 0;
+    uint32_t Break = Start, Break_Width = 0;
+    bool Wrapped = false;
+
+    while (pString[i] != '\0' && pString[i] != '\n') {
+      LCD_LENGTH Advance = LCD_Advance(Table, Packed, pString[i]);
+      if (Max_Width && Width + Advance > Max_Width && i > Start) {
+        // A space that does not fit breaks the line right there
+        if (pString[i] == ' ') {
+          Break = i;
+          Break_Width = Width;
+        }
+        Wrapped = true;
+        break;
+      }
+      if (pString[i] == ' ' && i > Start) {
+        Break = i;
+        Break_Width = Width;
+      }
+      Width += Advance;
+      i++;
+    }
+    End = i;
+
+    if (Wrapped) {
+      // Before the word that did not fit, unless it fills the line alone
+      if (Break > Start) {
+        End = Break;
+        Width = Break_Width;
+        i = Break;
+      }
+      while (End > Start && pString[End - 1] == ' ') {
+        End--;
+        Width -= LCD_Advance(Table, Packed, ' ');
+      }
+      while (pString[i] == ' ') {
+        i++;
+      }
+    } else if (pString[i] == '\n') {
+      i++;
+    }
+
+    LCD_LAYOUT_LINE *Line = &Layout->Line[Layout->Lines++];
+    Line->Start = Start;
+    Line->Length = End - Start;
+    Line->Width = Width;
+    if (Width > Layout->Width) {
+      Layout->Width = Width;
+    }
+  }
+
+  Layout->Height = Layout->Lines * Layout->Line_Height;
+  Layout->Box_Width = Max_Width ? Max_Width : Layout->Width;
+  for (uint8_t n = 0; n < Layout->Lines; n++) {
+    LCD_LAYOUT_LINE *Line = &Layout->Line[n];
+    LCD_LENGTH Space =
+        Layout->Box_Width > Line->Width ? Layout->Box_Width - Line->Width : 0;
+    Line->X = Align == LCD_ALIGN_RIGHT    ? Space
+              : Align == LCD_ALIGN_CENTER ? Space / 2
+                                          : 0;
+  }
+}
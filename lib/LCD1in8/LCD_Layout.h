@@ -0,0 +1,99 @@
+#ifndef __LCD_LAYOUT_H
+#define __LCD_LAYOUT_H
+
+#include "LCD.h"
+
+#ifndef LCD_LAYOUT_LINES
+#define LCD_LAYOUT_LINES 8 // Lines of a layout, the rest is dropped
+#endif
+#ifndef LCD_LAYOUT_CACHE
+#define LCD_LAYOUT_CACHE 4 // Layouts kept for strings drawn again
+#endif
+#ifndef LCD_LAYOUT_TEXT
+#define LCD_LAYOUT_TEXT 48 // Longest string kept, terminator included
+#endif
+
+/********************************************************************************
+  function:
+                        Horizontal alignment of the lines in their box
+********************************************************************************/
+typedef enum {
+  LCD_ALIGN_LEFT = 0,
+  LCD_ALIGN_CENTER,
+  LCD_ALIGN_RIGHT,
+} LCD_ALIGN;
+
+/********************************************************************************
+  function:
+                        One line of a layout
+********************************************************************************/
+typedef struct {
+  uint16_t Start;   // First character in the string
+  uint16_t Length;  // Characters drawn
+  LCD_POINT X;      // Position in the box
+  LCD_LENGTH Width; // Sum of the advances
+} LCD_LAYOUT_LINE;
+
+/********************************************************************************
+  function:
+                        Lines of a string broken and aligned in a box
+********************************************************************************/
+typedef struct _tLayout {
+  LCD_LENGTH Width;       // Widest line
+  LCD_LENGTH Height;      // Lines * Line_Height
+  LCD_LENGTH Box_Width;   // Width the lines are aligned in
+  LCD_LENGTH Line_Height;
+  uint8_t Lines;
+  LCD_LAYOUT_LINE Line[LCD_LAYOUT_LINES];
+} LCD_LAYOUT;
+
+/********************************************************************************
+  function:
+                        Cached layout and what it was made from
+********************************************************************************/
+typedef struct {
+  char Text[LCD_LAYOUT_TEXT];
+  const void *Font;
+  LCD_LENGTH Max_Width;
+  LCD_ALIGN Align;
+  uint32_t Last_Use; // Use stamp, 0 while the entry is free
+  LCD_LAYOUT Layout;
+} LCD_LAYOUT_ENTRY;
+
+/********************************************************************************
+  function:
+                        Measures strings before they are drawn
+  note:
+                        Lines break at '\n' and, given a Max_Width, before
+                        the word that would not fit (inside a word longer
+                        than a line). Spaces at a break are not drawn.
+                        Every glyph advances by its own width, sFONT
+                        characters by Font->Width. The layout of a string
+                        measured again with the same font, width and
+                        alignment comes from the cache. The result stays
+                        valid until the next LCD_Measure.
+********************************************************************************/
+class LCD_Text_Layout {
+  LCD_LAYOUT_ENTRY entry[LCD_LAYOUT_CACHE];
+  LCD_LAYOUT scratch;
+  uint32_t clock;
+
+  const LCD_LAYOUT *LCD_Layout(const char *pString, const sFONT *Table,
+                               const sPFONT *Packed, LCD_LENGTH Max_Width,
+                               LCD_ALIGN Align);
+  void LCD_Break(LCD_LAYOUT *Layout, const char *pString, const sFONT *Table,
+                 const sPFONT *Packed, LCD_LENGTH Max_Width, LCD_ALIGN Align);
+
+public:
+  LCD_Text_Layout(void);
+
+  // Max_Width 0 for no width limit, the lines align to the widest one
+  const LCD_LAYOUT *LCD_Measure(const char *pString, const sFONT *Font,
+                                LCD_LENGTH Max_Width = 0,
+                                LCD_ALIGN Align = LCD_ALIGN_LEFT);
+  const LCD_LAYOUT *LCD_Measure(const char *pString, const sPFONT *Font,
+                                LCD_LENGTH Max_Width = 0,
+                                LCD_ALIGN Align = LCD_ALIGN_LEFT);
+  void LCD_Clear(void);
+};
+#endif
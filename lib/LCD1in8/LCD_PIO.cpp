@@ -0,0 +1,213 @@
+/***********************************************************************************************************************
+  | file      	:	LCD_PIO.cpp
+  | function	:	ST7735S bus layer on a PIO state machine
+***********************************************************************************************************************/
+
+#include "LCD_PIO.h"
+#include "st7735s_tx.pio.h"
+
+#define LCD_PIO_DC_DATA 0x80000000u // Header flag of a data run
+
+/**
+ * @params pio PIO block running the transmitter
+ * @params pin_cs pico pin number to connect CS in LCD, must be pin_dc + 1
+ * @params pin_dc pico pin number to connect DC in LCD
+ * @params pin_sck pico pin number to connect CLK in LCD
+ * @params pin_mosi pico pin number to connect DIN in LCD
+ * @params pin_rst pico pin number to connect RST in LCD
+ * @params pin_bl pico pin number to connect BL in LCD
+ * @params baudrate SCK frequency in Hz
+ */
+LCD_PIO_Transport::LCD_PIO_Transport(PIO pio, uint pin_cs, uint pin_dc,
+                                     uint pin_sck, uint pin_mosi, uint pin_rst,
+                                     uint pin_bl, uint32_t baudrate)
+    : LCD_DMA_Transport(pin_cs, pin_dc, pin_rst, pin_bl) {
+  this->pio = pio;
+  this->sm = 0;
+  this->program_offset = 0;
+  this->pin_sck = pin_sck;
+  this->pin_mosi = pin_mosi;
+  this->baudrate = baudrate;
+  this->cmd_count = 0;
+  this->cmd_chan = -1;
+  this->pixel_chan = -1;
+}
+
+/**
+ * @params see LCD_PIO_Transport
+ */
+LCD_ST7735S_PIO::LCD_ST7735S_PIO(PIO pio, uint pin_cs, uint pin_dc,
+                                 uint pin_sck, uint pin_mosi, uint pin_rst,
+                                 uint pin_bl, uint32_t baudrate)
+    : LCD_ST7735S(&pio_transport),
+      pio_transport(pio, pin_cs, pin_dc, pin_sck, pin_mosi, pin_rst, pin_bl,
+                    baudrate) {}
+
+/*******************************************************************************
+function:
+                Load the program and claim the state machine and DMA channels
+*******************************************************************************/
+void LCD_PIO_Transport::Init(void) {
+  if (pixel_chan >= 0) {
+    return;
+  }
+  if (pin_cs != pin_dc + 1) {
+    panic("LCD_ST7735S_PIO: CS must be the GPIO after DC");
+  }
+
+  program_offset = pio_add_program(pio, &st7735s_tx_program);
+  sm = pio_claim_unused_sm(pio, true);
+  st7735s_tx_program_init(pio, sm, program_offset, pin_dc, pin_sck, pin_mosi,
+                          baudrate);
+
+  cmd_chan = dma_claim_unused_channel(true);
+  pixel_chan = dma_claim_unused_channel(true);
+  LCD_InstallDMAIRQ(pixel_chan);
+}
+
+/*******************************************************************************
+function:
+                Append one run (header and data words) to the command queue
+*******************************************************************************/
+void LCD_PIO_Transport::LCD_QueueRun(bool Dc, const uint8_t *Data,
+                                   uint32_t Len) {
+  cmd_words[cmd_count++] = (Dc ? LCD_PIO_DC_DATA : 0) | (Len * 8 - 1);
+  for (uint32_t i = 0; i < Len; i += 2) {
+    uint32_t Word = (uint32_t)Data[i] << 24;
+    if (i + 1 < Len) {
+      Word |= (uint32_t)Data[i + 1] << 16;
+    }
+    cmd_words[cmd_count++] = Word;
+  }
+}
+
+/*******************************************************************************
+function:
+                Queue a register and its parameters
+note:
+                Nothing is sent yet: the queue goes out in front of the next
+                pixel burst, or on Wait.
+*******************************************************************************/
+void LCD_PIO_Transport::WriteCommand(uint8_t Reg, const uint8_t *Params,
+                                       uint8_t Len) {
+  LCD_WaitTransfer();
+  uint32_t Words = 2 + 1 + (Len + 1) / 2;
+  if (cmd_count + Words > LCD_PIO_CMD_WORDS) {
+    Wait();
+  }
+  LCD_QueueRun(false, &Reg, 1);
+  if (Len) {
+    LCD_QueueRun(true, Params, Len);
+  }
+}
+
+/*******************************************************************************
+function:
+                Queue data bytes, split into runs that fit the queue
+*******************************************************************************/
+void LCD_PIO_Transport::WriteData(const uint8_t *Data, uint32_t Len) {
+  const uint32_t Max_Run = (LCD_PIO_CMD_WORDS - 1) * 2;
+  LCD_WaitTransfer();
+  while (Len) {
+    uint32_t Run = Len < Max_Run ? Len : Max_Run;
+    if (cmd_count + 1 + (Run + 1) / 2 > LCD_PIO_CMD_WORDS) {
+      Wait();
+    }
+    LCD_QueueRun(true, Data, Run);
+    Data += Run;
+    Len -= Run;
+  }
+}
+
+/*******************************************************************************
+function:
+                Start the command queue, optionally chaining a pixel channel
+*******************************************************************************/
+void LCD_PIO_Transport::LCD_StartCommands(int Chain_Chan) {
+  dma_channel_config c = dma_channel_get_default_config(cmd_chan);
+  channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+  channel_config_set_read_increment(&c, true);
+  channel_config_set_write_increment(&c, false);
+  channel_config_set_dreq(&c, pio_get_dreq(pio, sm, true));
+  channel_config_set_chain_to(&c, Chain_Chan >= 0 ? Chain_Chan : cmd_chan);
+  dma_channel_configure(cmd_chan, &c, &pio->txf[sm], cmd_words, cmd_count,
+                        true);
+}
+
+/*******************************************************************************
+function:
+                Start a pixel burst behind the queued commands
+note:
+                16 bit DMA writes are replicated to both halves of the FIFO
+                word, the state machine shifts out bits 31..16.
+*******************************************************************************/
+void LCD_PIO_Transport::LCD_StartDMA(const volatile void *Src, uint32_t Count,
+                                   bool Increment, LCD_CALLBACK Callback,
+                                   void *User_Data) {
+  LCD_WaitTransfer();
+  dma_callback = Callback;
+  dma_callback_data = User_Data;
+  if (Count == 0) {
+    Wait();
+    LCD_CompleteDMA();
+    return;
+  }
+  if (cmd_count == LCD_PIO_CMD_WORDS) {
+    Wait();
+  }
+  cmd_words[cmd_count++] = LCD_PIO_DC_DATA | (Count * 16 - 1);
+
+  dma_channel_config c = dma_channel_get_default_config(pixel_chan);
+  channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+  channel_config_set_read_increment(&c, Increment);
+  channel_config_set_write_increment(&c, false);
+  channel_config_set_dreq(&c, pio_get_dreq(pio, sm, true));
+  dma_channel_configure(pixel_chan, &c, &pio->txf[sm], Src, Count, false);
+
+  dma_busy = true;
+  LCD_StartCommands(pixel_chan);
+  cmd_count = 0;
+}
+
+/*******************************************************************************
+function:
+                Complete the pixel burst once the state machine is idle
+                (called from the DMA interrupt)
+*******************************************************************************/
+void LCD_PIO_Transport::LCD_FinishDMA(void) {
+  while (!pio_sm_is_tx_fifo_empty(pio, sm) ||
+         pio_sm_get_pc(pio, sm) != st7735s_tx_idle_pc(program_offset)) {
+    tight_loop_contents();
+  }
+  LCD_CompleteDMA();
+}
+
+/*******************************************************************************
+function:
+                Wait for a running pixel burst, leaving the queue alone
+*******************************************************************************/
+void LCD_PIO_Transport::LCD_WaitTransfer(void) {
+  while (dma_busy) {
+    tight_loop_contents();
+  }
+}
+
+/*******************************************************************************
+function:
+                Send the queued commands and wait until all is on the wire
+*******************************************************************************/
+void LCD_PIO_Transport::Wait(void) {
+  if (pixel_chan < 0) {
+    return;
+  }
+  LCD_WaitTransfer();
+  if (cmd_count) {
+    LCD_StartCommands(-1);
+    dma_channel_wait_for_finish_blocking(cmd_chan);
+    cmd_count = 0;
+  }
+  while (!pio_sm_is_tx_fifo_empty(pio, sm) ||
+         pio_sm_get_pc(pio, sm) != st7735s_tx_idle_pc(program_offset)) {
+    tight_loop_contents();
+  }
+}
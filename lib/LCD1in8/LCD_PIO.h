@@ -0,0 +1,67 @@
+#ifndef __LCD_PIO_H
+#define __LCD_PIO_H
+
+#include "LCD.h"
+#include "LCD_DMA.h"
+#include "hardware/pio.h"
+
+#define LCD_PIO_CMD_WORDS 32 // Queued command stream, fits a LCD_SetWindows
+
+/********************************************************************************
+  function:
+                        ST7735S driven by a PIO state machine
+  note:
+                        The state machine generates CS, DC, SCK and MOSI on
+                        its own (see st7735s_tx.pio), so a command sequence
+                        and the pixels behind it form one DMA stream. The
+                        commands of a LCD_SetWindows are queued and chained
+                        in front of the pixel burst: window setup and pixels
+                        go out without any CPU involvement.
+                        CS must be the GPIO right after DC.
+********************************************************************************/
+class LCD_PIO_Transport : public LCD_DMA_Transport {
+  void LCD_QueueRun(bool Dc, const uint8_t *Data, uint32_t Len);
+  void LCD_StartCommands(int Chain_Chan);
+  void LCD_WaitTransfer(void);
+
+  PIO pio;
+  uint sm;
+  uint program_offset;
+  uint pin_sck;
+  uint pin_mosi;
+  uint32_t baudrate;
+
+  // Command words waiting to be sent, and the two DMA channels
+  uint32_t cmd_words[LCD_PIO_CMD_WORDS];
+  uint8_t cmd_count;
+  int cmd_chan;
+  int pixel_chan;
+
+protected:
+  void LCD_StartDMA(const volatile void *Src, uint32_t Count, bool Increment,
+                    LCD_CALLBACK Callback, void *User_Data) override;
+  void LCD_FinishDMA(void) override;
+
+public:
+  LCD_PIO_Transport(PIO pio, uint pin_cs, uint pin_dc, uint pin_sck,
+                    uint pin_mosi, uint pin_rst, uint pin_bl,
+                    uint32_t baudrate);
+
+  void Init(void) override;
+  void WriteCommand(uint8_t Reg, const uint8_t *Params, uint8_t Len) override;
+  void WriteData(const uint8_t *Data, uint32_t Len) override;
+  void Wait(void) override;
+};
+
+/********************************************************************************
+  function:
+                        ST7735S driver on a LCD_PIO_Transport
+********************************************************************************/
+class LCD_ST7735S_PIO : public LCD_ST7735S {
+  LCD_PIO_Transport pio_transport;
+
+public:
+  LCD_ST7735S_PIO(PIO pio, uint pin_cs, uint pin_dc, uint pin_sck,
+                  uint pin_mosi, uint pin_rst, uint pin_bl, uint32_t baudrate);
+};
+#endif
@@ -0,0 +1,129 @@
+/***********************************************************************************************************************
+  | file      	:	LCD_SPI.cpp
+  | function	:	ST7735S bus on a hardware SPI
+***********************************************************************************************************************/
+
+#include "LCD_SPI.h"
+
+/**
+ * @params spi_port spi port number to write
+ * @params pin_cs pico pin number to connect CS in LCD
+ * @params pin_dc pico pin number to connect DC in LCD
+ * @params pin_rst pico pin number to connect RST in LCD
+ * @params pin_bl pico pin number to connect BL in LCD
+ */
+LCD_SPI_Transport::LCD_SPI_Transport(spi_inst_t *spi_port, uint pin_cs,
+                                     uint pin_dc, uint pin_rst, uint pin_bl)
+    : LCD_DMA_Transport(pin_cs, pin_dc, pin_rst, pin_bl) {
+  this->spi_port = spi_port;
+  this->dma_chan = -1;
+}
+
+void LCD_SPI_Transport::Write_CS(bool Val) { gpio_put(pin_cs, Val); }
+void LCD_SPI_Transport::Write_DC(bool Val) { gpio_put(pin_dc, Val); }
+
+/*******************************************************************************
+function:
+                Claim and configure the DMA channel used for pixel data
+*******************************************************************************/
+void LCD_SPI_Transport::Init(void) {
+  if (dma_chan >= 0) {
+    return;
+  }
+  dma_chan = dma_claim_unused_channel(true);
+
+  dma_fill_config = dma_channel_get_default_config(dma_chan);
+  channel_config_set_transfer_data_size(&dma_fill_config, DMA_SIZE_16);
+  channel_config_set_read_increment(&dma_fill_config, false);
+  channel_config_set_write_increment(&dma_fill_config, false);
+  channel_config_set_dreq(&dma_fill_config, spi_get_dreq(spi_port, true));
+
+  LCD_InstallDMAIRQ(dma_chan);
+}
+
+/*******************************************************************************
+function:
+                Write a register and its parameters
+parameter:
+                Reg    :   Register (command) byte
+                Params :   Parameter bytes, may be nullptr when Len is 0
+                Len    :   Number of parameter bytes
+note:
+                The whole sequence is sent while CS stays asserted, only DC is
+                switched between the command and the parameters.
+                spi_write_blocking returns after the last bit is shifted out,
+                so DC is never changed under a byte in flight.
+*******************************************************************************/
+void LCD_SPI_Transport::WriteCommand(uint8_t Reg, const uint8_t *Params,
+                                     uint8_t Len) {
+  Wait();
+  Write_DC(0);
+  Write_CS(0);
+  spi_write_blocking(spi_port, &Reg, 1);
+  if (Len) {
+    Write_DC(1);
+    spi_write_blocking(spi_port, Params, Len);
+  }
+  Write_CS(1);
+}
+
+void LCD_SPI_Transport::WriteData(const uint8_t *Data, uint32_t Len) {
+  Wait();
+  Write_DC(1);
+  Write_CS(0);
+  spi_write_blocking(spi_port, Data, Len);
+  Write_CS(1);
+}
+
+void LCD_SPI_Transport::LCD_StartDMA(const volatile void *Src, uint32_t Count,
+                                     bool Increment, LCD_CALLBACK Callback,
+                                     void *User_Data) {
+  Wait();
+  dma_callback = Callback;
+  dma_callback_data = User_Data;
+  if (Count == 0) {
+    LCD_CompleteDMA();
+    return;
+  }
+
+  Write_DC(1);
+  Write_CS(0);
+  spi_set_format(spi_port, 16, SPI_CPOL_0, SPI_CPHA_0, SPI_MSB_FIRST);
+
+  dma_channel_config c = dma_fill_config;
+  channel_config_set_read_increment(&c, Increment);
+  dma_busy = true;
+  dma_channel_configure(dma_chan, &c, &spi_get_hw(spi_port)->dr, Src, Count,
+                        true);
+}
+
+/*******************************************************************************
+function:
+                Release the bus once the DMA has fed the last pixel
+                (called from the DMA interrupt)
+*******************************************************************************/
+void LCD_SPI_Transport::LCD_FinishDMA(void) {
+  // DMA is done once the FIFO is fed, wait for the last frame to shift out
+  while (spi_is_busy(spi_port)) {
+    tight_loop_contents();
+  }
+  // Discard what was clocked in meanwhile and clear the overrun flag
+  while (spi_is_readable(spi_port)) {
+    (void)spi_get_hw(spi_port)->dr;
+  }
+  spi_get_hw(spi_port)->icr = SPI_SSPICR_RORIC_BITS;
+  spi_set_format(spi_port, 8, SPI_CPOL_0, SPI_CPHA_0, SPI_MSB_FIRST);
+  Write_CS(1);
+
+  LCD_CompleteDMA();
+}
+
+/*******************************************************************************
+function:
+                Block until everything written so far is on the wire
+*******************************************************************************/
+void LCD_SPI_Transport::Wait(void) {
+  while (dma_busy) {
+    tight_loop_contents();
+  }
+}
@@ -0,0 +1,38 @@
+#ifndef __LCD_SPI_H
+#define __LCD_SPI_H
+
+#include "LCD_DMA.h"
+#include "hardware/spi.h"
+
+/********************************************************************************
+  function:
+                        ST7735S on a hardware SPI, CS and DC driven as GPIOs
+  note:
+                        Pixel bursts run with the SPI in 16 bit frames, fed
+                        by a DMA channel.
+********************************************************************************/
+class LCD_SPI_Transport : public LCD_DMA_Transport {
+  void Write_CS(bool Val);
+  void Write_DC(bool Val);
+
+  spi_inst_t *spi_port;
+
+  // DMA channel streaming pixels into the SPI TX FIFO
+  int dma_chan;
+  dma_channel_config dma_fill_config;
+
+protected:
+  void LCD_StartDMA(const volatile void *Src, uint32_t Count, bool Increment,
+                    LCD_CALLBACK Callback, void *User_Data) override;
+  void LCD_FinishDMA(void) override;
+
+public:
+  LCD_SPI_Transport(spi_inst_t *spi_port, uint pin_cs, uint pin_dc,
+                    uint pin_rst, uint pin_bl);
+
+  void Init(void) override;
+  void WriteCommand(uint8_t Reg, const uint8_t *Params, uint8_t Len) override;
+  void WriteData(const uint8_t *Data, uint32_t Len) override;
+  void Wait(void) override;
+};
+#endif
@@ -0,0 +1,212 @@
+/***********************************************************************************************************************
+  | file      	:	LCD_Server.cpp
+  | function	:	Drawing commands queued by one core and run by the other
+***********************************************************************************************************************/
+
+#include "LCD_Server.h"
+
+#if !defined(LCD_HOST)
+#include "hardware/sync.h"
+#include "pico/multicore.h"
+#endif
+
+/*******************************************************************************
+function:
+                Sleep until the other core has moved its index, and wake it
+note:
+                An event sent before the wait is latched, so a wake-up
+                between checking the ring and waiting is not lost.
+*******************************************************************************/
+static inline void LCD_ServerWait(void) {
+#if !defined(LCD_HOST)
+  __wfe();
+#endif
+}
+
+static inline void LCD_ServerSignal(void) {
+#if !defined(LCD_HOST)
+  __sev();
+#endif
+}
+
+/**
+ * @params lcd driver the commands are run on
+ */
+LCD_Display_Server::LCD_Display_Server(LCD_ST7735S *lcd) {
+  this->lcd = lcd;
+  this->head.store(0, std::memory_order_relaxed);
+  this->tail.store(0, std::memory_order_relaxed);
+  this->consumer.store(false, std::memory_order_relaxed);
+  this->high_water = 0;
+  this->stalls = 0;
+  this->text_head = 0;
+  this->text_tail.store(0, std::memory_order_relaxed);
+}
+
+/*******************************************************************************
+function:
+                Let the consumer make room, or run the queue here when there
+                is none
+*******************************************************************************/
+void LCD_Display_Server::LCD_Drain(void) {
+  if (consumer.load(std::memory_order_acquire)) {
+    LCD_ServerWait();
+  } else {
+    LCD_Poll();
+  }
+}
+
+/*******************************************************************************
+function:
+                Free slot for the next command, waiting while the ring is full
+*******************************************************************************/
+LCD_COMMAND *LCD_Display_Server::LCD_Reserve(void) {
+  uint32_t Head = head.load(std::memory_order_relaxed);
+  if (Head - tail.load(std::memory_order_acquire) == LCD_SERVER_RING) {
+    stalls++;
+    while (Head - tail.load(std::memory_order_acquire) == LCD_SERVER_RING) {
+      LCD_Drain();
+    }
+  }
+  LCD_COMMAND *Slot = &ring[Head % LCD_SERVER_RING];
+  Slot->Long_Text = nullptr;
+  Slot->Text_End = 0;
+  return Slot;
+}
+
+/*******************************************************************************
+function:
+                Room for a long string, waiting while the text is full
+note:
+                A string is kept in one piece, it skips the end of the ring
+                when it would wrap. The consumer frees it once its command
+                has run.
+*******************************************************************************/
+char *LCD_Display_Server::LCD_ReserveText(uint32_t *Size, uint32_t *End) {
+  if (*Size > LCD_SERVER_TEXT) {
+    *Size = LCD_SERVER_TEXT;
+  }
+  uint32_t Start = text_head;
+  uint32_t Room = LCD_SERVER_TEXT - Start % LCD_SERVER_TEXT;
+  if (*Size > Room) {
+    Start += Room;
+  }
+  *End = Start + *Size;
+  if (*End - text_tail.load(std::memory_order_acquire) > LCD_SERVER_TEXT) {
+    stalls++;
+    while (*End - text_tail.load(std::memory_order_acquire) >
+           LCD_SERVER_TEXT) {
+      LCD_Drain();
+    }
+  }
+  text_head = *End;
+  return &text[Start % LCD_SERVER_TEXT];
+}
+
+/*******************************************************************************
+function:
+                Hand the reserved slot to the consumer
+*******************************************************************************/
+void LCD_Display_Server::LCD_Commit(void) {
+  uint32_t Head = head.load(std::memory_order_relaxed) + 1;
+  uint32_t Depth = Head - tail.load(std::memory_order_relaxed);
+  if (Depth > high_water) {
+    high_water = Depth;
+  }
+  head.store(Head, std::memory_order_release);
+  LCD_ServerSignal();
+}
+
+bool LCD_Display_Server::LCD_TryPost(const LCD_COMMAND *Command) {
+  uint32_t Head = head.load(std::memory_order_relaxed);
+  if (Head - tail.load(std::memory_order_acquire) == LCD_SERVER_RING) {
+    return false;
+  }
+  ring[Head % LCD_SERVER_RING] = *Command;
+  ring[Head % LCD_SERVER_RING].Text_End = 0;
+  LCD_Commit();
+  return true;
+}
+
+void LCD_Display_Server::LCD_Post(const LCD_COMMAND *Command) {
+  LCD_COMMAND *Slot = LCD_Reserve();
+  *Slot = *Command;
+  Slot->Text_End = 0;
+  LCD_Commit();
+}
+
+void LCD_Display_Server::LCD_Sync(void) {
+  uint32_t Head = head.load(std::memory_order_relaxed);
+  while (tail.load(std::memory_order_acquire) != Head) {
+    LCD_Drain();
+  }
+}
+
+/*******************************************************************************
+function:
+                Run the queued commands
+note:
+                Each slot, and its text, is handed back as soon as its
+                command has run, so LCD_Sync returning means the drawing is
+                done.
+*******************************************************************************/
+uint32_t LCD_Display_Server::LCD_Poll(void) {
+  uint32_t Tail = tail.load(std::memory_order_relaxed);
+  uint32_t Head = head.load(std::memory_order_acquire);
+  uint32_t Count = Head - Tail;
+
+  for (; Tail != Head; Tail++) {
+    const LCD_COMMAND *Command = &ring[Tail % LCD_SERVER_RING];
+    lcd->LCD_Execute(Command);
+    if (Command->Text_End) {
+      text_tail.store(Command->Text_End, std::memory_order_release);
+    }
+    tail.store(Tail + 1, std::memory_order_release);
+    LCD_ServerSignal();
+  }
+  return Count;
+}
+
+/*******************************************************************************
+function:
+                Render loop of the display core, does not return
+*******************************************************************************/
+void LCD_Display_Server::LCD_Run(void) {
+  consumer.store(true, std::memory_order_release);
+  while (true) {
+    if (LCD_Poll() == 0) {
+      LCD_ServerWait();
+    }
+  }
+}
+
+#if !defined(LCD_HOST)
+static LCD_Display_Server *core1_server;
+
+static void LCD_Core1Entry(void) { core1_server->LCD_Run(); }
+
+/*******************************************************************************
+function:
+                Start the render loop on core 1
+*******************************************************************************/
+void LCD_Display_Server::LCD_Launch(void) {
+  core1_server = this;
+  consumer.store(true, std::memory_order_release);
+  multicore_launch_core1(LCD_Core1Entry);
+}
+#endif
+
+void LCD_Display_Server::LCD_GetStats(LCD_SERVER_STATS *Stats) {
+  uint32_t Tail = tail.load(std::memory_order_acquire);
+  Stats->Capacity = LCD_SERVER_RING;
+  Stats->Depth = head.load(std::memory_order_relaxed) - Tail;
+  Stats->High_Water = high_water;
+  Stats->Stalls = stalls;
+  Stats->Commands = Tail;
+}
+
+// High water and stalls, from the producer side
+void LCD_Display_Server::LCD_ResetStats(void) {
+  high_water = 0;
+  stalls = 0;
+}
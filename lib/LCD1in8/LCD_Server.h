@@ -0,0 +1,94 @@
+#ifndef __LCD_SERVER_H
+#define __LCD_SERVER_H
+
+#include "LCD_Command.h"
+
+#include <atomic>
+
+#ifndef LCD_SERVER_RING
+#define LCD_SERVER_RING 32 // Commands in the ring, a power of two
+#endif
+
+#ifndef LCD_SERVER_TEXT
+#define LCD_SERVER_TEXT 256 // Bytes of the strings too long for a command
+#endif
+
+static_assert((LCD_SERVER_RING & (LCD_SERVER_RING - 1)) == 0,
+              "LCD_SERVER_RING must be a power of two");
+
+/********************************************************************************
+  function:
+                        State of the ring, as seen by the producer
+********************************************************************************/
+typedef struct {
+  uint32_t Capacity;   // Commands the ring holds
+  uint32_t Depth;      // Commands waiting right now
+  uint32_t High_Water; // Deepest the ring has been
+  uint32_t Stalls;     // Posts that found the ring or the text full and
+                       // waited
+  uint32_t Commands;   // Commands run
+} LCD_SERVER_STATS;
+
+/********************************************************************************
+  function:
+                        Display server, one core draws for the other
+  note:
+                        The producer (core 0) only queues commands, the
+                        consumer (core 1) runs them on the driver, so the
+                        SPI, DMA and their interrupt belong to core 1 alone.
+                        The ring is single producer, single consumer:
+                        each side only writes its own index, published with
+                        release/acquire ordering, so no lock is taken.
+                        A command is written in place in its slot and the
+                        slot is released once it has run. Strings longer
+                        than a command are copied to a ring of text
+                        released the same way, cut at LCD_SERVER_TEXT - 1
+                        characters.
+                        Set up the driver (glyph cache, framebuffer) before
+                        LCD_Launch and queue LCD_Init, so that core 1 claims
+                        the DMA interrupt.
+                        Until a consumer runs (LCD_Launch, or LCD_Run on a
+                        thread started before the first post), a full ring
+                        and LCD_Sync run the queued commands on the
+                        producer with LCD_Poll, as on the host.
+********************************************************************************/
+class LCD_Display_Server : public LCD_Command_Writer {
+  LCD_ST7735S *lcd;
+  LCD_COMMAND ring[LCD_SERVER_RING];
+
+  std::atomic<uint32_t> head; // Commands posted, written by the producer only
+  std::atomic<uint32_t> tail; // Commands run, written by the consumer only
+  std::atomic<bool> consumer; // LCD_Run has started
+  uint32_t high_water;
+  uint32_t stalls;
+
+  // Ring of long strings, positions count bytes like head and tail
+  char text[LCD_SERVER_TEXT];
+  uint32_t text_head;              // Written by the producer only
+  std::atomic<uint32_t> text_tail; // Written by the consumer only
+
+  LCD_COMMAND *LCD_Reserve(void) override;
+  void LCD_Commit(void) override;
+  char *LCD_ReserveText(uint32_t *Size, uint32_t *End) override;
+  void LCD_Drain(void);
+
+public:
+  LCD_Display_Server(LCD_ST7735S *lcd);
+
+  // Producer side, LCD_Post waits while the ring is full. Long_Text of a
+  // posted command is not copied, it must stay valid until it has run
+  bool LCD_TryPost(const LCD_COMMAND *Command);
+  void LCD_Post(const LCD_COMMAND *Command);
+  void LCD_Sync(void); // Wait until everything posted has run
+
+  // Consumer side, LCD_Poll runs what is queued and returns the count
+  uint32_t LCD_Poll(void);
+  void LCD_Run(void);
+#if !defined(LCD_HOST)
+  void LCD_Launch(void); // LCD_Run on core 1
+#endif
+
+  void LCD_GetStats(LCD_SERVER_STATS *Stats);
+  void LCD_ResetStats(void);
+};
+#endif
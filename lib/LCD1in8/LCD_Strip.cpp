@@ -0,0 +1,100 @@
+/***********************************************************************************************************************
+  | file      	:	LCD_Strip.cpp
+  | function	:	Display lists drawn one band of rows at a time, for builds
+  |                 without a full framebuffer
+***********************************************************************************************************************/
+
+#include "LCD_Strip.h"
+
+#include <string.h>
+
+/**
+ * @params lcd driver the strips are drawn and flushed on
+ * @params pool pixels of both strips, LCD_STRIP_POOL(rows) fits any
+ *         scan direction
+ * @params pool_size pixels in the pool
+ * @params rows rows of a strip
+ */
+LCD_Strip_Renderer::LCD_Strip_Renderer(LCD_ST7735S *lcd, LCD_COLOR *pool,
+                                       uint32_t pool_size, LCD_LENGTH rows) {
+  this->lcd = lcd;
+  this->pool = pool;
+  this->pool_size = pool_size;
+  this->rows = rows;
+  this->background = LCD_BACKGROUND;
+  LCD_ResetStats();
+}
+
+LCD_LENGTH LCD_Strip_Renderer::LCD_SetRows(LCD_LENGTH Rows) {
+  uint32_t Most = pool_size / (2 * LCD_TEXT_LINE);
+  rows = Rows < 1 ? 1 : Rows > Most ? Most : Rows;
+  return rows;
+}
+
+void LCD_Strip_Renderer::LCD_SetBackground(LCD_COLOR Color) {
+  background = Color;
+}
+
+/*******************************************************************************
+function:
+                Optimize the list and draw it over the whole display
+note:
+                The flush of a strip waits for the one before it, which was
+                sent while this one was rendered; that wait is Wait_us.
+*******************************************************************************/
+void LCD_Strip_Renderer::LCD_Render(LCD_Display_List *List) {
+  LCD_LENGTH Column = sLCD_DIS.LCD_Dis_Column, Page = sLCD_DIS.LCD_Dis_Page;
+  LCD_LENGTH Rows = rows;
+  if ((uint32_t)2 * Column * Rows > pool_size) {
+    Rows = pool_size / (2 * Column);
+  }
+  if (Rows == 0) {
+    return;
+  }
+
+  List->LCD_Optimize();
+  uint64_t Start = lcd->LCD_Time_us();
+  uint64_t Render = 0, Wait = 0;
+  uint32_t Strips = 0;
+  for (LCD_POINT Y = 0; Y < Page; Y += Rows, Strips++) {
+    LCD_LENGTH Height = Page - Y < Rows ? Page - Y : Rows;
+    LCD_COLOR *Strip = &pool[(Strips & 1) * (uint32_t)Column * Rows];
+
+    uint64_t Now = lcd->LCD_Time_us();
+    lcd->LCD_SetStrip(Strip, Y, Height);
+    uint64_t Drawn = lcd->LCD_Time_us();
+    Wait += Drawn - Now;
+
+    lcd->LCD_SetArealColor(0, Y, Column, Y + Height, background);
+    List->LCD_Replay(lcd, Y, Y + Height);
+    Now = lcd->LCD_Time_us();
+    Render += Now - Drawn;
+
+    lcd->LCD_Flush_Async();
+    Wait += lcd->LCD_Time_us() - Now;
+  }
+
+  uint64_t Now = lcd->LCD_Time_us();
+  lcd->LCD_SetFramebuffer(nullptr);
+  uint64_t End = lcd->LCD_Time_us();
+  Wait += End - Now;
+
+  stats.Rows = Rows;
+  stats.Strips = Strips;
+  stats.Ram_Bytes = 2 * (uint32_t)Column * Rows * sizeof(LCD_COLOR);
+  stats.Frames++;
+  stats.Render_us = Render;
+  stats.Wait_us = Wait;
+  stats.Frame_us = End - Start;
+  if (stats.Frame_us > stats.Frame_Max_us) {
+    stats.Frame_Max_us = stats.Frame_us;
+  }
+}
+
+const LCD_STRIP_STATS *LCD_Strip_Renderer::LCD_GetStats(void) {
+  return &stats;
+}
+
+void LCD_Strip_Renderer::LCD_ResetStats(void) {
+  memset(&stats, 0, sizeof(stats));
+}
@@ -0,0 +1,65 @@
+#ifndef __LCD_STRIP_H
+#define __LCD_STRIP_H
+
+#include "LCD_DisplayList.h"
+
+#ifndef LCD_STRIP_ROWS
+#define LCD_STRIP_ROWS 16 // Default rows of a strip, at most 5 KB each
+#endif
+
+// Pixels of the pool of a renderer with two strips of Rows rows, enough for
+// either scan direction
+#define LCD_STRIP_POOL(Rows) (2 * LCD_TEXT_LINE * (uint32_t)(Rows))
+
+/********************************************************************************
+  function:
+                        Cost of the frames since the last LCD_ResetStats
+********************************************************************************/
+typedef struct {
+  LCD_LENGTH Rows;     // Rows of a strip
+  uint32_t Strips;     // Strips of a frame
+  uint32_t Ram_Bytes;  // Both strips, the peak RAM of the pixels
+  uint32_t Frames;     // Frames rendered
+  uint32_t Render_us;  // Replaying the list into the strips, last frame
+  uint32_t Wait_us;    // Waiting for a strip still on the bus, last frame
+  uint32_t Frame_us;   // Start of the frame to its last pixel, last frame
+  uint32_t Frame_Max_us;
+} LCD_STRIP_STATS;
+
+/********************************************************************************
+  function:
+                        Draws a display list one band of rows at a time
+  note:
+                        The screen is rendered into two strips of
+                        LCD_Dis_Column x Rows pixels taken from the pool, in
+                        turn: while one is flushed over DMA, the commands
+                        touching the next band are replayed into the other.
+                        Drawing outside of a band is clipped by the driver,
+                        so the panel shows what a full framebuffer cleared to
+                        the background would, for 2 x Rows rows of RAM. The list is
+                        optimized first and kept; LCD_Init and LCD_Flush in
+                        it are skipped. Each strip starts in the background
+                        color. The driver is left drawing to the panel
+                        directly, once the last strip is on the wire.
+********************************************************************************/
+class LCD_Strip_Renderer {
+  LCD_ST7735S *lcd;
+  LCD_COLOR *pool;
+  uint32_t pool_size;
+  LCD_LENGTH rows;
+  LCD_COLOR background;
+  LCD_STRIP_STATS stats;
+
+public:
+  LCD_Strip_Renderer(LCD_ST7735S *lcd, LCD_COLOR *pool, uint32_t pool_size,
+                     LCD_LENGTH rows = LCD_STRIP_ROWS);
+
+  // Rows of a strip, cut to what the pool holds; returns the rows in use
+  LCD_LENGTH LCD_SetRows(LCD_LENGTH Rows);
+  void LCD_SetBackground(LCD_COLOR Color);
+  void LCD_Render(LCD_Display_List *List);
+
+  const LCD_STRIP_STATS *LCD_GetStats(void);
+  void LCD_ResetStats(void);
+};
+#endif
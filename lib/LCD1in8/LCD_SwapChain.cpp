@@ -0,0 +1,127 @@
+/***********************************************************************************************************************
+  | file      	:	LCD_SwapChain.cpp
+  | function	:	Double-buffered framebuffer, flushed while the next frame
+  |                 is drawn
+***********************************************************************************************************************/
+
+#include "LCD_SwapChain.h"
+
+#include <string.h>
+
+/**
+ * @params lcd driver the frames are drawn and flushed on
+ * @params Buffer0 LCD_FRAMEBUFFER_SIZE pixels
+ * @params Buffer1 LCD_FRAMEBUFFER_SIZE pixels
+ * @params Rate frames per second at most, 0 for no cap
+ */
+LCD_Swap_Chain::LCD_Swap_Chain(LCD_ST7735S *lcd, LCD_COLOR *Buffer0,
+                               LCD_COLOR *Buffer1, uint32_t Rate) {
+  this->lcd = lcd;
+  this->buffer[0] = Buffer0;
+  this->buffer[1] = Buffer1;
+  this->back = 0;
+  this->frame_start = 0;
+  this->last_present = 0;
+  this->flush_start = 0;
+  this->flush_end = 0;
+  LCD_SetRate(Rate);
+  LCD_ResetStats();
+}
+
+/*******************************************************************************
+function:
+                Make the back buffer the canvas of the driver
+note:
+                The whole first frame is flushed, which also makes both
+                buffers equal after the first swap.
+*******************************************************************************/
+void LCD_Swap_Chain::LCD_Begin(void) {
+  back = 0;
+  lcd->LCD_SetFramebuffer(buffer[back]);
+  frame_start = lcd->LCD_Time_us();
+  last_present = frame_start;
+  flush_start = 0;
+  flush_end = 0;
+}
+
+void LCD_Swap_Chain::LCD_FlushDone(void *User_Data) {
+  LCD_Swap_Chain *Chain = (LCD_Swap_Chain *)User_Data;
+  Chain->flush_end = Chain->lcd->LCD_Time_us();
+}
+
+/*******************************************************************************
+function:
+                Send the back buffer and draw the next frame in the other
+*******************************************************************************/
+void LCD_Swap_Chain::LCD_Present(void) {
+  uint64_t Now = lcd->LCD_Time_us();
+  uint32_t Render = Now - frame_start;
+
+  // Keep the flush of the previous frame going while held back, sleep
+  // only once it has finished
+  uint32_t Pace = 0;
+  if (period_us && Now - last_present < period_us) {
+    uint64_t Deadline = last_present + period_us;
+    Pace = Deadline - Now;
+    while (Now < Deadline && LCD_Poll()) {
+      Now = lcd->LCD_Time_us();
+    }
+    if (Now < Deadline) {
+      lcd->LCD_Delay_us(Deadline - Now);
+    }
+  }
+
+  // Only the previous flush can hold the next one back
+  Now = lcd->LCD_Time_us();
+  lcd->LCD_Wait();
+  uint64_t Start = lcd->LCD_Time_us();
+  uint32_t Wait = Start - Now;
+  if (flush_end > flush_start) {
+    stats.Flush_us = flush_end - flush_start;
+    if (stats.Flush_us > stats.Flush_Max_us) {
+      stats.Flush_Max_us = stats.Flush_us;
+    }
+  }
+
+  flush_start = Start;
+  flush_end = 0;
+  lcd->LCD_Flush_Async(LCD_FlushDone, this);
+  back ^= 1;
+  lcd->LCD_SwapFramebuffer(buffer[back]);
+
+  stats.Frames++;
+  stats.Render_us = Render;
+  stats.Pace_us = Pace;
+  stats.Wait_us = Wait;
+  stats.Frame_us = Start - last_present;
+  if (Render > stats.Render_Max_us) {
+    stats.Render_Max_us = Render;
+  }
+  stats.Render_Total_us += Render;
+  stats.Idle_Total_us += Pace + Wait;
+
+  last_present = Start;
+  frame_start = lcd->LCD_Time_us();
+}
+
+/*******************************************************************************
+function:
+                Start the next region of the running flush, and tell
+                whether it still runs
+note:
+                A flush of several regions needs a window write between
+                them, which is not sent from the DMA interrupt. Call this
+                from the render loop while drawing a long frame, or the
+                flush stalls after its first region until LCD_Present.
+*******************************************************************************/
+bool LCD_Swap_Chain::LCD_Poll(void) { return lcd->LCD_Busy(); }
+
+LCD_COLOR *LCD_Swap_Chain::LCD_BackBuffer(void) { return buffer[back]; }
+
+void LCD_Swap_Chain::LCD_SetRate(uint32_t Rate) {
+  period_us = Rate ? 1000000 / Rate : 0;
+}
+
+const LCD_SWAP_STATS *LCD_Swap_Chain::LCD_GetStats(void) { return &stats; }
+
+void LCD_Swap_Chain::LCD_ResetStats(void) { memset(&stats, 0, sizeof(stats)); }
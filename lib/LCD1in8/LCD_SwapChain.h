@@ -0,0 +1,73 @@
+#ifndef __LCD_SWAPCHAIN_H
+#define __LCD_SWAPCHAIN_H
+
+#include "LCD.h"
+
+#ifndef LCD_SWAP_RATE
+#define LCD_SWAP_RATE 30 // Frames per second at most, 0 for no cap
+#endif
+
+/********************************************************************************
+  function:
+                        Time of the frames since the last LCD_ResetStats
+********************************************************************************/
+typedef struct {
+  uint32_t Frames;       // Frames presented
+  uint32_t Render_us;    // LCD_Begin or the last present to this one
+  uint32_t Flush_us;     // Start to completion of the last finished flush
+  uint32_t Pace_us;      // Held back by the frame pacer
+  uint32_t Wait_us;      // Waiting for the flush of the previous frame
+  uint32_t Frame_us;     // Last present to this one
+  uint32_t Render_Max_us;
+  uint32_t Flush_Max_us;
+  uint64_t Render_Total_us;
+  uint64_t Idle_Total_us; // Paced and waiting, summed
+} LCD_SWAP_STATS;
+
+/********************************************************************************
+  function:
+                        Two full framebuffers, one drawn while the other is sent
+  note:
+                        The driver draws into the back buffer. LCD_Present
+                        starts the DMA flush of its changes and swaps: the
+                        new back buffer is brought up to date by copying the
+                        flushed regions, so only what changes is drawn and
+                        sent, and the next frame is drawn while the flush
+                        runs. Present blocks only while the previous flush
+                        is still running, or to keep the frame rate under
+                        the cap; while held back it polls the flush along.
+                        Costs 2 x LCD_FRAMEBUFFER_SIZE pixels.
+********************************************************************************/
+class LCD_Swap_Chain {
+  LCD_ST7735S *lcd;
+  LCD_COLOR *buffer[2];
+  uint8_t back;
+  uint32_t period_us;
+  uint64_t frame_start;
+  uint64_t last_present;
+
+  // Flush in flight, completion stamped from the DMA interrupt
+  uint64_t flush_start;
+  volatile uint64_t flush_end;
+  static void LCD_FlushDone(void *User_Data);
+
+  LCD_SWAP_STATS stats;
+
+public:
+  LCD_Swap_Chain(LCD_ST7735S *lcd, LCD_COLOR *Buffer0, LCD_COLOR *Buffer1,
+                 uint32_t Rate = LCD_SWAP_RATE);
+
+  // Take over the framebuffer of the driver, after LCD_Init
+  void LCD_Begin(void);
+  void LCD_Present(void);
+  // Keep the flush of the last frame going, call while drawing the next.
+  // False once it has finished
+  bool LCD_Poll(void);
+  LCD_COLOR *LCD_BackBuffer(void);
+  // Frames per second at most, 0 for no cap
+  void LCD_SetRate(uint32_t Rate);
+
+  const LCD_SWAP_STATS *LCD_GetStats(void);
+  void LCD_ResetStats(void);
+};
+#endif
@@ -0,0 +1,134 @@
+/***********************************************************************************************************************
+  | file      	:	LCD_TextField.cpp
+  | function	:	Text that is redrawn only where it changed
+***********************************************************************************************************************/
+
+#include "LCD_TextField.h"
+
+#include <string.h>
+
+/**
+ * @params lcd display the field is drawn on
+ * @params x X coordinate of the first cell
+ * @params y Y coordinate of the cells
+ * @params font font of the cells
+ */
+LCD_Text_Field::LCD_Text_Field(LCD_ST7735S *lcd, LCD_POINT x, LCD_POINT y,
+                               sFONT *font) {
+  this->lcd = lcd;
+  this->x = x;
+  this->y = y;
+  this->font = font;
+  this->text[0] = '\0';
+  this->length = 0;
+  this->color_background = FONT_BACKGROUND;
+  this->color_foreground = FONT_FOREGROUND;
+  this->valid = false;
+  LCD_ResetStats();
+}
+
+/*******************************************************************************
+function:
+                Characters of a string the field shows
+*******************************************************************************/
+uint32_t LCD_Text_Field::LCD_Cells(const char *pString) {
+  if (x >= sLCD_DIS.LCD_Dis_Column || y >= sLCD_DIS.LCD_Dis_Page) {
+    return 0;
+  }
+  uint32_t Cells = strlen(pString);
+  uint32_t Fit = (sLCD_DIS.LCD_Dis_Column - x) / font->Width;
+  if (Cells > Fit) {
+    Cells = Fit;
+  }
+  if (Cells > LCD_TEXT_FIELD_LENGTH - 1) {
+    Cells = LCD_TEXT_FIELD_LENGTH - 1;
+  }
+  return Cells;
+}
+
+void LCD_Text_Field::LCD_DrawCells(const char *pString, uint32_t Start,
+                                   uint32_t End) {
+  char Run[LCD_TEXT_FIELD_LENGTH];
+  memcpy(Run, &pString[Start], End - Start);
+  Run[End - Start] = '\0';
+  lcd->LCD_DisplayString(x + Start * font->Width, y, Run, font,
+                         color_background, color_foreground);
+  stats.Drawn += End - Start;
+}
+
+void LCD_Text_Field::LCD_ClearCells(uint32_t Start, uint32_t End,
+                                    LCD_COLOR Color) {
+  LCD_POINT Yend = y + font->Height;
+  if (Yend > sLCD_DIS.LCD_Dis_Page) {
+    Yend = sLCD_DIS.LCD_Dis_Page;
+  }
+  lcd->LCD_SetArealColor(x + Start * font->Width, y, x + End * font->Width,
+                         Yend, Color);
+}
+
+/*******************************************************************************
+function:
+                Show a string, drawing the cells that differ from the last one
+parameter:
+                pString          ：String to show
+                Color_Background ：Background color, FONT_BACKGROUND for none
+                Color_Foreground ：Foreground color
+note:
+                New colors redraw every cell. Without a background a
+                changed cell is filled with FONT_BACKGROUND first, so the
+                old character does not show through.
+*******************************************************************************/
+void LCD_Text_Field::LCD_Update(const char *pString,
+                                LCD_COLOR Color_Background,
+                                LCD_COLOR Color_Foreground) {
+  uint32_t Cells = LCD_Cells(pString);
+  bool Full = !valid || Color_Background != color_background ||
+              Color_Foreground != color_foreground;
+  bool Transparent = Color_Background == FONT_BACKGROUND;
+  color_background = Color_Background;
+  color_foreground = Color_Foreground;
+
+  uint32_t i = 0;
+  while (i < Cells) {
+    if (!Full && i < length && text[i] == pString[i]) {
+      stats.Skipped++;
+      stats.Bytes_Saved +=
+          (uint32_t)font->Width * font->Height * sizeof(LCD_COLOR);
+      i++;
+      continue;
+    }
+
+    // Changed characters next to each other go out together
+    uint32_t Start = i;
+    while (i < Cells && (Full || i >= length || text[i] != pString[i])) {
+      i++;
+    }
+    if (Transparent && valid && Start < length) {
+      LCD_ClearCells(Start, i < length ? i : length, FONT_BACKGROUND);
+    }
+    LCD_DrawCells(pString, Start, i);
+  }
+
+  // Cells of the last string past the end of this one
+  if (valid && length > Cells) {
+    LCD_ClearCells(Cells, length, Color_Background);
+    stats.Cleared += length - Cells;
+  }
+
+  memcpy(text, pString, Cells);
+  text[Cells] = '\0';
+  length = Cells;
+  valid = true;
+}
+
+/*******************************************************************************
+function:
+                Forget what the field shows, the next update draws every cell
+*******************************************************************************/
+void LCD_Text_Field::LCD_Invalidate(void) { valid = false; }
+
+const LCD_TEXT_FIELD_STATS *LCD_Text_Field::LCD_GetStats(void) {
+  return &stats;
+}
+
+void LCD_Text_Field::LCD_ResetStats(void) { memset(&stats, 0, sizeof(stats)); }
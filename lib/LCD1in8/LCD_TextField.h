@@ -0,0 +1,61 @@
+#ifndef __LCD_TEXTFIELD_H
+#define __LCD_TEXTFIELD_H
+
+#include "LCD.h"
+
+#ifndef LCD_TEXT_FIELD_LENGTH
+#define LCD_TEXT_FIELD_LENGTH 32 // Characters of a field, terminator included
+#endif
+
+/********************************************************************************
+  function:
+                        Cells since the last LCD_ResetStats
+********************************************************************************/
+typedef struct {
+  uint32_t Drawn;       // Cells sent to the display
+  uint32_t Skipped;     // Cells already showing their character
+  uint32_t Cleared;     // Cells of a longer string filled with the background
+  uint64_t Bytes_Saved; // Pixel data of the skipped cells
+} LCD_TEXT_FIELD_STATS;
+
+/********************************************************************************
+  function:
+                        One line of text that is redrawn where it changed
+  note:
+                        The field remembers what it shows. LCD_Update draws
+                        only the cells whose character or colors changed,
+                        runs of them with one LCD_DisplayString each, and
+                        fills the cells a shorter string leaves behind.
+                        The text stays on one line: characters past the
+                        display edge or LCD_TEXT_FIELD_LENGTH are dropped.
+                        Call LCD_Invalidate when something else drew over
+                        the field, e.g. after LCD_Clear.
+********************************************************************************/
+class LCD_Text_Field {
+  LCD_ST7735S *lcd;
+  LCD_POINT x;
+  LCD_POINT y;
+  sFONT *font;
+
+  char text[LCD_TEXT_FIELD_LENGTH];
+  uint32_t length;
+  LCD_COLOR color_background;
+  LCD_COLOR color_foreground;
+  bool valid;
+  LCD_TEXT_FIELD_STATS stats;
+
+  uint32_t LCD_Cells(const char *pString);
+  void LCD_DrawCells(const char *pString, uint32_t Start, uint32_t End);
+  void LCD_ClearCells(uint32_t Start, uint32_t End, LCD_COLOR Color);
+
+public:
+  LCD_Text_Field(LCD_ST7735S *lcd, LCD_POINT x, LCD_POINT y, sFONT *font);
+
+  void LCD_Update(const char *pString, LCD_COLOR Color_Background,
+                  LCD_COLOR Color_Foreground);
+  void LCD_Invalidate(void);
+
+  const LCD_TEXT_FIELD_STATS *LCD_GetStats(void);
+  void LCD_ResetStats(void);
+};
+#endif
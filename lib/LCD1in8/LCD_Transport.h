@@ -0,0 +1,62 @@
+#ifndef __LCD_TRANSPORT_H
+#define __LCD_TRANSPORT_H
+
+#include <stdint.h>
+
+/********************************************************************************
+  function:
+                        Completion callback of asynchronous transfers
+                        (called from the DMA interrupt)
+********************************************************************************/
+typedef void (*LCD_CALLBACK)(void *User_Data);
+
+/********************************************************************************
+  function:
+                        Bus between the driver and the ST7735S
+  note:
+                        The driver only talks to the panel through this
+                        interface: register writes, data writes, repeated
+                        16 bit words, pixel bursts, the RST and BL lines and
+                        time. Pixel words are sent MSB first.
+                        A transfer started with StartRepeated or StartPixels
+                        runs in the background; any other call first waits
+                        for it, so the order on the wire is the call order.
+********************************************************************************/
+class LCD_Transport {
+public:
+  virtual ~LCD_Transport() {}
+
+  // Claim the resources of the bus, called once from LCD_InitStart
+  virtual void Init(void) = 0;
+
+  // Register (DC low) and its parameters (DC high) in one CS low burst
+  virtual void WriteCommand(uint8_t Reg, const uint8_t *Params,
+                            uint8_t Len) = 0;
+  // Data bytes (DC high), blocking
+  virtual void WriteData(const uint8_t *Data, uint32_t Len) = 0;
+  // Data word repeated Count times, Callback runs once it is on the wire
+  virtual void StartRepeated(uint16_t Data, uint32_t Count,
+                             LCD_CALLBACK Callback, void *User_Data) = 0;
+  // Count words from Pixels, which must stay valid until completion
+  virtual void StartPixels(const uint16_t *Pixels, uint32_t Count,
+                           LCD_CALLBACK Callback, void *User_Data) = 0;
+  // Whether a transfer is still running
+  virtual bool Busy(void) = 0;
+  // Block until everything written so far is on the wire
+  virtual void Wait(void) = 0;
+
+  virtual void Write_RST(bool Val) = 0;
+  virtual void Write_BL(bool Val) = 0;
+  virtual void Delay_us(uint32_t Us) = 0;
+  virtual uint64_t Time_us(void) = 0;
+
+  void WriteRepeated(uint16_t Data, uint32_t Count) {
+    StartRepeated(Data, Count, nullptr, nullptr);
+    Wait();
+  }
+  void WritePixels(const uint16_t *Pixels, uint32_t Count) {
+    StartPixels(Pixels, Count, nullptr, nullptr);
+    Wait();
+  }
+};
+#endif
@@ -0,0 +1,72 @@
+/***********************************************************************************************************************
+  | file      	:	bench_glyph.cpp
+  | function	:	Opaque LCD_DisplayChar into a framebuffer, against a
+  |                 renderer that tests each bit of the font rows
+  | usage     	:	bench_glyph, from a -DCMAKE_BUILD_TYPE=Release build
+***********************************************************************************************************************/
+
+#include "LCD.h"
+#include "LCD_Host.h"
+
+#include <chrono>
+#include <stdio.h>
+
+#define BENCH_GLYPHS 200000
+
+static LCD_COLOR bench_frame[LCD_FRAMEBUFFER_SIZE];
+
+/*******************************************************************************
+function:
+                A glyph cell written a bit at a time, as LCD_GlyphRow did
+*******************************************************************************/
+static void Bench_BitChar(LCD_POINT Xpoint, LCD_POINT Ypoint, char Acsii_Char,
+                          sFONT *Font, LCD_COLOR Color_Background,
+                          LCD_COLOR Color_Foreground) {
+  uint16_t Row_Bytes = (Font->Width + 7) / 8;
+  const uint8_t *ptr =
+      &Font->table[(Acsii_Char - ' ') * Font->Height * Row_Bytes];
+  for (LCD_POINT Page = 0; Page < Font->Height; Page++, ptr += Row_Bytes) {
+    LCD_COLOR *Dst =
+        &bench_frame[(Ypoint + Page) * sLCD_DIS.LCD_Dis_Column + Xpoint];
+    for (LCD_POINT Column = 0; Column < Font->Width; Column++) {
+      Dst[Column] = ptr[Column / 8] & (0x80 >> (Column % 8))
+                        ? Color_Foreground
+                        : Color_Background;
+    }
+  }
+}
+
+// Glyphs a second, cycling through the printable characters over the canvas
+template <typename Draw> static double Bench_Rate(sFONT *Font, Draw Char) {
+  LCD_POINT Columns = sLCD_DIS.LCD_Dis_Column / Font->Width;
+  LCD_POINT Rows = sLCD_DIS.LCD_Dis_Page / Font->Height;
+  auto Start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < BENCH_GLYPHS; i++) {
+    uint32_t Cell = i % (Columns * Rows);
+    Char((Cell % Columns) * Font->Width, (Cell / Columns) * Font->Height,
+         (char)(' ' + i % 95));
+  }
+  std::chrono::duration<double> Time = std::chrono::steady_clock::now() - Start;
+  return BENCH_GLYPHS / Time.count();
+}
+
+int main(void) {
+  static sFONT *Fonts[] = {&Font8, &Font12, &Font16, &Font20, &Font24};
+  LCD_Host_Transport Bus;
+  LCD_ST7735S Lcd(&Bus);
+  Lcd.LCD_Init(L2R_U2D);
+  Lcd.LCD_SetFramebuffer(bench_frame);
+
+  printf("Opaque glyphs into a framebuffer, Mglyph/s\n");
+  printf("%-8s %10s %10s\n", "", "per bit", "lut");
+  for (sFONT *Font : Fonts) {
+    double Bit = Bench_Rate(Font, [&](LCD_POINT X, LCD_POINT Y, char C) {
+      Bench_BitChar(X, Y, C, Font, GRAY, BLUE);
+    });
+    double Lut = Bench_Rate(Font, [&](LCD_POINT X, LCD_POINT Y, char C) {
+      Lcd.LCD_DisplayChar(X, Y, C, Font, GRAY, BLUE);
+    });
+    printf("Font%-4u %10.1f %10.1f\n", Font->Height, Bit / 1e6, Lut / 1e6);
+  }
+  return 0;
+}
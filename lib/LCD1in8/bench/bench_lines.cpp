@@ -0,0 +1,64 @@
+/***********************************************************************************************************************
+  | file      	:	bench_lines.cpp
+  | function	:	Bus traffic of solid lines, drawn as merged spans and as
+  |                 one square per Bresenham step
+  | usage     	:	bench_lines
+***********************************************************************************************************************/
+
+#include "../tests/LCD_Reference.h"
+#include "LCD_Emulator.h"
+
+#include <stdio.h>
+
+// Axis aligned, shallow, steep and diagonal, in both directions
+static const LCD_POINT bench_lines[12][4] = {
+    {0, 30, 127, 30},   {64, 0, 64, 159},   {5, 5, 120, 150},
+    {120, 10, 8, 140},  {0, 80, 127, 95},   {127, 100, 0, 60},
+    {30, 0, 45, 159},   {100, 159, 90, 0},  {10, 150, 110, 50},
+    {20, 40, 100, 120}, {3, 120, 124, 118}, {60, 20, 63, 140},
+};
+
+static uint64_t Bench_Lines(LCD_ST7735S_Emulator *Emulator, DOT_PIXEL Dot_Pixel,
+                            bool Reference) {
+  LCD_Host_Transport Bus;
+  Bus.LCD_SetListener(Emulator);
+  LCD_ST7735S Lcd(&Bus);
+  Lcd.LCD_Init(L2R_U2D);
+  Lcd.LCD_Clear(WHITE);
+  Bus.LCD_ClearRecords();
+
+  for (const LCD_POINT *Line : bench_lines) {
+    if (Reference) {
+      Ref_DrawLine(&Lcd, Line[0], Line[1], Line[2], Line[3], BLUE, LINE_SOLID,
+                   Dot_Pixel);
+    } else {
+      Lcd.LCD_DrawLine(Line[0], Line[1], Line[2], Line[3], BLUE, LINE_SOLID,
+                       Dot_Pixel);
+    }
+  }
+  return Bus.LCD_ByteCount();
+}
+
+int main(void) {
+  static LCD_ST7735S_Emulator Span_Panel, Point_Panel;
+  static const DOT_PIXEL Sizes[] = {DOT_PIXEL_1X1, DOT_PIXEL_2X2,
+                                    DOT_PIXEL_6X6};
+
+  printf("12 solid lines, bytes sent\n");
+  printf("%-6s %10s %10s %8s\n", "dot", "per point", "spans", "differ");
+  for (DOT_PIXEL Dot_Pixel : Sizes) {
+    uint64_t Point = Bench_Lines(&Point_Panel, Dot_Pixel, true);
+    uint64_t Span = Bench_Lines(&Span_Panel, Dot_Pixel, false);
+
+    uint32_t Different = 0;
+    for (LCD_POINT Y = 0; Y < sLCD_DIS.LCD_Dis_Page; Y++) {
+      for (LCD_POINT X = 0; X < sLCD_DIS.LCD_Dis_Column; X++) {
+        Different +=
+            Span_Panel.LCD_GetPixel(X, Y) != Point_Panel.LCD_GetPixel(X, Y);
+      }
+    }
+    printf("%dx%-4d %10llu %10llu %8u\n", Dot_Pixel, Dot_Pixel,
+           (unsigned long long)Point, (unsigned long long)Span, Different);
+  }
+  return 0;
+}
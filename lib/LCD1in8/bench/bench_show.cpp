@@ -0,0 +1,73 @@
+/***********************************************************************************************************************
+  | file      	:	bench_show.cpp
+  | function	:	Bus traffic of the LCD_Show demo, drawn straight to the
+  |                 panel and through the framebuffer
+  | usage     	:	bench_show
+***********************************************************************************************************************/
+
+#include "LCD_Emulator.h"
+
+#include <stdio.h>
+
+typedef struct {
+  uint64_t Bytes;
+  uint32_t Transactions;
+  uint64_t Time_us;
+} BENCH_TRAFFIC;
+
+static LCD_COLOR bench_frame[LCD_FRAMEBUFFER_SIZE];
+
+static BENCH_TRAFFIC Bench_Show(LCD_ST7735S_Emulator *Emulator,
+                                LCD_SCAN_DIR Scan_Dir, bool Framebuffer) {
+  LCD_Host_Transport Bus;
+  Bus.LCD_SetListener(Emulator);
+  LCD_ST7735S Lcd(&Bus);
+  Lcd.LCD_Init(Scan_Dir);
+  Bus.LCD_ClearRecords();
+
+  uint64_t Start = Bus.Time_us();
+  if (Framebuffer) {
+    Lcd.LCD_SetFramebuffer(bench_frame);
+  }
+  Lcd.LCD_Clear(WHITE);
+  Lcd.LCD_Show();
+  if (Framebuffer) {
+    Lcd.LCD_Flush();
+    Lcd.LCD_SetFramebuffer(nullptr);
+  }
+
+  BENCH_TRAFFIC Traffic;
+  Traffic.Bytes = Bus.LCD_ByteCount();
+  Traffic.Transactions = Bus.LCD_TransactionCount();
+  Traffic.Time_us = Bus.Time_us() - Start;
+  return Traffic;
+}
+
+int main(void) {
+  static LCD_ST7735S_Emulator Direct_Panel, Frame_Panel;
+  static const LCD_SCAN_DIR Scan_Dirs[] = {L2R_U2D, U2D_L2R};
+
+  for (LCD_SCAN_DIR Scan_Dir : Scan_Dirs) {
+    BENCH_TRAFFIC Direct = Bench_Show(&Direct_Panel, Scan_Dir, false);
+    BENCH_TRAFFIC Frame = Bench_Show(&Frame_Panel, Scan_Dir, true);
+
+    uint32_t Different = 0;
+    for (LCD_POINT Y = 0; Y < sLCD_DIS.LCD_Dis_Page; Y++) {
+      for (LCD_POINT X = 0; X < sLCD_DIS.LCD_Dis_Column; X++) {
+        Different += Direct_Panel.LCD_GetPixel(X, Y) !=
+                     Frame_Panel.LCD_GetPixel(X, Y);
+      }
+    }
+
+    printf("\nLCD_Show, scan direction %d\n", Scan_Dir);
+    printf("%-12s %10s %10s %10s\n", "", "bytes", "bursts", "bus us");
+    printf("%-12s %10llu %10u %10llu\n", "direct",
+           (unsigned long long)Direct.Bytes, Direct.Transactions,
+           (unsigned long long)Direct.Time_us);
+    printf("%-12s %10llu %10u %10llu\n", "framebuffer",
+           (unsigned long long)Frame.Bytes, Frame.Transactions,
+           (unsigned long long)Frame.Time_us);
+    printf("pixels that differ: %u\n", Different);
+  }
+  return 0;
+}
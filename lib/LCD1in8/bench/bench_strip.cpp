@@ -0,0 +1,76 @@
+/***********************************************************************************************************************
+  | file      	:	bench_strip.cpp
+  | function	:	RAM and frame time of the strip renderer at several strip
+  |                 heights, checked against a full framebuffer
+  | usage     	:	bench_strip
+***********************************************************************************************************************/
+
+#include "LCD_Emulator.h"
+#include "LCD_Strip.h"
+
+#include <stdio.h>
+
+#define BENCH_LIST_SIZE 32
+
+static LCD_COLOR bench_frame[LCD_FRAMEBUFFER_SIZE];
+static LCD_COLOR bench_pool[LCD_STRIP_POOL(64)];
+
+static void Bench_Frame(LCD_Display_List *List) {
+  List->LCD_Clear(WHITE);
+  List->LCD_SetArealColor(10, 10, 60, 50, RED);
+  List->LCD_DrawCircle(80, 64, 30, BLUE, DRAW_FULL, DOT_PIXEL_1X1);
+  List->LCD_DrawLine(0, 0, 159, 127, GREEN, LINE_SOLID, DOT_PIXEL_2X2);
+  List->LCD_DisplayString(5, 100, "Hello strips", &Font12, WHITE, BLACK);
+  List->LCD_DrawRectangle(100, 5, 150, 40, GRAY, DRAW_EMPTY, DOT_PIXEL_1X1);
+}
+
+int main(void) {
+  static LCD_ST7735S_Emulator Frame_Panel, Strip_Panel;
+  static LCD_LIST_ENTRY Frame_Arena[BENCH_LIST_SIZE];
+  static LCD_LIST_ENTRY Strip_Arena[BENCH_LIST_SIZE];
+  LCD_Host_Transport Frame_Bus, Strip_Bus;
+  Frame_Bus.LCD_SetListener(&Frame_Panel);
+  Strip_Bus.LCD_SetListener(&Strip_Panel);
+  LCD_ST7735S Frame_Lcd(&Frame_Bus), Strip_Lcd(&Strip_Bus);
+  Frame_Lcd.LCD_Init(SCAN_DIR_DFT);
+  Strip_Lcd.LCD_Init(SCAN_DIR_DFT);
+
+  // The reference, the same list drawn into a full framebuffer
+  LCD_Display_List Frame_List(&Frame_Lcd, Frame_Arena, BENCH_LIST_SIZE);
+  Bench_Frame(&Frame_List);
+  Frame_Lcd.LCD_SetFramebuffer(bench_frame);
+  uint64_t Start = Frame_Bus.Time_us();
+  Frame_List.LCD_Submit();
+  Frame_Lcd.LCD_Flush();
+  uint64_t Frame_us = Frame_Bus.Time_us() - Start;
+
+  LCD_Display_List Strip_List(&Strip_Lcd, Strip_Arena, BENCH_LIST_SIZE);
+  Bench_Frame(&Strip_List);
+  LCD_Strip_Renderer Renderer(&Strip_Lcd, bench_pool, LCD_STRIP_POOL(64));
+
+  printf("%-12s %8s %10s %10s %10s %8s\n", "", "strips", "RAM bytes",
+         "frame us", "wait us", "differ");
+  printf("%-12s %8u %10u %10llu %10s %8s\n", "framebuffer", 1u,
+         (unsigned)sizeof(bench_frame), (unsigned long long)Frame_us, "-",
+         "-");
+  static const LCD_LENGTH Heights[] = {8, 16, 32, 64};
+  for (LCD_LENGTH Rows : Heights) {
+    Renderer.LCD_SetRows(Rows);
+    Renderer.LCD_ResetStats();
+    Renderer.LCD_Render(&Strip_List);
+    const LCD_STRIP_STATS *Stats = Renderer.LCD_GetStats();
+
+    uint32_t Different = 0;
+    for (LCD_POINT Y = 0; Y < sLCD_DIS.LCD_Dis_Page; Y++) {
+      for (LCD_POINT X = 0; X < sLCD_DIS.LCD_Dis_Column; X++) {
+        Different +=
+            Frame_Panel.LCD_GetPixel(X, Y) != Strip_Panel.LCD_GetPixel(X, Y);
+      }
+    }
+    char Name[16];
+    snprintf(Name, sizeof(Name), "%u rows", Stats->Rows);
+    printf("%-12s %8u %10u %10u %10u %8u\n", Name, Stats->Strips,
+           Stats->Ram_Bytes, Stats->Frame_us, Stats->Wait_us, Different);
+  }
+  return 0;
+}
@@ -0,0 +1,59 @@
+/***********************************************************************************************************************
+  | file      	:	bench_textfield.cpp
+  | function	:	Bus traffic of a changing readout, redrawn whole and
+  |                 through LCD_Text_Field
+  | usage     	:	bench_textfield
+***********************************************************************************************************************/
+
+#include "LCD_Emulator.h"
+#include "LCD_TextField.h"
+
+#include <stdio.h>
+
+#define BENCH_STEPS 1000
+
+// A Font16 hex readout of a counter, stepped BENCH_STEPS times
+static uint64_t Bench_Readout(LCD_ST7735S_Emulator *Emulator, bool Field) {
+  LCD_Host_Transport Bus;
+  Bus.LCD_SetListener(Emulator);
+  LCD_ST7735S Lcd(&Bus);
+  Lcd.LCD_Init(L2R_U2D);
+  Lcd.LCD_Clear(BLACK);
+  LCD_Text_Field Readout(&Lcd, 4, 40, &Font16);
+  Bus.LCD_ClearRecords();
+
+  for (uint32_t Step = 0; Step < BENCH_STEPS; Step++) {
+    char Text[16];
+    snprintf(Text, sizeof(Text), "0x%08X", Step);
+    if (Field) {
+      Readout.LCD_Update(Text, BLACK, GREEN);
+    } else {
+      Lcd.LCD_DisplayString(4, 40, Text, &Font16, BLACK, GREEN);
+    }
+  }
+  if (Field) {
+    const LCD_TEXT_FIELD_STATS *Stats = Readout.LCD_GetStats();
+    printf("cells drawn %u, skipped %u, cleared %u\n", Stats->Drawn,
+           Stats->Skipped, Stats->Cleared);
+  }
+  return Bus.LCD_ByteCount();
+}
+
+int main(void) {
+  static LCD_ST7735S_Emulator Whole_Panel, Field_Panel;
+  uint64_t Whole = Bench_Readout(&Whole_Panel, false);
+  uint64_t Field = Bench_Readout(&Field_Panel, true);
+
+  uint32_t Different = 0;
+  for (LCD_POINT Y = 0; Y < sLCD_DIS.LCD_Dis_Page; Y++) {
+    for (LCD_POINT X = 0; X < sLCD_DIS.LCD_Dis_Column; X++) {
+      Different +=
+          Whole_Panel.LCD_GetPixel(X, Y) != Field_Panel.LCD_GetPixel(X, Y);
+    }
+  }
+  printf("Font16 hex readout, %u steps\n", BENCH_STEPS);
+  printf("%-12s %10llu bytes\n", "whole", (unsigned long long)Whole);
+  printf("%-12s %10llu bytes\n", "text field", (unsigned long long)Field);
+  printf("pixels that differ: %u\n", Different);
+  return 0;
+}
@@ -0,0 +1,90 @@
+/***********************************************************************************************************************
+  | file      	:	bench_timing.cpp
+  | function	:	Simulated bus time of the driver operations on the host
+  | usage     	:	bench_timing [-d]
+  |               	-d  also dump every recorded transaction
+***********************************************************************************************************************/
+
+#include "LCD.h"
+#include "LCD_Host.h"
+
+#include <stdio.h>
+#include <string.h>
+
+static LCD_COLOR bench_bitmap[64 * 64];
+static LCD_COLOR bench_frame[LCD_FRAMEBUFFER_SIZE];
+
+/*******************************************************************************
+function:
+                Print what the bus did since the last call
+*******************************************************************************/
+static void Bench_Report(LCD_Host_Transport *Bus, const char *Name,
+                         uint64_t *Last_us, bool Dump) {
+  Bus->Wait();
+  uint64_t Now = Bus->Time_us();
+  printf("%-28s %10llu %8u %10llu\n", Name,
+         (unsigned long long)Bus->LCD_ByteCount(), Bus->LCD_TransactionCount(),
+         (unsigned long long)(Now - *Last_us));
+  if (Dump) {
+    Bus->LCD_Dump(stdout);
+  }
+  Bus->LCD_ClearRecords();
+  *Last_us = Now;
+}
+
+int main(int argc, char **argv) {
+  bool Dump = argc > 1 && strcmp(argv[1], "-d") == 0;
+  for (uint32_t i = 0; i < sizeof(bench_bitmap) / sizeof(bench_bitmap[0]);
+       i++) {
+    bench_bitmap[i] = i * 37;
+  }
+
+  LCD_Host_Transport Bus;
+  LCD_ST7735S Lcd(&Bus);
+  uint64_t Last_us = Bus.Time_us();
+  printf("%-28s %10s %8s %10s\n", "operation", "bytes", "bursts", "us");
+
+  Lcd.LCD_Init(L2R_U2D);
+  Bench_Report(&Bus, "LCD_Init", &Last_us, Dump);
+
+  Lcd.LCD_InitStart(L2R_U2D);
+  uint32_t Steps = 0;
+  while (!Lcd.LCD_InitStep()) {
+    // Time the caller could spend elsewhere
+    if (Lcd.LCD_InitDeadline() > Bus.Time_us()) {
+      Bus.Delay_us(Lcd.LCD_InitDeadline() - Bus.Time_us());
+    }
+    Steps++;
+  }
+  Bench_Report(&Bus, "LCD_InitStart + LCD_InitStep", &Last_us, Dump);
+
+  Lcd.LCD_Clear(WHITE);
+  Bench_Report(&Bus, "LCD_Clear", &Last_us, Dump);
+
+  Lcd.LCD_SetArealColor(10, 10, 74, 74, RED);
+  Bench_Report(&Bus, "LCD_SetArealColor 64x64", &Last_us, Dump);
+
+  Lcd.LCD_DrawBitmap(10, 10, 64, 64, bench_bitmap);
+  Bench_Report(&Bus, "LCD_DrawBitmap 64x64", &Last_us, Dump);
+
+  Lcd.LCD_DrawLine(0, 0, 127, 159, BLUE, LINE_SOLID, DOT_PIXEL_2X2);
+  Bench_Report(&Bus, "LCD_DrawLine diagonal 2x2", &Last_us, Dump);
+
+  Lcd.LCD_DrawCircle(64, 80, 40, GREEN, DRAW_FULL, DOT_PIXEL_1X1);
+  Bench_Report(&Bus, "LCD_DrawCircle r40 filled", &Last_us, Dump);
+
+  Lcd.LCD_DisplayString(0, 0, "Hello, world", &Font16, WHITE, BLACK);
+  Bench_Report(&Bus, "LCD_DisplayString Font16", &Last_us, Dump);
+
+  Lcd.LCD_SetFramebuffer(bench_frame);
+  Lcd.LCD_Flush();
+  Bench_Report(&Bus, "LCD_Flush full frame", &Last_us, Dump);
+
+  Lcd.LCD_SetArealColor(20, 30, 40, 50, BLACK);
+  Lcd.LCD_Flush();
+  Lcd.LCD_SetFramebuffer(nullptr);
+  Bench_Report(&Bus, "LCD_Flush 20x20 region", &Last_us, Dump);
+
+  printf("\ncooperative init: %u steps\n", Steps);
+  return 0;
+}
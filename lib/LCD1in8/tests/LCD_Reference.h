@@ -0,0 +1,195 @@
+#ifndef __LCD_REFERENCE_H
+#define __LCD_REFERENCE_H
+
+#include "LCD.h"
+
+/********************************************************************************
+  function:
+                        The primitives of the original driver, every pixel
+                        written with LCD_SetPointlColor
+********************************************************************************/
+static inline void Ref_DrawPoint(LCD_ST7735S *Lcd, LCD_POINT Xpoint,
+                                 LCD_POINT Ypoint, LCD_COLOR Color,
+                                 DOT_PIXEL Dot_Pixel) {
+  if (Xpoint > sLCD_DIS.LCD_Dis_Column || Ypoint > sLCD_DIS.LCD_Dis_Page) {
+    return;
+  }
+  for (uint16_t XDir_Num = 0; XDir_Num < 2 * Dot_Pixel - 1; XDir_Num++) {
+    for (uint16_t YDir_Num = 0; YDir_Num < 2 * Dot_Pixel - 1; YDir_Num++) {
+      Lcd->LCD_SetPointlColor(Xpoint + XDir_Num - Dot_Pixel,
+                              Ypoint + YDir_Num - Dot_Pixel, Color);
+    }
+  }
+}
+
+static inline void Ref_DrawLine(LCD_ST7735S *Lcd, LCD_POINT Xstart,
+                                LCD_POINT Ystart, LCD_POINT Xend,
+                                LCD_POINT Yend, LCD_COLOR Color,
+                                LINE_STYLE Line_Style, DOT_PIXEL Dot_Pixel) {
+  if (Xstart > sLCD_DIS.LCD_Dis_Column || Ystart > sLCD_DIS.LCD_Dis_Page ||
+      Xend > sLCD_DIS.LCD_Dis_Column || Yend > sLCD_DIS.LCD_Dis_Page) {
+    return;
+  }
+
+  LCD_POINT Xpoint = Xstart;
+  LCD_POINT Ypoint = Ystart;
+  int32_t dx =
+      (int32_t)Xend - (int32_t)Xstart >= 0 ? Xend - Xstart : Xstart - Xend;
+  int32_t dy =
+      (int32_t)Yend - (int32_t)Ystart <= 0 ? Yend - Ystart : Ystart - Yend;
+  int32_t XAddway = Xstart < Xend ? 1 : -1;
+  int32_t YAddway = Ystart < Yend ? 1 : -1;
+  int32_t Esp = dx + dy;
+  int8_t Line_Style_Temp = 0;
+
+  for (;;) {
+    Line_Style_Temp++;
+    if (Line_Style == LINE_DOTTED && Line_Style_Temp % 3 == 0) {
+      Ref_DrawPoint(Lcd, Xpoint, Ypoint, LCD_BACKGROUND, Dot_Pixel);
+      Line_Style_Temp = 0;
+    } else {
+      Ref_DrawPoint(Lcd, Xpoint, Ypoint, Color, Dot_Pixel);
+    }
+    if (2 * Esp >= dy) {
+      if (Xpoint == Xend)
+        break;
+      Esp += dy;
+      Xpoint += XAddway;
+    }
+    if (2 * Esp <= dx) {
+      if (Ypoint == Yend)
+        break;
+      Esp += dx;
+      Ypoint += YAddway;
+    }
+  }
+}
+
+static inline void Ref_DrawRectangle(LCD_ST7735S *Lcd, LCD_POINT Xstart,
+                                     LCD_POINT Ystart, LCD_POINT Xend,
+                                     LCD_POINT Yend, LCD_COLOR Color,
+                                     DRAW_FILL Filled, DOT_PIXEL Dot_Pixel) {
+  if (Xstart > sLCD_DIS.LCD_Dis_Column || Ystart > sLCD_DIS.LCD_Dis_Page ||
+      Xend > sLCD_DIS.LCD_Dis_Column || Yend > sLCD_DIS.LCD_Dis_Page) {
+    return;
+  }
+  if (Filled) {
+    for (LCD_POINT Y = Ystart; Y < Yend; Y++) {
+      for (LCD_POINT X = Xstart; X < Xend; X++) {
+        Lcd->LCD_SetPointlColor(X, Y, Color);
+      }
+    }
+  } else {
+    Ref_DrawLine(Lcd, Xstart, Ystart, Xend, Ystart, Color, LINE_SOLID,
+                 Dot_Pixel);
+    Ref_DrawLine(Lcd, Xstart, Ystart, Xstart, Yend, Color, LINE_SOLID,
+                 Dot_Pixel);
+    Ref_DrawLine(Lcd, Xend, Yend, Xend, Ystart, Color, LINE_SOLID, Dot_Pixel);
+    Ref_DrawLine(Lcd, Xend, Yend, Xstart, Yend, Color, LINE_SOLID, Dot_Pixel);
+  }
+}
+
+static inline void Ref_DrawCircle(LCD_ST7735S *Lcd, LCD_POINT X_Center,
+                                  LCD_POINT Y_Center, LCD_LENGTH Radius,
+                                  LCD_COLOR Color, DRAW_FILL Draw_Fill,
+                                  DOT_PIXEL Dot_Pixel) {
+  if (X_Center > sLCD_DIS.LCD_Dis_Column || Y_Center >= sLCD_DIS.LCD_Dis_Page) {
+    return;
+  }
+
+  int16_t XCurrent = 0, YCurrent = Radius;
+  int16_t Esp = 3 - (Radius << 1);
+  while (XCurrent <= YCurrent) {
+    if (Draw_Fill) {
+      for (int16_t sCountY = XCurrent; sCountY <= YCurrent; sCountY++) {
+        Lcd->LCD_SetPointlColor(X_Center + XCurrent, Y_Center + sCountY, Color);
+        Lcd->LCD_SetPointlColor(X_Center - XCurrent, Y_Center + sCountY, Color);
+        Lcd->LCD_SetPointlColor(X_Center - sCountY, Y_Center + XCurrent, Color);
+        Lcd->LCD_SetPointlColor(X_Center - sCountY, Y_Center - XCurrent, Color);
+        Lcd->LCD_SetPointlColor(X_Center - XCurrent, Y_Center - sCountY, Color);
+        Lcd->LCD_SetPointlColor(X_Center + XCurrent, Y_Center - sCountY, Color);
+        Lcd->LCD_SetPointlColor(X_Center + sCountY, Y_Center - XCurrent, Color);
+        Lcd->LCD_SetPointlColor(X_Center + sCountY, Y_Center + XCurrent, Color);
+      }
+    } else {
+      Ref_DrawPoint(Lcd, X_Center + XCurrent, Y_Center + YCurrent, Color,
+                    Dot_Pixel);
+      Ref_DrawPoint(Lcd, X_Center - XCurrent, Y_Center + YCurrent, Color,
+                    Dot_Pixel);
+      Ref_DrawPoint(Lcd, X_Center - YCurrent, Y_Center + XCurrent, Color,
+                    Dot_Pixel);
+      Ref_DrawPoint(Lcd, X_Center - YCurrent, Y_Center - XCurrent, Color,
+                    Dot_Pixel);
+      Ref_DrawPoint(Lcd, X_Center - XCurrent, Y_Center - YCurrent, Color,
+                    Dot_Pixel);
+      Ref_DrawPoint(Lcd, X_Center + XCurrent, Y_Center - YCurrent, Color,
+                    Dot_Pixel);
+      Ref_DrawPoint(Lcd, X_Center + YCurrent, Y_Center - XCurrent, Color,
+                    Dot_Pixel);
+      Ref_DrawPoint(Lcd, X_Center + YCurrent, Y_Center + XCurrent, Color,
+                    Dot_Pixel);
+    }
+    if (Esp < 0)
+      Esp += 4 * XCurrent + 6;
+    else {
+      Esp += 10 + 4 * (XCurrent - YCurrent);
+      YCurrent--;
+    }
+    XCurrent++;
+  }
+}
+
+static inline void Ref_DisplayChar(LCD_ST7735S *Lcd, LCD_POINT Xpoint,
+                                   LCD_POINT Ypoint, const char Acsii_Char,
+                                   sFONT *Font, LCD_COLOR Color_Background,
+                                   LCD_COLOR Color_Foreground) {
+  if (Xpoint >= sLCD_DIS.LCD_Dis_Column || Ypoint >= sLCD_DIS.LCD_Dis_Page) {
+    return;
+  }
+
+  uint32_t Char_Offset = (Acsii_Char - ' ') * Font->Height *
+                         (Font->Width / 8 + (Font->Width % 8 ? 1 : 0));
+  const unsigned char *ptr = &Font->table[Char_Offset];
+  for (LCD_POINT Page = 0; Page < Font->Height; Page++) {
+    for (LCD_POINT Column = 0; Column < Font->Width; Column++) {
+      if (*ptr & (0x80 >> (Column % 8))) {
+        Lcd->LCD_SetPointlColor(Xpoint + Column, Ypoint + Page,
+                                Color_Foreground);
+      } else if (FONT_BACKGROUND != Color_Background) {
+        Lcd->LCD_SetPointlColor(Xpoint + Column, Ypoint + Page,
+                                Color_Background);
+      }
+      if (Column % 8 == 7) {
+        ptr++;
+      }
+    }
+    if (Font->Width % 8 != 0) {
+      ptr++;
+    }
+  }
+}
+
+static inline void Ref_DisplayString(LCD_ST7735S *Lcd, LCD_POINT Xstart,
+                                     LCD_POINT Ystart, const char *pString,
+                                     sFONT *Font, LCD_COLOR Color_Background,
+                                     LCD_COLOR Color_Foreground) {
+  LCD_POINT Xpoint = Xstart;
+  LCD_POINT Ypoint = Ystart;
+  if (Xstart >= sLCD_DIS.LCD_Dis_Column || Ystart >= sLCD_DIS.LCD_Dis_Page) {
+    return;
+  }
+  for (; *pString != '\0'; pString++) {
+    if ((Xpoint + Font->Width) > sLCD_DIS.LCD_Dis_Column) {
+      Xpoint = Xstart;
+      Ypoint += Font->Height;
+    }
+    if ((Ypoint + Font->Height) > sLCD_DIS.LCD_Dis_Page) {
+      Xpoint = Xstart;
+      Ypoint = Ystart;
+    }
+    Ref_DisplayChar(Lcd, Xpoint, Ypoint, *pString, Font, Color_Background,
+                    Color_Foreground);
+    Xpoint += Font->Width;
+  }
+}
+#endif
@@ -0,0 +1,60 @@
+#ifndef __LCD_TEST_H
+#define __LCD_TEST_H
+
+#include "LCD.h"
+#include "LCD_Host.h"
+
+#include <stdio.h>
+#include <vector>
+
+/********************************************************************************
+  function:
+                        Checks of the host tests, a failure is counted and
+                        printed, the test goes on
+********************************************************************************/
+static int test_failures;
+
+#define TEST_CHECK(Cond)                                                       \
+  do {                                                                         \
+    if (!(Cond)) {                                                             \
+      fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #Cond); \
+      test_failures++;                                                         \
+    }                                                                          \
+  } while (0)
+
+#define TEST_RESULT() (test_failures ? 1 : 0)
+
+/********************************************************************************
+  function:
+                        Byte stream seen by the panel, DC low bytes as
+                        0x100 | register
+  note:
+                        Bytes are passed on to Next (an emulator), if any.
+********************************************************************************/
+class Test_Stream : public LCD_Host_Listener {
+  LCD_Host_Listener *next;
+
+public:
+  std::vector<uint16_t> Bytes;
+
+  Test_Stream(LCD_Host_Listener *Next = nullptr) { next = Next; }
+
+  void LCD_OnReset(void) override {
+    if (next) {
+      next->LCD_OnReset();
+    }
+  }
+  void LCD_OnCommand(uint8_t Reg) override {
+    Bytes.push_back(0x100 | Reg);
+    if (next) {
+      next->LCD_OnCommand(Reg);
+    }
+  }
+  void LCD_OnData(const uint8_t *Data, uint32_t Len) override {
+    Bytes.insert(Bytes.end(), Data, Data + Len);
+    if (next) {
+      next->LCD_OnData(Data, Len);
+    }
+  }
+};
+#endif
@@ -0,0 +1,242 @@
+/***********************************************************************************************************************
+  | file      	:	Test_Pico.cpp
+  | function	:	GPIO, SPI, DMA and IRQ of the Pico SDK, simulated for
+  |                 the host tests of the SPI transport
+***********************************************************************************************************************/
+
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/spi.h"
+
+#include <string.h>
+
+#define TEST_DREQ_SPI0_TX 16
+
+spi_inst_t test_spi[2] = {{{0, 0}, 8}, {{0, 0}, 8}};
+
+typedef struct {
+  dma_channel_config Config;
+  volatile void *Write;
+  const volatile void *Read;
+  uint Count;
+  bool Pending;
+  bool Irq_Enabled;
+  bool Irq_Status;
+} TEST_DMA_CHANNEL;
+
+static TEST_DMA_CHANNEL test_dma[NUM_DMA_CHANNELS];
+static uint test_dma_claimed;
+static irq_handler_t test_dma_handler;
+static bool test_dma_irq_enabled;
+static bool test_dma_running;
+
+static uint test_pin_cs, test_pin_dc, test_pin_rst;
+static bool test_cs = true, test_dc = true;
+static uint64_t test_time_us;
+static LCD_Host_Listener *test_listener;
+static TEST_PICO_STATS test_stats;
+
+/*******************************************************************************
+function:
+                Forget the channels, pins and counts of the previous test
+*******************************************************************************/
+void Test_Pico_Reset(uint Pin_Cs, uint Pin_Dc, uint Pin_Rst,
+                     LCD_Host_Listener *Listener) {
+  memset(test_dma, 0, sizeof(test_dma));
+  memset(&test_stats, 0, sizeof(test_stats));
+  test_dma_claimed = 0;
+  test_pin_cs = Pin_Cs;
+  test_pin_dc = Pin_Dc;
+  test_pin_rst = Pin_Rst;
+  test_cs = true;
+  test_dc = true;
+  test_listener = Listener;
+  for (spi_inst_t &Spi : test_spi) {
+    Spi.Data_Bits = 8;
+  }
+}
+
+void Test_Pico_SetListener(LCD_Host_Listener *Listener) {
+  test_listener = Listener;
+}
+
+const TEST_PICO_STATS *Test_Pico_GetStats(void) { return &test_stats; }
+
+// A byte on MOSI, seen by the panel only while CS is low
+static void Test_Pico_Shift(uint8_t Byte) {
+  if (test_cs) {
+    test_stats.Errors++;
+    return;
+  }
+  if (!test_listener) {
+    return;
+  }
+  if (test_dc) {
+    test_listener->LCD_OnData(&Byte, 1);
+  } else {
+    test_listener->LCD_OnCommand(Byte);
+  }
+}
+
+/*******************************************************************************
+function:
+                Complete the triggered DMA transfer, if any, and raise its
+                interrupt
+*******************************************************************************/
+bool Test_Pico_RunDMA(void) {
+  for (uint Chan = 0; Chan < NUM_DMA_CHANNELS; Chan++) {
+    TEST_DMA_CHANNEL *Dma = &test_dma[Chan];
+    if (!Dma->Pending) {
+      continue;
+    }
+    spi_inst_t *Spi = nullptr;
+    for (spi_inst_t &Candidate : test_spi) {
+      if (Dma->Write == &Candidate.hw.dr) {
+        Spi = &Candidate;
+      }
+    }
+    if (!Spi || Dma->Config.write_increment ||
+        Dma->Config.size != DMA_SIZE_16 ||
+        Dma->Config.dreq != spi_get_dreq(Spi, true)) {
+      test_stats.Errors++;
+    }
+
+    test_dma_running = true;
+    const volatile uint16_t *Read = (const volatile uint16_t *)Dma->Read;
+    for (uint i = 0; Spi && i < Dma->Count; i++) {
+      uint16_t Word = *Read;
+      if (Dma->Config.read_increment) {
+        Read++;
+      }
+      if (Spi->Data_Bits == 16) {
+        Test_Pico_Shift(Word >> 8);
+      }
+      Test_Pico_Shift(Word & 0xff);
+    }
+    test_stats.Read_Increment = Dma->Config.read_increment;
+    test_stats.Data_Bits = Spi ? Spi->Data_Bits : 0;
+    test_stats.Dma_Runs++;
+    Dma->Pending = false;
+    test_dma_running = false;
+
+    if (Dma->Irq_Enabled) {
+      Dma->Irq_Status = true;
+      if (test_dma_irq_enabled && test_dma_handler) {
+        test_dma_handler();
+      }
+    }
+    return true;
+  }
+  return false;
+}
+
+void gpio_put(uint Gpio, bool Value) {
+  if (Gpio == test_pin_cs) {
+    if (test_dma_running) {
+      test_stats.Errors++;
+    }
+    if (test_cs && !Value) {
+      test_stats.Cs_Edges++;
+    }
+    test_cs = Value;
+  } else if (Gpio == test_pin_dc) {
+    if (test_dma_running) {
+      test_stats.Errors++;
+    }
+    test_dc = Value;
+  } else if (Gpio == test_pin_rst && !Value && test_listener) {
+    test_listener->LCD_OnReset();
+  }
+}
+
+void sleep_us(uint64_t Us) { test_time_us += Us; }
+void sleep_ms(uint32_t Ms) { test_time_us += (uint64_t)Ms * 1000; }
+uint64_t time_us_64(void) { return test_time_us; }
+void tight_loop_contents(void) { Test_Pico_RunDMA(); }
+
+int spi_write_blocking(spi_inst_t *spi, const uint8_t *src, size_t len) {
+  if (spi->Data_Bits != 8) {
+    test_stats.Errors++;
+  }
+  for (size_t i = 0; i < len; i++) {
+    Test_Pico_Shift(src[i]);
+  }
+  return (int)len;
+}
+
+void spi_set_format(spi_inst_t *spi, uint data_bits, spi_cpol_t cpol,
+                    spi_cpha_t cpha, spi_order_t order) {
+  if (test_dma_running || cpol != SPI_CPOL_0 || cpha != SPI_CPHA_0 ||
+      order != SPI_MSB_FIRST) {
+    test_stats.Errors++;
+  }
+  spi->Data_Bits = data_bits;
+}
+
+bool spi_is_busy(const spi_inst_t *spi) { return false; }
+bool spi_is_readable(const spi_inst_t *spi) { return false; }
+spi_hw_t *spi_get_hw(spi_inst_t *spi) { return &spi->hw; }
+uint spi_get_dreq(spi_inst_t *spi, bool is_tx) {
+  return TEST_DREQ_SPI0_TX + 2 * (spi - test_spi) + (is_tx ? 0 : 1);
+}
+
+int dma_claim_unused_channel(bool required) {
+  return test_dma_claimed < NUM_DMA_CHANNELS ? test_dma_claimed++ : -1;
+}
+
+dma_channel_config dma_channel_get_default_config(uint channel) {
+  dma_channel_config Config;
+  Config.size = DMA_SIZE_32;
+  Config.read_increment = true;
+  Config.write_increment = false;
+  Config.dreq = 0x3f; // Unpaced
+  return Config;
+}
+
+void channel_config_set_transfer_data_size(
+    dma_channel_config *c, enum dma_channel_transfer_size size) {
+  c->size = size;
+}
+void channel_config_set_read_increment(dma_channel_config *c, bool incr) {
+  c->read_increment = incr;
+}
+void channel_config_set_write_increment(dma_channel_config *c, bool incr) {
+  c->write_increment = incr;
+}
+void channel_config_set_dreq(dma_channel_config *c, uint dreq) {
+  c->dreq = dreq;
+}
+
+void dma_channel_configure(uint channel, const dma_channel_config *config,
+                           volatile void *write_addr,
+                           const volatile void *read_addr,
+                           uint transfer_count, bool trigger) {
+  TEST_DMA_CHANNEL *Dma = &test_dma[channel];
+  Dma->Config = *config;
+  Dma->Write = write_addr;
+  Dma->Read = read_addr;
+  Dma->Count = transfer_count;
+  Dma->Pending = trigger;
+}
+
+void dma_channel_set_irq0_enabled(uint channel, bool enabled) {
+  test_dma[channel].Irq_Enabled = enabled;
+}
+bool dma_channel_get_irq0_status(uint channel) {
+  return test_dma[channel].Irq_Status;
+}
+void dma_channel_acknowledge_irq0(uint channel) {
+  test_dma[channel].Irq_Status = false;
+}
+
+void irq_add_shared_handler(uint num, irq_handler_t handler,
+                            uint8_t order_priority) {
+  if (num == DMA_IRQ_0) {
+    test_dma_handler = handler;
+  }
+}
+void irq_set_enabled(uint num, bool enabled) {
+  if (num == DMA_IRQ_0) {
+    test_dma_irq_enabled = enabled;
+  }
+}
@@ -0,0 +1,37 @@
+#ifndef __TEST_PICO_H
+#define __TEST_PICO_H
+
+#include "LCD_Host.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <sys/types.h>
+
+/********************************************************************************
+  function:
+                        Software stand-in for the parts of the Pico SDK the
+                        SPI and DMA transports use, so LCD_SPI.cpp and
+                        LCD_DMA.cpp run on the host
+  note:
+                        Bytes are shifted out as the hardware would: in 8
+                        bit frames spi_write_blocking sends each byte, in 16
+                        bit frames a DMA word goes out MSB first, in 8 bit
+                        frames only its low byte. A triggered DMA runs the
+                        next time the CPU spins (tight_loop_contents) or on
+                        Test_Pico_RunDMA, then raises DMA_IRQ_0. What reaches
+                        the panel with CS low is passed to the listener.
+********************************************************************************/
+typedef struct {
+  uint32_t Cs_Edges;     // CS falling edges
+  uint32_t Dma_Runs;     // DMA transfers completed
+  uint32_t Errors;       // Bytes with CS high, DC or format changed mid-DMA
+  bool Read_Increment;   // Configuration of the last DMA transfer
+  uint8_t Data_Bits;     // SPI frame size during the last DMA transfer
+} TEST_PICO_STATS;
+
+void Test_Pico_Reset(uint Pin_Cs, uint Pin_Dc, uint Pin_Rst,
+                     LCD_Host_Listener *Listener);
+void Test_Pico_SetListener(LCD_Host_Listener *Listener);
+bool Test_Pico_RunDMA(void);
+const TEST_PICO_STATS *Test_Pico_GetStats(void);
+#endif
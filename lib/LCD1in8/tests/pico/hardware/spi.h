@@ -0,0 +1,34 @@
+#ifndef _HARDWARE_SPI_H
+#define _HARDWARE_SPI_H
+
+// Host stand-in, see Test_Pico.h
+#include "pico/stdlib.h"
+
+#define SPI_SSPICR_RORIC_BITS 0x00000001
+
+typedef enum { SPI_CPOL_0 = 0, SPI_CPOL_1 = 1 } spi_cpol_t;
+typedef enum { SPI_CPHA_0 = 0, SPI_CPHA_1 = 1 } spi_cpha_t;
+typedef enum { SPI_LSB_FIRST = 0, SPI_MSB_FIRST = 1 } spi_order_t;
+
+typedef struct {
+  volatile uint32_t dr;
+  volatile uint32_t icr;
+} spi_hw_t;
+
+typedef struct {
+  spi_hw_t hw;
+  uint Data_Bits;
+} spi_inst_t;
+
+extern spi_inst_t test_spi[2];
+#define spi0 (&test_spi[0])
+#define spi1 (&test_spi[1])
+
+int spi_write_blocking(spi_inst_t *spi, const uint8_t *src, size_t len);
+void spi_set_format(spi_inst_t *spi, uint data_bits, spi_cpol_t cpol,
+                    spi_cpha_t cpha, spi_order_t order);
+bool spi_is_busy(const spi_inst_t *spi);
+bool spi_is_readable(const spi_inst_t *spi);
+spi_hw_t *spi_get_hw(spi_inst_t *spi);
+uint spi_get_dreq(spi_inst_t *spi, bool is_tx);
+#endif
@@ -0,0 +1,12 @@
+#ifndef _PICO_STDLIB_H
+#define _PICO_STDLIB_H
+
+// Host stand-in, see Test_Pico.h
+#include "Test_Pico.h"
+
+void gpio_put(uint Gpio, bool Value);
+void sleep_us(uint64_t Us);
+void sleep_ms(uint32_t Ms);
+uint64_t time_us_64(void);
+void tight_loop_contents(void);
+#endif
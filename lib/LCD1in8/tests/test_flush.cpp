@@ -0,0 +1,41 @@
+/***********************************************************************************************************************
+  | file      	:	test_flush.cpp
+  | function	:	Framebuffer flush of several regions, advanced by polling
+***********************************************************************************************************************/
+
+#include "LCD_Emulator.h"
+#include "LCD_Test.h"
+
+static LCD_COLOR test_frame[LCD_FRAMEBUFFER_SIZE];
+
+int main(void) {
+  static LCD_ST7735S_Emulator Panel;
+  LCD_Host_Transport Bus;
+  Bus.LCD_SetListener(&Panel);
+  LCD_ST7735S Lcd(&Bus);
+  Lcd.LCD_Init(L2R_U2D);
+  Lcd.LCD_SetFramebuffer(test_frame);
+  Lcd.LCD_Clear(WHITE);
+  Lcd.LCD_Flush();
+
+  // Regions too far apart to be merged, each needs its own window
+  Lcd.LCD_SetArealColor(2, 3, 10, 9, RED);
+  Lcd.LCD_SetArealColor(90, 120, 120, 150, BLUE);
+  Lcd.LCD_SetArealColor(50, 60, 51, 61, GREEN);
+  Panel.LCD_ResetStats();
+
+  Lcd.LCD_Flush_Async();
+  uint32_t Polls = 0;
+  while (Lcd.LCD_Busy()) {
+    Polls++;
+  }
+  TEST_CHECK(Panel.LCD_GetStats()->Windows == 3);
+  TEST_CHECK(Panel.LCD_GetStats()->Pixels == 8 * 6 + 30 * 30 + 1);
+  TEST_CHECK(Panel.LCD_GetPixel(2, 3) == RED);
+  TEST_CHECK(Panel.LCD_GetPixel(9, 8) == RED);
+  TEST_CHECK(Panel.LCD_GetPixel(10, 8) == WHITE);
+  TEST_CHECK(Panel.LCD_GetPixel(119, 149) == BLUE);
+  TEST_CHECK(Panel.LCD_GetPixel(50, 60) == GREEN);
+  printf("3 regions flushed, %u polls\n", Polls);
+  return TEST_RESULT();
+}
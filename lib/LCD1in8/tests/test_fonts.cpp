@@ -0,0 +1,85 @@
+/***********************************************************************************************************************
+  | file      	:	test_fonts.cpp
+  | function	:	Packed fonts against the sFONT tables they were compiled
+  |                 from, row by row, and their size
+***********************************************************************************************************************/
+
+#include "LCD_Test.h"
+
+#include <string.h>
+
+typedef struct {
+  const char *Name;
+  sFONT *Table;
+  sPFONT *Packed;
+} TEST_FONT;
+
+// Bytes of glyph data, up to where the last glyph's decoder stops reading
+static uint32_t Test_DataSize(const sPFONT *Font) {
+  uint32_t Size = 0;
+  for (uint8_t i = 0; i < Font->Count; i++) {
+    sGLYPH_DECODER Decoder;
+    uint8_t Row[4];
+    Font_DecodePacked(&Decoder, Font, &Font->Glyphs[i]);
+    for (uint16_t y = 0; y < Font->Height; y++) {
+      Font_DecodeRow(&Decoder, Row, Font->Advance);
+    }
+    uint32_t End = Decoder.Data - Font->Data + (Decoder.Bit ? 1 : 0);
+    Size = End > Size ? End : Size;
+  }
+  return Size;
+}
+
+static void Test_Font(const TEST_FONT *Font) {
+  const sFONT *Table = Font->Table;
+  const sPFONT *Packed = Font->Packed;
+  TEST_CHECK(Packed->Count == 95 && Packed->First == ' ');
+  TEST_CHECK(Packed->Height == Table->Height);
+  TEST_CHECK(!Packed->Advances && Packed->Advance == Table->Width);
+
+  uint32_t Different = 0;
+  for (int Char = ' '; Char <= '~'; Char++) {
+    const sGLYPH *Glyph = Font_FindGlyph(Packed, Char);
+    TEST_CHECK(Glyph && Font_Advance(Packed, Glyph) == Table->Width);
+
+    sGLYPH_DECODER Table_Decoder, Packed_Decoder;
+    Font_DecodeTable(&Table_Decoder, Table, Char);
+    Font_DecodePacked(&Packed_Decoder, Packed, Glyph);
+    for (uint16_t y = 0; y < Table->Height; y++) {
+      uint8_t Table_Row[4] = {}, Packed_Row[4] = {};
+      Font_DecodeRow(&Table_Decoder, Table_Row, Table->Width);
+      Font_DecodeRow(&Packed_Decoder, Packed_Row, Table->Width);
+      for (uint16_t x = 0; x < Table->Width; x++) {
+        uint8_t Mask = 0x80 >> (x % 8);
+        Different += (Table_Row[x / 8] & Mask) != (Packed_Row[x / 8] & Mask);
+      }
+    }
+  }
+  if (Different) {
+    fprintf(stderr, "%s: %u pixels differ\n", Font->Name, Different);
+  }
+  TEST_CHECK(Different == 0);
+
+  // Smaller than the table, padding bytes and all
+  uint32_t Table_Size = 95 * Table->Height * ((Table->Width + 7) / 8);
+  uint32_t Packed_Size = Test_DataSize(Packed) + 95 * sizeof(sGLYPH);
+  printf("%-8s %5u bytes as sFONT, %5u packed\n", Font->Name, Table_Size,
+         Packed_Size);
+  TEST_CHECK(Packed_Size < Table_Size);
+}
+
+int main(void) {
+  static const TEST_FONT Fonts[] = {
+      {"Font8", &Font8, &Font8_Packed},    {"Font12", &Font12, &Font12_Packed},
+      {"Font16", &Font16, &Font16_Packed}, {"Font20", &Font20, &Font20_Packed},
+      {"Font24", &Font24, &Font24_Packed},
+  };
+  TEST_CHECK(sizeof(sGLYPH) == 4);
+  for (const TEST_FONT &Font : Fonts) {
+    Test_Font(&Font);
+  }
+  TEST_CHECK(!Font_FindGlyph(&Font8_Packed, '\x7f'));
+  TEST_CHECK(!Font_FindGlyph(&Font8_Packed, '\x1f'));
+  TEST_CHECK(Font_Advance(&Font8_Packed, nullptr) == 0);
+  return TEST_RESULT();
+}
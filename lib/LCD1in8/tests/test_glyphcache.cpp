@@ -0,0 +1,221 @@
+/***********************************************************************************************************************
+  | file      	:	test_glyphcache.cpp
+  | function	:	Lookups, least recently used eviction and stamp wrap of
+  |                 LCD_Glyph_Cache, and cached cells against expanded ones
+***********************************************************************************************************************/
+
+#include "LCD_Emulator.h"
+#include "LCD_GlyphCache.h"
+#include "LCD_Test.h"
+
+#include <functional>
+
+#define TEST_SLOTS 3
+
+static LCD_COLOR test_pool[TEST_SLOTS * LCD_GLYPH_BUFFER];
+static LCD_COLOR test_frame[LCD_FRAMEBUFFER_SIZE];
+
+/********************************************************************************
+  function:
+                        Cache whose use stamps can be looked at and set
+********************************************************************************/
+class Test_Cache : public LCD_Glyph_Cache {
+public:
+  Test_Cache(LCD_COLOR *Pool, uint32_t Pool_Size, uint32_t Slot_Pixels)
+      : LCD_Glyph_Cache(Pool, Pool_Size, Slot_Pixels) {}
+
+  void Test_SetClock(uint32_t Clock) { clock = Clock; }
+  uint32_t Test_LastUse(uint32_t Slot) { return entry[Slot].Last_Use; }
+  uint32_t Test_Slot(const LCD_COLOR *Cell) {
+    return (Cell - pool) / slot_pixels;
+  }
+};
+
+// Cell of the character, inserted when it is missed
+static const LCD_COLOR *Test_Use(Test_Cache *Cache, char Char,
+                                 LCD_COLOR Color_Foreground = BLACK) {
+  const LCD_COLOR *Cell = Cache->LCD_Find(&Font8, Char, WHITE,
+                                          Color_Foreground);
+  return Cell ? Cell
+              : Cache->LCD_Insert(&Font8, Char, WHITE, Color_Foreground);
+}
+
+static void Test_Lookups(void) {
+  Test_Cache Cache(test_pool, sizeof(test_pool), LCD_GLYPH_BUFFER);
+  TEST_CHECK(Cache.LCD_Slots() == TEST_SLOTS);
+
+  const LCD_COLOR *A = Test_Use(&Cache, 'A');
+  const LCD_COLOR *B = Test_Use(&Cache, 'B');
+  const LCD_COLOR *C = Test_Use(&Cache, 'C');
+  TEST_CHECK(A && B && C && A != B && B != C && A != C);
+  TEST_CHECK(Cache.LCD_GetStats()->Misses == 3);
+  TEST_CHECK(Cache.LCD_GetStats()->Evictions == 0);
+
+  // Keyed by both colors too
+  TEST_CHECK(Cache.LCD_Find(&Font8, 'A', WHITE, BLACK) == A);
+  TEST_CHECK(!Cache.LCD_Find(&Font8, 'A', WHITE, RED));
+  TEST_CHECK(!Cache.LCD_Find(&Font8, 'A', BLACK, BLACK));
+  TEST_CHECK(!Cache.LCD_Find(&Font12, 'A', WHITE, BLACK));
+  TEST_CHECK(Cache.LCD_GetStats()->Hits == 1);
+  TEST_CHECK(Cache.LCD_GetStats()->Misses == 6);
+
+  // A was used last, B is the least recently used
+  const LCD_COLOR *D = Test_Use(&Cache, 'D');
+  TEST_CHECK(D == B);
+  TEST_CHECK(Cache.LCD_GetStats()->Evictions == 1);
+  TEST_CHECK(!Cache.LCD_Find(&Font8, 'B', WHITE, BLACK));
+  TEST_CHECK(Cache.LCD_Find(&Font8, 'C', WHITE, BLACK) == C);
+  TEST_CHECK(Cache.LCD_Find(&Font8, 'A', WHITE, BLACK) == A);
+  TEST_CHECK(Cache.LCD_Find(&Font8, 'D', WHITE, BLACK) == D);
+
+  // Now C is
+  TEST_CHECK(Test_Use(&Cache, 'E') == C);
+  TEST_CHECK(Cache.LCD_GetStats()->Evictions == 2);
+
+  Cache.LCD_ResetStats();
+  TEST_CHECK(Cache.LCD_GetStats()->Hits == 0);
+  Cache.LCD_Clear();
+  TEST_CHECK(!Cache.LCD_Find(&Font8, 'A', WHITE, BLACK));
+
+  // Cells larger than a slot, and a pool without a slot
+  Test_Cache Small(test_frame, sizeof(test_frame), 8 * 8);
+  TEST_CHECK(Small.LCD_Slots() == LCD_GLYPH_CACHE_ENTRIES);
+  TEST_CHECK(Small.LCD_Insert(&Font8, 'A', WHITE, BLACK));
+  TEST_CHECK(!Small.LCD_Insert(&Font12, 'A', WHITE, BLACK));
+  Test_Cache Empty(test_pool, LCD_GLYPH_BUFFER, LCD_GLYPH_BUFFER);
+  TEST_CHECK(Empty.LCD_Slots() == 0);
+  TEST_CHECK(!Empty.LCD_Insert(&Font8, 'A', WHITE, BLACK));
+}
+
+static void Test_StampWrap(void) {
+  Test_Cache Cache(test_pool, sizeof(test_pool), LCD_GLYPH_BUFFER);
+  Cache.Test_SetClock(UINT32_MAX - 2);
+
+  const LCD_COLOR *A = Test_Use(&Cache, 'A');
+  const LCD_COLOR *B = Test_Use(&Cache, 'B');
+  TEST_CHECK(Cache.Test_LastUse(Cache.Test_Slot(B)) == UINT32_MAX);
+
+  // The clock wraps, A and B become equally old and C is the newest
+  const LCD_COLOR *C = Test_Use(&Cache, 'C');
+  TEST_CHECK(Cache.Test_LastUse(Cache.Test_Slot(A)) == 1);
+  TEST_CHECK(Cache.Test_LastUse(Cache.Test_Slot(B)) == 1);
+  TEST_CHECK(Cache.Test_LastUse(Cache.Test_Slot(C)) == 2);
+
+  // A used cell is never taken for a free one
+  TEST_CHECK(Cache.LCD_Find(&Font8, 'B', WHITE, BLACK) == B);
+  TEST_CHECK(Test_Use(&Cache, 'D') == A);
+  TEST_CHECK(Test_Use(&Cache, 'E') == C);
+  TEST_CHECK(Cache.LCD_Find(&Font8, 'B', WHITE, BLACK) == B);
+  TEST_CHECK(Cache.LCD_GetStats()->Evictions == 2);
+}
+
+/********************************************************************************
+  function:
+                        Draw on a panel with the cache and on one without,
+                        both the same way, and count the pixels that differ
+********************************************************************************/
+static uint32_t Test_Render(bool Framebuffer,
+                            const std::function<void(LCD_ST7735S *)> &Draw) {
+  static LCD_ST7735S_Emulator Panel, Ref_Panel;
+  LCD_Host_Transport Bus, Ref_Bus;
+  Bus.LCD_SetListener(&Panel);
+  Ref_Bus.LCD_SetListener(&Ref_Panel);
+  LCD_ST7735S Lcd(&Bus), Ref_Lcd(&Ref_Bus);
+  Lcd.LCD_Init(L2R_U2D);
+  Ref_Lcd.LCD_Init(L2R_U2D);
+  if (Framebuffer) {
+    Lcd.LCD_SetFramebuffer(test_frame);
+  }
+  Lcd.LCD_Clear(GRAY);
+  Ref_Lcd.LCD_Clear(GRAY);
+
+  LCD_Glyph_Cache Cache(test_pool, sizeof(test_pool));
+  Lcd.LCD_SetGlyphCache(&Cache);
+  // Missed on the first pass, cached on the second
+  for (int Pass = 0; Pass < 2; Pass++) {
+    Draw(&Lcd);
+    Draw(&Ref_Lcd);
+  }
+  Lcd.LCD_Flush();
+  TEST_CHECK(Cache.LCD_GetStats()->Hits > 0);
+
+  uint32_t Different = 0;
+  for (LCD_POINT Y = 0; Y < sLCD_DIS.LCD_Dis_Page; Y++) {
+    for (LCD_POINT X = 0; X < sLCD_DIS.LCD_Dis_Column; X++) {
+      Different += Panel.LCD_GetPixel(X, Y) != Ref_Panel.LCD_GetPixel(X, Y);
+    }
+  }
+  return Different;
+}
+
+static void Test_Cells(bool Framebuffer) {
+  TEST_CHECK(Test_Render(Framebuffer, [](LCD_ST7735S *Lcd) {
+               Lcd->LCD_DisplayChar(5, 7, 'g', &Font24, BLUE, YELLOW);
+               Lcd->LCD_DisplayChar(30, 7, 'g', &Font24, BLUE, YELLOW);
+               Lcd->LCD_DisplayChar(60, 7, 'g', &Font24, YELLOW, BLUE);
+               Lcd->LCD_DisplayChar(90, 40, '%', &Font12, BLACK, RED);
+               // Clipped cells are expanded
+               Lcd->LCD_DisplayChar(120, 150, 'W', &Font16, BLACK, RED);
+             }) == 0);
+  TEST_CHECK(Test_Render(Framebuffer, [](LCD_ST7735S *Lcd) {
+               Lcd->LCD_DisplayString(2, 60, "ab", &Font20, BLACK, CYAN);
+               Lcd->LCD_DisplayString(2, 90, "Hello", &Font8, BLACK, CYAN);
+               Lcd->LCD_DisplayString(100, 120, "ba", &Font20, BLACK, CYAN);
+             }) == 0);
+}
+
+// A Font16 hex readout, drawn twice
+static void Test_Readout(void) {
+  static LCD_ST7735S_Emulator Panel, Ref_Panel;
+  LCD_Host_Transport Bus, Ref_Bus;
+  Bus.LCD_SetListener(&Panel);
+  Ref_Bus.LCD_SetListener(&Ref_Panel);
+  LCD_ST7735S Lcd(&Bus), Ref_Lcd(&Ref_Bus);
+  Lcd.LCD_Init(L2R_U2D);
+  Ref_Lcd.LCD_Init(L2R_U2D);
+  Lcd.LCD_Clear(BLACK);
+  Ref_Lcd.LCD_Clear(BLACK);
+
+  static LCD_COLOR Pool[16 * LCD_GLYPH_BUFFER];
+  LCD_Glyph_Cache Cache(Pool, sizeof(Pool));
+  Lcd.LCD_SetGlyphCache(&Cache);
+
+  const char *Text = "0x00C0FFEE";
+  LCD_EMU_STATS First, Second;
+  Panel.LCD_ResetStats();
+  Lcd.LCD_DisplayString(4, 40, Text, &Font16, BLACK, GREEN);
+  First = *Panel.LCD_GetStats();
+  // '0', 'x', 'C', 'F' and 'E'
+  TEST_CHECK(Cache.LCD_GetStats()->Misses == 5);
+  TEST_CHECK(Cache.LCD_GetStats()->Hits == 5);
+
+  Panel.LCD_ResetStats();
+  Lcd.LCD_DisplayString(4, 40, Text, &Font16, BLACK, GREEN);
+  Second = *Panel.LCD_GetStats();
+  TEST_CHECK(Cache.LCD_GetStats()->Misses == 5);
+  TEST_CHECK(Cache.LCD_GetStats()->Hits == 15);
+  TEST_CHECK(Cache.LCD_GetStats()->Evictions == 0);
+
+  // One window of whole cells, whether the cells are cached or not
+  TEST_CHECK(First.Windows == 1 && Second.Windows == 1);
+  TEST_CHECK(Second.Pixels == 10 * 11 * 16);
+  TEST_CHECK(Second.Bytes == First.Bytes);
+
+  Ref_Lcd.LCD_DisplayString(4, 40, Text, &Font16, BLACK, GREEN);
+  uint32_t Different = 0;
+  for (LCD_POINT Y = 0; Y < sLCD_DIS.LCD_Dis_Page; Y++) {
+    for (LCD_POINT X = 0; X < sLCD_DIS.LCD_Dis_Column; X++) {
+      Different += Panel.LCD_GetPixel(X, Y) != Ref_Panel.LCD_GetPixel(X, Y);
+    }
+  }
+  TEST_CHECK(Different == 0);
+}
+
+int main(void) {
+  Test_Lookups();
+  Test_StampWrap();
+  Test_Cells(false);
+  Test_Cells(true);
+  Test_Readout();
+  return TEST_RESULT();
+}
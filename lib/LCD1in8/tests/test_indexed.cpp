@@ -0,0 +1,171 @@
+/***********************************************************************************************************************
+  | file      	:	test_indexed.cpp
+  | function	:	Indexed framebuffers at 4 and 8 bpp against an RGB565
+  |                 framebuffer drawn the same way, a full palette and a
+  |                 recolored entry
+***********************************************************************************************************************/
+
+#include "LCD_Emulator.h"
+#include "LCD_Test.h"
+
+static uint8_t test_indices[LCD_INDEXED_SIZE(8)];
+static LCD_COLOR test_frame[LCD_FRAMEBUFFER_SIZE];
+static LCD_COLOR test_palette[256];
+
+static LCD_ST7735S_Emulator test_panel, test_ref_panel;
+
+// Entry of Palette closest to Color, as LCD_PaletteIndex measures it
+static LCD_COLOR Ref_Nearest(const LCD_COLOR *Palette, uint16_t Colors,
+                             LCD_COLOR Color) {
+  LCD_COLOR Best = Palette[0];
+  uint32_t Best_Distance = UINT32_MAX;
+  for (uint16_t i = 0; i < Colors; i++) {
+    int32_t R = ((Palette[i] >> 11) - (Color >> 11)) * 2;
+    int32_t G = ((Palette[i] >> 5) & 0x3F) - ((Color >> 5) & 0x3F);
+    int32_t B = ((Palette[i] & 0x1F) - (Color & 0x1F)) * 2;
+    uint32_t Distance = R * R + G * G + B * B;
+    if (Distance < Best_Distance) {
+      Best = Palette[i];
+      Best_Distance = Distance;
+    }
+  }
+  return Best;
+}
+
+static uint32_t Test_Different(void) {
+  uint32_t Different = 0;
+  for (LCD_POINT Y = 0; Y < sLCD_DIS.LCD_Dis_Page; Y++) {
+    for (LCD_POINT X = 0; X < sLCD_DIS.LCD_Dis_Column; X++) {
+      Different += test_panel.LCD_GetPixel(X, Y) !=
+                   test_ref_panel.LCD_GetPixel(X, Y);
+    }
+  }
+  return Different;
+}
+
+// Everything at odd and even X, in fewer colors than 4bpp holds
+static void Test_Draw(LCD_ST7735S *Lcd) {
+  static const LCD_COLOR Bitmap[5 * 3] = {
+      RED,  GREEN, BLUE,  RED,  GREEN, //
+      BLUE, RED,   GREEN, BLUE, RED,   //
+      GRAY, GRAY,  BLACK, GRAY, GRAY,
+  };
+  Lcd->LCD_Clear(GRAY);
+  Lcd->LCD_SetArealColor(1, 1, 2, 40, RED);
+  Lcd->LCD_SetArealColor(3, 5, 20, 8, BLUE);
+  Lcd->LCD_SetArealColor(21, 9, 22, 10, GREEN);
+  Lcd->LCD_SetArealColor(4, 12, 17, 15, YELLOW);
+  Lcd->LCD_DrawBitmap(7, 20, 5, 3, Bitmap);
+  Lcd->LCD_DrawBitmap(30, 20, 5, 3, Bitmap);
+  Lcd->LCD_DrawBitmap(41, 20, 4, 3, Bitmap);
+  Lcd->LCD_DrawLine(0, 127, 127, 50, MAGENTA, LINE_SOLID, DOT_PIXEL_1X1);
+  Lcd->LCD_DrawCircle(63, 90, 21, CYAN, DRAW_FULL, DOT_PIXEL_1X1);
+  Lcd->LCD_DrawCircle(63, 90, 30, BLACK, DRAW_EMPTY, DOT_PIXEL_2X2);
+  // Opaque cells, and a transparent string over the circle
+  Lcd->LCD_DisplayString(3, 45, "Odd 4bpp", &Font12, BLACK, WHITE);
+  Lcd->LCD_DisplayString(2, 60, "Even", &Font16, BLUE, YELLOW);
+  Lcd->LCD_DisplayString(41, 85, "WiW", &Font20, FONT_BACKGROUND, RED);
+  Lcd->LCD_DisplayString(5, 140, "packed", &Font8_Packed, GREEN, BLACK);
+}
+
+/********************************************************************************
+  function:
+                        Indexed panel and RGB565 panel, both initialized
+********************************************************************************/
+static void Test_Begin(LCD_ST7735S *Lcd, LCD_ST7735S *Ref_Lcd, uint8_t Bpp,
+                       uint16_t Colors) {
+  Lcd->LCD_Init(L2R_U2D);
+  Ref_Lcd->LCD_Init(L2R_U2D);
+  Lcd->LCD_SetIndexedFramebuffer(test_indices, Bpp, test_palette, Colors);
+  Ref_Lcd->LCD_SetFramebuffer(test_frame);
+}
+
+static void Test_Indexed(uint8_t Bpp) {
+  LCD_Host_Transport Bus, Ref_Bus;
+  Bus.LCD_SetListener(&test_panel);
+  Ref_Bus.LCD_SetListener(&test_ref_panel);
+  LCD_ST7735S Lcd(&Bus), Ref_Lcd(&Ref_Bus);
+  Test_Begin(&Lcd, &Ref_Lcd, Bpp, 0);
+
+  Test_Draw(&Lcd);
+  Test_Draw(&Ref_Lcd);
+  Lcd.LCD_Flush();
+  Ref_Lcd.LCD_Flush();
+  TEST_CHECK(!Lcd.LCD_PaletteFull());
+  TEST_CHECK(Test_Different() == 0);
+
+  // Small changes after a flush, on either half of a 4bpp byte
+  Lcd.LCD_SetArealColor(99, 30, 100, 31, RED);
+  Ref_Lcd.LCD_SetArealColor(99, 30, 100, 31, RED);
+  Lcd.LCD_DisplayString(101, 30, "i", &Font8, FONT_BACKGROUND, BLUE);
+  Ref_Lcd.LCD_DisplayString(101, 30, "i", &Font8, FONT_BACKGROUND, BLUE);
+  Lcd.LCD_Flush();
+  Ref_Lcd.LCD_Flush();
+  TEST_CHECK(Test_Different() == 0);
+
+  // Every RED pixel turns MAGENTA
+  uint8_t Red = 0;
+  while (test_palette[Red] != RED) {
+    Red++;
+  }
+  Lcd.LCD_SetPalette(Red, MAGENTA);
+  LCD_COLOR *Frame = Ref_Lcd.LCD_GetFramebuffer();
+  for (uint32_t i = 0; i < LCD_FRAMEBUFFER_SIZE; i++) {
+    Frame[i] = Frame[i] == RED ? MAGENTA : Frame[i];
+  }
+  Ref_Lcd.LCD_MarkDirty(0, 0, sLCD_DIS.LCD_Dis_Column, sLCD_DIS.LCD_Dis_Page);
+  Lcd.LCD_Flush();
+  Ref_Lcd.LCD_Flush();
+  TEST_CHECK(test_ref_panel.LCD_GetPixel(1, 1) == MAGENTA);
+  TEST_CHECK(Test_Different() == 0);
+}
+
+/********************************************************************************
+  function:
+                        More colors than 4bpp holds, the last ones drawn in
+                        their nearest entry
+********************************************************************************/
+static void Test_Full(void) {
+  LCD_Host_Transport Bus, Ref_Bus;
+  Bus.LCD_SetListener(&test_panel);
+  Ref_Bus.LCD_SetListener(&test_ref_panel);
+  LCD_ST7735S Lcd(&Bus), Ref_Lcd(&Ref_Bus);
+  // Two entries set by the caller
+  test_palette[0] = BLACK;
+  test_palette[1] = WHITE;
+  Test_Begin(&Lcd, &Ref_Lcd, 4, 2);
+
+  // 20 bands of distinct colors, the first 14 take the free entries
+  for (uint16_t i = 0; i < 20; i++) {
+    LCD_COLOR Color = (i * 3 << 11) | (i * 3 << 5) | (31 - i);
+    Lcd.LCD_SetArealColor(1 + i, i * 7, 120 - i, i * 7 + 5, Color);
+    TEST_CHECK(Lcd.LCD_PaletteFull() == (i >= 14));
+    LCD_COLOR Expected = i < 14 ? Color : Ref_Nearest(test_palette, 16, Color);
+    Ref_Lcd.LCD_SetArealColor(1 + i, i * 7, 120 - i, i * 7 + 5, Expected);
+  }
+  Lcd.LCD_Clear(BLACK);
+  TEST_CHECK(Lcd.LCD_PaletteFull());
+
+  // A new indexed framebuffer starts over
+  Test_Begin(&Lcd, &Ref_Lcd, 4, 2);
+  TEST_CHECK(!Lcd.LCD_PaletteFull());
+  for (uint16_t i = 0; i < 20; i++) {
+    LCD_COLOR Color = (i * 3 << 11) | (i * 3 << 5) | (31 - i);
+    LCD_COLOR Expected = i < 14 ? Color : Ref_Nearest(test_palette, 16, Color);
+    Lcd.LCD_SetArealColor(1 + i, i * 7, 120 - i, i * 7 + 5, Color);
+    Ref_Lcd.LCD_SetArealColor(1 + i, i * 7, 120 - i, i * 7 + 5, Expected);
+    Lcd.LCD_DisplayString(3 + i, 145, "x", &Font8, BLACK, Color);
+    Ref_Lcd.LCD_DisplayString(3 + i, 145, "x", &Font8, BLACK, Expected);
+  }
+  Lcd.LCD_Flush();
+  Ref_Lcd.LCD_Flush();
+  TEST_CHECK(test_palette[0] == BLACK && test_palette[1] == WHITE);
+  TEST_CHECK(Test_Different() == 0);
+}
+
+int main(void) {
+  Test_Indexed(8);
+  Test_Indexed(4);
+  Test_Full();
+  return TEST_RESULT();
+}
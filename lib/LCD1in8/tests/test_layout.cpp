@@ -0,0 +1,388 @@
+/***********************************************************************************************************************
+  | file      	:	test_layout.cpp
+  | function	:	Line breaking, alignment and caching of LCD_Text_Layout,
+  |                 and LCD_DisplayText against per-pixel references
+***********************************************************************************************************************/
+
+#include "LCD_Emulator.h"
+#include "LCD_Layout.h"
+#include "LCD_Reference.h"
+#include "LCD_Test.h"
+
+#include <functional>
+#include <string.h>
+
+// Font8 compiled with fontc -p by the build
+extern "C" sPFONT Font8_Proportional;
+
+static LCD_COLOR test_frame[LCD_FRAMEBUFFER_SIZE];
+
+// Line n of a layout is Start, Length, X and Width
+static bool Test_Line(const LCD_LAYOUT *Layout, uint8_t n, uint16_t Start,
+                      uint16_t Length, LCD_POINT X, LCD_LENGTH Width) {
+  const LCD_LAYOUT_LINE *Line = &Layout->Line[n];
+  if (n < Layout->Lines && Line->Start == Start && Line->Length == Length &&
+      Line->X == X && Line->Width == Width) {
+    return true;
+  }
+  fprintf(stderr, "line %u: %u, %u, %u, %u\n", n, Line->Start, Line->Length,
+          Line->X, Line->Width);
+  return false;
+}
+
+// Sum of the advances of a packed string
+static LCD_LENGTH Test_Width(const sPFONT *Font, const char *pString) {
+  LCD_LENGTH Width = 0;
+  for (; *pString != '\0'; pString++) {
+    Width += Font_Advance(Font, Font_FindGlyph(Font, *pString));
+  }
+  return Width;
+}
+
+static void Test_Breaks(void) {
+  LCD_Text_Layout Text;
+  const LCD_LAYOUT *Layout;
+
+  // Only '\n' breaks without a width, the box is the widest line
+  Layout = Text.LCD_Measure("ab\ncde", &Font8);
+  TEST_CHECK(Layout->Lines == 2 && Layout->Width == 15);
+  TEST_CHECK(Layout->Box_Width == 15 && Layout->Line_Height == 8);
+  TEST_CHECK(Layout->Height == 16);
+  TEST_CHECK(Test_Line(Layout, 0, 0, 2, 0, 10));
+  TEST_CHECK(Test_Line(Layout, 1, 3, 3, 0, 15));
+
+  // Empty lines, and no line after a last '\n'
+  Layout = Text.LCD_Measure("a\n\nb\n", &Font8);
+  TEST_CHECK(Layout->Lines == 3);
+  TEST_CHECK(Test_Line(Layout, 1, 2, 0, 0, 0));
+  TEST_CHECK(Test_Line(Layout, 2, 3, 1, 0, 5));
+  Layout = Text.LCD_Measure("", &Font8);
+  TEST_CHECK(Layout->Lines == 0 && Layout->Width == 0 && Layout->Height == 0);
+
+  // Words wrap before the one that does not fit, the space is dropped
+  Layout = Text.LCD_Measure("hello world foo", &Font8, 60);
+  TEST_CHECK(Layout->Lines == 2 && Layout->Box_Width == 60);
+  TEST_CHECK(Test_Line(Layout, 0, 0, 11, 0, 55));
+  TEST_CHECK(Test_Line(Layout, 1, 12, 3, 0, 15));
+
+  // A line that fits exactly, and one pixel less
+  Layout = Text.LCD_Measure("ab cd", &Font8, 25);
+  TEST_CHECK(Layout->Lines == 1 && Test_Line(Layout, 0, 0, 5, 0, 25));
+  Layout = Text.LCD_Measure("ab cd", &Font8, 24);
+  TEST_CHECK(Layout->Lines == 2);
+  TEST_CHECK(Test_Line(Layout, 0, 0, 2, 0, 10));
+  TEST_CHECK(Test_Line(Layout, 1, 3, 2, 0, 10));
+
+  // A line full before a space
+  Layout = Text.LCD_Measure("ab cd ef", &Font8, 10);
+  TEST_CHECK(Layout->Lines == 3);
+  TEST_CHECK(Test_Line(Layout, 0, 0, 2, 0, 10));
+  TEST_CHECK(Test_Line(Layout, 1, 3, 2, 0, 10));
+  TEST_CHECK(Test_Line(Layout, 2, 6, 2, 0, 10));
+  Layout = Text.LCD_Measure("hello world foo", &Font8, 55);
+  TEST_CHECK(Layout->Lines == 2);
+  TEST_CHECK(Test_Line(Layout, 0, 0, 11, 0, 55));
+
+  // A word longer than a line is broken inside
+  Layout = Text.LCD_Measure("abcdefghij", &Font8, 20);
+  TEST_CHECK(Layout->Lines == 3);
+  TEST_CHECK(Test_Line(Layout, 0, 0, 4, 0, 20));
+  TEST_CHECK(Test_Line(Layout, 1, 4, 4, 0, 20));
+  TEST_CHECK(Test_Line(Layout, 2, 8, 2, 0, 10));
+  Layout = Text.LCD_Measure("ab abcdefg", &Font8, 20);
+  TEST_CHECK(Layout->Lines == 3);
+  TEST_CHECK(Test_Line(Layout, 0, 0, 2, 0, 10));
+  TEST_CHECK(Test_Line(Layout, 1, 3, 4, 0, 20));
+  TEST_CHECK(Test_Line(Layout, 2, 7, 3, 0, 15));
+
+  // Spaces at a break are dropped on both sides, elsewhere they are kept
+  Layout = Text.LCD_Measure("ab   cd", &Font8, 15);
+  TEST_CHECK(Layout->Lines == 2);
+  TEST_CHECK(Test_Line(Layout, 0, 0, 2, 0, 10));
+  TEST_CHECK(Test_Line(Layout, 1, 5, 2, 0, 10));
+  Layout = Text.LCD_Measure("ab  ", &Font8);
+  TEST_CHECK(Layout->Lines == 1 && Test_Line(Layout, 0, 0, 4, 0, 20));
+  Layout = Text.LCD_Measure("ab\n  cd", &Font8, 40);
+  TEST_CHECK(Test_Line(Layout, 1, 3, 4, 0, 20));
+
+  // A box narrower than a character still takes one a line
+  Layout = Text.LCD_Measure("abc", &Font8, 3, LCD_ALIGN_RIGHT);
+  TEST_CHECK(Layout->Lines == 3 && Layout->Width == 5);
+  TEST_CHECK(Layout->Box_Width == 3);
+  TEST_CHECK(Test_Line(Layout, 2, 2, 1, 0, 5));
+
+  // Lines past LCD_LAYOUT_LINES are dropped
+  Layout = Text.LCD_Measure("1\n2\n3\n4\n5\n6\n7\n8\n9\n10", &Font8);
+  TEST_CHECK(Layout->Lines == LCD_LAYOUT_LINES);
+  TEST_CHECK(Layout->Height == LCD_LAYOUT_LINES * 8);
+  TEST_CHECK(Test_Line(Layout, LCD_LAYOUT_LINES - 1,
+                       2 * (LCD_LAYOUT_LINES - 1), 1, 0, 5));
+  Layout = Text.LCD_Measure("aaaa aaaa aaaa aaaa aaaa aaaa aaaa aaaa aaaa",
+                            &Font8, 20);
+  TEST_CHECK(Layout->Lines == LCD_LAYOUT_LINES);
+  TEST_CHECK(Test_Line(Layout, LCD_LAYOUT_LINES - 1, 35, 4, 0, 20));
+}
+
+static void Test_Proportional(void) {
+  LCD_Text_Layout Text;
+  const LCD_LAYOUT *Layout;
+  const sPFONT *Font = &Font8_Proportional;
+  TEST_CHECK(Font->Advances != nullptr);
+  LCD_LENGTH Word = Test_Width(Font, "il");
+  LCD_LENGTH Space = Test_Width(Font, " ");
+  LCD_LENGTH Two = Test_Width(Font, "il il");
+  TEST_CHECK(Word < Test_Width(Font, "mw") && Two == 2 * Word + Space);
+
+  Layout = Text.LCD_Measure("il il il", Font);
+  TEST_CHECK(Layout->Lines == 1 && Layout->Line_Height == Font->Height);
+  TEST_CHECK(Test_Line(Layout, 0, 0, 8, 0, Test_Width(Font, "il il il")));
+
+  Layout = Text.LCD_Measure("il il il", Font, Two);
+  TEST_CHECK(Layout->Lines == 2);
+  TEST_CHECK(Test_Line(Layout, 0, 0, 5, 0, Two));
+  TEST_CHECK(Test_Line(Layout, 1, 6, 2, 0, Word));
+
+  Layout = Text.LCD_Measure("il il il", Font, Two - 1);
+  TEST_CHECK(Layout->Lines == 3);
+  TEST_CHECK(Test_Line(Layout, 2, 6, 2, 0, Word));
+
+  // Wide and narrow characters broken inside a word
+  LCD_LENGTH Wide = Test_Width(Font, "mw");
+  Layout = Text.LCD_Measure("mwmwmw", Font, Wide, LCD_ALIGN_RIGHT);
+  TEST_CHECK(Layout->Lines == 3);
+  for (uint8_t n = 0; n < 3; n++) {
+    TEST_CHECK(Test_Line(Layout, n, 2 * n, 2, 0, Wide));
+  }
+  Layout = Text.LCD_Measure("ilmw", Font, Word, LCD_ALIGN_RIGHT);
+  TEST_CHECK(Test_Line(Layout, 0, 0, 2, 0, Word));
+  LCD_LENGTH M = Test_Width(Font, "m");
+  if (M + Test_Width(Font, "w") > Word) {
+    TEST_CHECK(Test_Line(Layout, 1, 2, 1, M < Word ? Word - M : 0, M));
+  }
+}
+
+static void Test_Align(void) {
+  LCD_Text_Layout Text;
+  const LCD_LAYOUT *Layout;
+
+  // Aligned in the width given
+  Layout = Text.LCD_Measure("ab", &Font8, 21, LCD_ALIGN_RIGHT);
+  TEST_CHECK(Test_Line(Layout, 0, 0, 2, 11, 10));
+  Layout = Text.LCD_Measure("ab", &Font8, 21, LCD_ALIGN_CENTER);
+  TEST_CHECK(Test_Line(Layout, 0, 0, 2, 5, 10));
+  Layout = Text.LCD_Measure("ab", &Font8, 21, LCD_ALIGN_LEFT);
+  TEST_CHECK(Test_Line(Layout, 0, 0, 2, 0, 10));
+
+  // Or in the widest line
+  Layout = Text.LCD_Measure("a\nabcd\nab", &Font8, 0, LCD_ALIGN_RIGHT);
+  TEST_CHECK(Layout->Box_Width == 20);
+  TEST_CHECK(Test_Line(Layout, 0, 0, 1, 15, 5));
+  TEST_CHECK(Test_Line(Layout, 1, 2, 4, 0, 20));
+  TEST_CHECK(Test_Line(Layout, 2, 7, 2, 10, 10));
+  Layout = Text.LCD_Measure("a\nabcd\nab", &Font8, 0, LCD_ALIGN_CENTER);
+  TEST_CHECK(Test_Line(Layout, 0, 0, 1, 7, 5));
+  TEST_CHECK(Test_Line(Layout, 2, 7, 2, 5, 10));
+
+  // Wrapped lines without their spaces
+  Layout = Text.LCD_Measure("ab cd e", &Font8, 30, LCD_ALIGN_RIGHT);
+  TEST_CHECK(Test_Line(Layout, 0, 0, 5, 5, 25));
+  TEST_CHECK(Test_Line(Layout, 1, 6, 1, 25, 5));
+}
+
+static void Test_Cache(void) {
+  LCD_Text_Layout Text;
+  char Copy[16];
+
+  // The same string, font, width and alignment, from any buffer
+  const LCD_LAYOUT *First = Text.LCD_Measure("ab cd", &Font8, 40);
+  strcpy(Copy, "ab cd");
+  TEST_CHECK(Text.LCD_Measure(Copy, &Font8, 40) == First);
+
+  // Any of them changed is another layout
+  const LCD_LAYOUT *Other = Text.LCD_Measure("ab cd", &Font12, 40);
+  TEST_CHECK(Other != First && Other->Line[0].Width == 35);
+  Other = Text.LCD_Measure("ab cd", &Font8, 20);
+  TEST_CHECK(Other->Lines == 2);
+  Other = Text.LCD_Measure("ab cd", &Font8, 40, LCD_ALIGN_RIGHT);
+  TEST_CHECK(Other->Line[0].X == 15);
+  TEST_CHECK(Text.LCD_Measure("ab cd", &Font8, 40) == First);
+  TEST_CHECK(First->Line[0].X == 0 && First->Lines == 1);
+
+  // A string changed in place is measured again
+  strcpy(Copy, "abc d");
+  const LCD_LAYOUT *Changed = Text.LCD_Measure(Copy, &Font8, 20);
+  TEST_CHECK(Test_Line(Changed, 0, 0, 3, 0, 15));
+  TEST_CHECK(Test_Line(Changed, 1, 4, 1, 0, 5));
+
+  // The least recently used layout is dropped and measured again
+  for (int i = 0; i < LCD_LAYOUT_CACHE; i++) {
+    char Name[4] = {'x', (char)('0' + i), '\0'};
+    Text.LCD_Measure(Name, &Font8);
+  }
+  const LCD_LAYOUT *Again = Text.LCD_Measure("ab cd", &Font8, 40);
+  TEST_CHECK(Test_Line(Again, 0, 0, 5, 0, 25) && Again->Lines == 1);
+
+  // Strings too long to keep are measured every time
+  char Long[LCD_LAYOUT_TEXT + 8];
+  memset(Long, 'a', sizeof(Long) - 1);
+  Long[sizeof(Long) - 1] = '\0';
+  const LCD_LAYOUT *Layout = Text.LCD_Measure(Long, &Font8);
+  TEST_CHECK(Test_Line(Layout, 0, 0, sizeof(Long) - 1, 0,
+                       5 * (sizeof(Long) - 1)));
+  Long[1] = '\n';
+  Layout = Text.LCD_Measure(Long, &Font8);
+  TEST_CHECK(Layout->Lines == 2 && Test_Line(Layout, 0, 0, 1, 0, 5));
+}
+
+/********************************************************************************
+  function:
+                        A laid out string drawn one pixel at a time
+********************************************************************************/
+static void Ref_PackedChar(LCD_ST7735S *Lcd, LCD_POINT Xpoint,
+                           LCD_POINT Ypoint, char Char, const sPFONT *Font,
+                           LCD_COLOR Color_Background,
+                           LCD_COLOR Color_Foreground) {
+  const sGLYPH *Glyph = Font_FindGlyph(Font, Char);
+  LCD_LENGTH Advance = Font_Advance(Font, Glyph);
+  if (Advance == 0) {
+    return;
+  }
+  sGLYPH_DECODER Decoder;
+  Font_DecodePacked(&Decoder, Font, Glyph);
+  for (LCD_POINT Page = 0; Page < Font->Height; Page++) {
+    uint8_t Row[8];
+    Font_DecodeRow(&Decoder, Row, Advance);
+    for (LCD_POINT Column = 0; Column < Advance; Column++) {
+      if (Row[Column / 8] & (0x80 >> (Column % 8))) {
+        Lcd->LCD_SetPointlColor(Xpoint + Column, Ypoint + Page,
+                                Color_Foreground);
+      } else if (FONT_BACKGROUND != Color_Background) {
+        Lcd->LCD_SetPointlColor(Xpoint + Column, Ypoint + Page,
+                                Color_Background);
+      }
+    }
+  }
+}
+
+static void Ref_DisplayText(LCD_ST7735S *Lcd, LCD_POINT Xstart,
+                            LCD_POINT Ystart, const char *pString,
+                            const LCD_LAYOUT *Layout, sFONT *Table,
+                            const sPFONT *Packed, LCD_COLOR Color_Background,
+                            LCD_COLOR Color_Foreground) {
+  for (uint8_t n = 0; n < Layout->Lines; n++) {
+    const LCD_LAYOUT_LINE *Line = &Layout->Line[n];
+    LCD_POINT Ypoint = Ystart + n * Layout->Line_Height;
+    LCD_POINT Xpoint = Xstart + Line->X;
+    // The box around the line
+    bool Opaque = Color_Background != FONT_BACKGROUND;
+    for (LCD_POINT Y = Ypoint; Opaque && Y < Ypoint + Layout->Line_Height;
+         Y++) {
+      for (LCD_POINT X = Xstart; X < Xstart + Layout->Box_Width; X++) {
+        if (X < Xpoint || X >= Xpoint + Line->Width) {
+          Lcd->LCD_SetPointlColor(X, Y, Color_Background);
+        }
+      }
+    }
+    for (uint16_t i = 0; i < Line->Length; i++) {
+      char Char = pString[Line->Start + i];
+      if (Table) {
+        Ref_DisplayChar(Lcd, Xpoint, Ypoint, Char, Table, Color_Background,
+                        Color_Foreground);
+        Xpoint += Table->Width;
+      } else {
+        Ref_PackedChar(Lcd, Xpoint, Ypoint, Char, Packed, Color_Background,
+                       Color_Foreground);
+        Xpoint += Font_Advance(Packed, Font_FindGlyph(Packed, Char));
+      }
+    }
+  }
+}
+
+// LCD_DisplayText on the emulator, against the reference
+static void Test_Display(bool Framebuffer, LCD_POINT Xstart, LCD_POINT Ystart,
+                         const char *pString, sFONT *Table,
+                         const sPFONT *Packed, LCD_LENGTH Max_Width,
+                         LCD_ALIGN Align, LCD_COLOR Color_Background) {
+  static LCD_ST7735S_Emulator Panel, Ref_Panel;
+  LCD_Host_Transport Bus, Ref_Bus;
+  Bus.LCD_SetListener(&Panel);
+  Ref_Bus.LCD_SetListener(&Ref_Panel);
+  LCD_ST7735S Lcd(&Bus), Ref_Lcd(&Ref_Bus);
+  Lcd.LCD_Init(L2R_U2D);
+  Ref_Lcd.LCD_Init(L2R_U2D);
+  if (Framebuffer) {
+    Lcd.LCD_SetFramebuffer(test_frame);
+  }
+  Lcd.LCD_Clear(GRAY);
+  Ref_Lcd.LCD_Clear(GRAY);
+
+  LCD_Text_Layout Text;
+  const LCD_LAYOUT *Layout =
+      Table ? Text.LCD_Measure(pString, Table, Max_Width, Align)
+            : Text.LCD_Measure(pString, Packed, Max_Width, Align);
+  if (Table) {
+    Lcd.LCD_DisplayText(Xstart, Ystart, pString, Layout, Table,
+                        Color_Background, BLUE);
+  } else {
+    Lcd.LCD_DisplayText(Xstart, Ystart, pString, Layout, Packed,
+                        Color_Background, BLUE);
+  }
+  Lcd.LCD_Flush();
+  Ref_DisplayText(&Ref_Lcd, Xstart, Ystart, pString, Layout, Table, Packed,
+                  Color_Background, BLUE);
+
+  uint32_t Different = 0;
+  for (LCD_POINT Y = 0; Y < sLCD_DIS.LCD_Dis_Page; Y++) {
+    for (LCD_POINT X = 0; X < sLCD_DIS.LCD_Dis_Column; X++) {
+      Different += Panel.LCD_GetPixel(X, Y) != Ref_Panel.LCD_GetPixel(X, Y);
+    }
+  }
+  if (Different) {
+    fprintf(stderr, "\"%s\"%s: %u pixels differ\n", pString,
+            Framebuffer ? " (framebuffer)" : "", Different);
+  }
+  TEST_CHECK(Different == 0);
+}
+
+static void Test_Displays(bool Framebuffer) {
+  static const char *Strings[] = {
+      "Hello world, a longer line of text",
+      "ab   cd\n\nefghijklmnopqrstuvwxyz",
+      "right\naligned text",
+      "",
+  };
+  static const LCD_ALIGN Aligns[] = {LCD_ALIGN_LEFT, LCD_ALIGN_CENTER,
+                                     LCD_ALIGN_RIGHT};
+  static const LCD_LENGTH Widths[] = {0, 3, 47, 100};
+  for (const char *pString : Strings) {
+    for (LCD_ALIGN Align : Aligns) {
+      for (LCD_LENGTH Max_Width : Widths) {
+        for (LCD_COLOR Background : {(LCD_COLOR)WHITE, (LCD_COLOR)BLACK}) {
+          Test_Display(Framebuffer, 7, 5, pString, &Font8, nullptr, Max_Width,
+                       Align, Background);
+          Test_Display(Framebuffer, 3, 20, pString, &Font12, nullptr,
+                       Max_Width, Align, Background);
+          Test_Display(Framebuffer, 9, 30, pString, nullptr,
+                       &Font8_Proportional, Max_Width, Align, Background);
+          Test_Display(Framebuffer, 0, 40, pString, nullptr, &Font16_Packed,
+                       Max_Width, Align, Background);
+        }
+      }
+    }
+  }
+  // Lines running off the right and the bottom of the display
+  Test_Display(Framebuffer, 100, 150, "clipped\nlines", &Font8, nullptr, 0,
+               LCD_ALIGN_LEFT, BLACK);
+  Test_Display(Framebuffer, 100, 150, "clipped\nlines", nullptr,
+               &Font8_Proportional, 0, LCD_ALIGN_LEFT, BLACK);
+}
+
+int main(void) {
+  Test_Breaks();
+  Test_Proportional();
+  Test_Align();
+  Test_Cache();
+  Test_Displays(false);
+  Test_Displays(true);
+  return TEST_RESULT();
+}
@@ -0,0 +1,265 @@
+/***********************************************************************************************************************
+  | file      	:	test_server.cpp
+  | function	:	Commands recorded by LCD_Command_Writer, and the display
+  |                 server's ring drained on the producer, against drawing
+  |                 on the driver directly
+***********************************************************************************************************************/
+
+#include "LCD_Emulator.h"
+#include "LCD_Server.h"
+#include "LCD_Test.h"
+
+#include <string.h>
+#include <string>
+#include <type_traits>
+
+/********************************************************************************
+  function:
+                        Writer keeping the commands, with or without room for
+                        long strings
+********************************************************************************/
+class Test_Recorder : public LCD_Command_Writer {
+  LCD_COMMAND slot;
+  bool long_text;
+
+  LCD_COMMAND *LCD_Reserve(void) override {
+    memset(&slot, 0xa5, sizeof(slot));
+    return &slot;
+  }
+  void LCD_Commit(void) override { Commands.push_back(slot); }
+  char *LCD_ReserveText(uint32_t *Size, uint32_t *End) override {
+    if (!long_text) {
+      return nullptr;
+    }
+    Text.push_back(std::string(*Size, '\0'));
+    *End = Text.size();
+    return &Text.back()[0];
+  }
+
+public:
+  std::vector<LCD_COMMAND> Commands;
+  std::vector<std::string> Text;
+
+  Test_Recorder(bool Long_Text) { long_text = Long_Text; }
+};
+
+static void Test_Call(LCD_ST7735S *Lcd, void *User_Data) {
+  (void)Lcd;
+  (*(int *)User_Data)++;
+}
+
+static void Test_Encoding(void) {
+  static const LCD_COLOR Bitmap[4] = {RED, GREEN, BLUE, WHITE};
+  const char *Line = "0123456789012345678901234567890123456789";
+  int Calls = 0;
+  Test_Recorder Writer(true);
+  Writer.LCD_Init(U2D_R2L);
+  Writer.LCD_Clear(GRAY);
+  Writer.LCD_SetArealColor(1, 2, 30, 40, RED);
+  Writer.LCD_DrawBitmap(5, 6, 2, 2, Bitmap);
+  Writer.LCD_DrawPoint(7, 8, BLUE, DOT_PIXEL_3X3, DOT_FILL_RIGHTUP);
+  Writer.LCD_DrawLine(1, 2, 3, 4, GREEN, LINE_DOTTED, DOT_PIXEL_2X2);
+  Writer.LCD_DrawRectangle(9, 10, 11, 12, CYAN, DRAW_FULL, DOT_PIXEL_1X1);
+  Writer.LCD_DrawCircle(50, 60, 7, MAGENTA, DRAW_EMPTY, DOT_PIXEL_4X4);
+  Writer.LCD_DisplayString(3, 4, "short", &Font12, BLACK, YELLOW);
+  Writer.LCD_DisplayString(5, 6, Line, &Font8_Packed, WHITE, BROWN);
+  Writer.LCD_Flush();
+  Writer.LCD_Call(Test_Call, &Calls);
+
+  const std::vector<LCD_COMMAND> &C = Writer.Commands;
+  TEST_CHECK(C.size() == 12);
+  TEST_CHECK(C[0].Op == LCD_OP_INIT && C[0].Style == U2D_R2L);
+  TEST_CHECK(C[1].Op == LCD_OP_CLEAR && C[1].Color == GRAY);
+  TEST_CHECK(C[2].Op == LCD_OP_FILL && C[2].X0 == 1 && C[2].Y0 == 2 &&
+             C[2].X1 == 30 && C[2].Y1 == 40 && C[2].Color == RED);
+  TEST_CHECK(C[3].Op == LCD_OP_BITMAP && C[3].X0 == 5 && C[3].Y0 == 6 &&
+             C[3].X1 == 2 && C[3].Y1 == 2 && C[3].Bitmap == Bitmap);
+  TEST_CHECK(C[4].Op == LCD_OP_POINT && C[4].X0 == 7 && C[4].Y0 == 8 &&
+             C[4].Color == BLUE && C[4].Dot_Pixel == DOT_PIXEL_3X3 &&
+             C[4].Style == DOT_FILL_RIGHTUP);
+  TEST_CHECK(C[5].Op == LCD_OP_LINE && C[5].X1 == 3 && C[5].Y1 == 4 &&
+             C[5].Style == LINE_DOTTED && C[5].Dot_Pixel == DOT_PIXEL_2X2);
+  TEST_CHECK(C[6].Op == LCD_OP_RECTANGLE && C[6].X0 == 9 && C[6].Y1 == 12 &&
+             C[6].Color == CYAN && C[6].Style == DRAW_FULL);
+  TEST_CHECK(C[7].Op == LCD_OP_CIRCLE && C[7].X0 == 50 && C[7].Y0 == 60 &&
+             C[7].X1 == 7 && C[7].Style == DRAW_EMPTY &&
+             C[7].Dot_Pixel == DOT_PIXEL_4X4);
+  TEST_CHECK(C[8].Op == LCD_OP_STRING && C[8].Font == &Font12 &&
+             C[8].Color == BLACK && C[8].Color2 == YELLOW);
+  TEST_CHECK(!C[8].Long_Text && C[8].Text_End == 0);
+  TEST_CHECK(strcmp(LCD_CommandText(&C[8]), "short") == 0);
+  TEST_CHECK(C[9].Op == LCD_OP_PACKED_STRING && C[9].Packed == &Font8_Packed);
+  TEST_CHECK(C[9].Long_Text == Writer.Text[0].c_str() && C[9].Text_End == 1);
+  TEST_CHECK(strcmp(LCD_CommandText(&C[9]), Line) == 0);
+  TEST_CHECK(C[10].Op == LCD_OP_FLUSH);
+  TEST_CHECK(C[11].Op == LCD_OP_CALL && C[11].User_Data == &Calls);
+  C[11].Call(nullptr, C[11].User_Data);
+  TEST_CHECK(Calls == 1);
+
+  // A string of LCD_COMMAND_TEXT - 1 characters still fits the command
+  std::string Fits(LCD_COMMAND_TEXT - 1, 'x');
+  Writer.LCD_DisplayString(0, 0, Fits.c_str(), &Font8, BLACK, WHITE);
+  TEST_CHECK(!Writer.Commands.back().Long_Text);
+  TEST_CHECK(Fits == LCD_CommandText(&Writer.Commands.back()));
+
+  // Without LCD_ReserveText long strings are cut
+  Test_Recorder Cut(false);
+  Cut.LCD_DisplayString(0, 0, Line, &Font8, BLACK, WHITE);
+  TEST_CHECK(!Cut.Commands[0].Long_Text && Cut.Commands[0].Text_End == 0);
+  TEST_CHECK(strlen(Cut.Commands[0].Text) == LCD_COMMAND_TEXT - 1);
+  TEST_CHECK(strncmp(Cut.Commands[0].Text, Line, LCD_COMMAND_TEXT - 1) == 0);
+}
+
+/********************************************************************************
+  function:
+                        Queue the drawing on a server that has no consumer,
+                        draw it straight on a driver too, and count the
+                        pixels that differ once the server has synced
+********************************************************************************/
+template <typename DRAW, typename CHECK>
+static uint32_t Test_Serve(const DRAW &Draw, const CHECK &Check) {
+  static LCD_ST7735S_Emulator Panel, Ref_Panel;
+  LCD_Host_Transport Bus, Ref_Bus;
+  Bus.LCD_SetListener(&Panel);
+  Ref_Bus.LCD_SetListener(&Ref_Panel);
+  LCD_ST7735S Lcd(&Bus), Ref_Lcd(&Ref_Bus);
+  Ref_Lcd.LCD_Init(L2R_U2D);
+  Draw(&Ref_Lcd);
+
+  LCD_Display_Server Server(&Lcd);
+  Server.LCD_Init(L2R_U2D);
+  Draw(&Server);
+  Check(&Server);
+  Server.LCD_Sync();
+
+  LCD_SERVER_STATS Stats;
+  Server.LCD_GetStats(&Stats);
+  TEST_CHECK(Stats.Depth == 0);
+
+  uint32_t Different = 0;
+  for (LCD_POINT Y = 0; Y < sLCD_DIS.LCD_Dis_Page; Y++) {
+    for (LCD_POINT X = 0; X < sLCD_DIS.LCD_Dis_Column; X++) {
+      Different += Panel.LCD_GetPixel(X, Y) != Ref_Panel.LCD_GetPixel(X, Y);
+    }
+  }
+  return Different;
+}
+
+static void Test_Overflow(void) {
+  LCD_SERVER_STATS Stats;
+  TEST_CHECK(Test_Serve(
+                 [](auto *Lcd) {
+                   for (uint32_t i = 0; i < 100; i++) {
+                     LCD_POINT X = i % 10 * 12, Y = i / 10 * 15;
+                     Lcd->LCD_SetArealColor(X, Y, X + 11 + i % 3, Y + 14,
+                                            0x1234 + i * 0x29);
+                   }
+                 },
+                 [&](LCD_Display_Server *Server) {
+                   // Full at the 33rd, 65th and 97th post, LCD_Init first
+                   Server->LCD_GetStats(&Stats);
+                   TEST_CHECK(Stats.Capacity == LCD_SERVER_RING);
+                   TEST_CHECK(Stats.Stalls == 3);
+                   TEST_CHECK(Stats.High_Water == LCD_SERVER_RING);
+                   TEST_CHECK(Stats.Commands == 3 * LCD_SERVER_RING);
+                   TEST_CHECK(Stats.Depth == 101 - 3 * LCD_SERVER_RING);
+                 }) == 0);
+
+  // The ring wraps many times over without a stall when synced in time
+  TEST_CHECK(Test_Serve(
+                 [](auto *Lcd) {
+                   for (uint32_t i = 0; i < 4 * LCD_SERVER_RING; i++) {
+                     Lcd->LCD_DrawPoint(i % 128, i, RED, DOT_PIXEL_1X1,
+                                        DOT_FILL_AROUND);
+                     if constexpr (std::is_same_v<decltype(Lcd),
+                                                  LCD_Display_Server *>) {
+                       if (i % 20 == 19) {
+                         Lcd->LCD_Sync();
+                       }
+                     }
+                   }
+                 },
+                 [&](LCD_Display_Server *Server) {
+                   Server->LCD_GetStats(&Stats);
+                   TEST_CHECK(Stats.Stalls == 0);
+                   TEST_CHECK(Stats.High_Water == 21);
+                   TEST_CHECK(Stats.Commands == 1 + 120 && Stats.Depth == 8);
+                   Server->LCD_ResetStats();
+                   Server->LCD_GetStats(&Stats);
+                   TEST_CHECK(Stats.Stalls == 0);
+                   TEST_CHECK(Stats.High_Water == 0);
+                 }) == 0);
+
+  // LCD_TryPost does not wait
+  LCD_Host_Transport Bus;
+  LCD_ST7735S Lcd(&Bus);
+  LCD_Display_Server Server(&Lcd);
+  LCD_COMMAND Command = {};
+  Command.Op = LCD_OP_INIT;
+  Command.Style = L2R_U2D;
+  uint32_t Posted = 0;
+  while (Server.LCD_TryPost(&Command)) {
+    Command.Op = LCD_OP_CLEAR;
+    Command.Color = Posted++;
+  }
+  Server.LCD_GetStats(&Stats);
+  TEST_CHECK(Posted == LCD_SERVER_RING && Stats.Stalls == 0);
+  TEST_CHECK(Stats.Depth == LCD_SERVER_RING && Stats.Commands == 0);
+  TEST_CHECK(Server.LCD_Poll() == LCD_SERVER_RING);
+  TEST_CHECK(Server.LCD_TryPost(&Command));
+  Server.LCD_Sync();
+  Server.LCD_GetStats(&Stats);
+  TEST_CHECK(Stats.Depth == 0 && Stats.Commands == LCD_SERVER_RING + 1);
+}
+
+static void Test_LongText(void) {
+  LCD_SERVER_STATS Stats;
+  // A whole Font8 line, and strings that fill the text ring many times
+  std::string Line(32, ' '), Long(100, ' ');
+  for (uint32_t i = 0; i < Line.size(); i++) {
+    Line[i] = 'A' + i % 26;
+  }
+  for (uint32_t i = 0; i < Long.size(); i++) {
+    Long[i] = '!' + i % 90;
+  }
+  TEST_CHECK(Test_Serve(
+                 [&](auto *Lcd) {
+                   Lcd->LCD_Clear(BLACK);
+                   Lcd->LCD_DisplayString(0, 0, Line.c_str(), &Font8, BLACK,
+                                          GREEN);
+                   for (uint32_t i = 0; i < 12; i++) {
+                     Lcd->LCD_DisplayString(0, 10 + i * 10, Long.c_str(),
+                                            &Font8_Packed, BLACK,
+                                            0x0841 * i);
+                   }
+                 },
+                 [&](LCD_Display_Server *Server) {
+                   // Two strings of 101 bytes fit, the third waits
+                   Server->LCD_GetStats(&Stats);
+                   TEST_CHECK(Stats.Stalls > 0);
+                   TEST_CHECK(Stats.Commands > 0);
+                 }) == 0);
+
+  // Longer than the text ring, cut to it
+  std::string Longest(LCD_SERVER_TEXT + 40, 'y');
+  std::string Cut = Longest.substr(0, LCD_SERVER_TEXT - 1);
+  TEST_CHECK(Test_Serve(
+                 [&](auto *Lcd) {
+                   if constexpr (std::is_same_v<decltype(Lcd),
+                                                LCD_Display_Server *>) {
+                     Lcd->LCD_DisplayString(0, 0, Longest.c_str(), &Font8,
+                                            BLACK, WHITE);
+                   } else {
+                     Lcd->LCD_DisplayString(0, 0, Cut.c_str(), &Font8,
+                                            BLACK, WHITE);
+                   }
+                 },
+                 [](LCD_Display_Server *) {}) == 0);
+}
+
+int main(void) {
+  Test_Encoding();
+  Test_Overflow();
+  Test_LongText();
+  return TEST_RESULT();
+}
@@ -0,0 +1,378 @@
+/***********************************************************************************************************************
+  | file      	:	test_shapes.cpp
+  | function	:	Span rasterized circles, ellipses and rectangles against
+  |                 per-pixel references, and the windows they take
+***********************************************************************************************************************/
+
+#include "LCD_Emulator.h"
+#include "LCD_Reference.h"
+#include "LCD_Test.h"
+
+#include <functional>
+
+static LCD_COLOR test_frame[LCD_FRAMEBUFFER_SIZE];
+
+/********************************************************************************
+  function:
+                        References of the shapes the original driver did not
+                        have, from the same point walks, one pixel or one
+                        LCD_DrawPoint square at a time
+********************************************************************************/
+// Points of one octant of LCD_DrawCircle, and their mirror on the diagonal
+static void Ref_CircleQuadrant(LCD_LENGTH Radius,
+                               const std::function<void(int, int)> &Point) {
+  int16_t XCurrent = 0, YCurrent = Radius;
+  int16_t Esp = 3 - (Radius << 1);
+  while (XCurrent <= YCurrent) {
+    Point(XCurrent, YCurrent);
+    Point(YCurrent, XCurrent);
+    if (Esp < 0)
+      Esp += 4 * XCurrent + 6;
+    else {
+      Esp += 10 + 4 * (XCurrent - YCurrent);
+      YCurrent--;
+    }
+    XCurrent++;
+  }
+}
+
+// Points of one quadrant of LCD_DrawEllipse
+static void Ref_EllipseQuadrant(LCD_LENGTH X_Radius, LCD_LENGTH Y_Radius,
+                                const std::function<void(int, int)> &Point) {
+  int64_t Rx2 = (int64_t)X_Radius * X_Radius;
+  int64_t Ry2 = (int64_t)Y_Radius * Y_Radius;
+  int32_t X = 0, Y = Y_Radius;
+  int64_t Px = 0, Py = 2 * Rx2 * Y;
+  int64_t P = 4 * Ry2 - 4 * Rx2 * Y_Radius + Rx2;
+  while (Px < Py) {
+    Point(X, Y);
+    X++;
+    Px += 2 * Ry2;
+    if (P < 0) {
+      P += 4 * (Ry2 + Px);
+    } else {
+      Y--;
+      Py -= 2 * Rx2;
+      P += 4 * (Ry2 + Px - Py);
+    }
+  }
+  P = Ry2 * (4 * (int64_t)X * X + 4 * X + 1) +
+      4 * Rx2 * ((int64_t)(Y - 1) * (Y - 1)) - 4 * Rx2 * Ry2;
+  while (Y >= 0) {
+    Point(X, Y);
+    Y--;
+    Py -= 2 * Rx2;
+    if (P > 0) {
+      P += 4 * (Rx2 - Py);
+    } else {
+      X++;
+      Px += 2 * Ry2;
+      P += 4 * (Rx2 - Py + Px);
+    }
+  }
+  Point(X_Radius, 0);
+  // A flat ellipse is the segment through its center
+  for (int32_t X = 0; Y_Radius == 0 && X < X_Radius; X++) {
+    Point(X, 0);
+  }
+}
+
+// Pixels [Xstart, Xend] of a row
+static void Ref_Row(LCD_ST7735S *Lcd, int Xstart, int Xend, int Y,
+                    LCD_COLOR Color) {
+  for (int X = Xstart; X <= Xend; X++) {
+    Lcd->LCD_SetPointlColor(X, Y, Color);
+  }
+}
+
+// A LCD_DrawPoint square, clipped to the display pixel by pixel. The
+// original driver dropped the squares centered off the display
+static void Ref_Square(LCD_ST7735S *Lcd, int Xpoint, int Ypoint,
+                       LCD_COLOR Color, DOT_PIXEL Dot_Pixel) {
+  for (int Y = Ypoint - Dot_Pixel; Y <= Ypoint + Dot_Pixel - 2; Y++) {
+    for (int X = Xpoint - Dot_Pixel; X <= Xpoint + Dot_Pixel - 2; X++) {
+      if (X >= 0 && X < sLCD_DIS.LCD_Dis_Column && Y >= 0 &&
+          Y < sLCD_DIS.LCD_Dis_Page) {
+        Lcd->LCD_SetPointlColor(X, Y, Color);
+      }
+    }
+  }
+}
+
+// A quadrant pulled apart to four centers, see LCD_CurveDraw
+static void Ref_Curve(LCD_ST7735S *Lcd, int X_Left, int Y_Top, int X_Right,
+                      int Y_Bottom, LCD_COLOR Color, DRAW_FILL Draw_Fill,
+                      DOT_PIXEL Dot_Pixel,
+                      const std::function<void(
+                          const std::function<void(int, int)> &)> &Walk) {
+  Walk([&](int X, int Y) {
+    if (Draw_Fill) {
+      Ref_Row(Lcd, X_Left - X, X_Right + X, Y_Top - Y, Color);
+      Ref_Row(Lcd, X_Left - X, X_Right + X, Y_Bottom + Y, Color);
+    } else {
+      Ref_Square(Lcd, X_Left - X, Y_Top - Y, Color, Dot_Pixel);
+      Ref_Square(Lcd, X_Right + X, Y_Top - Y, Color, Dot_Pixel);
+      Ref_Square(Lcd, X_Left - X, Y_Bottom + Y, Color, Dot_Pixel);
+      Ref_Square(Lcd, X_Right + X, Y_Bottom + Y, Color, Dot_Pixel);
+    }
+  });
+}
+
+static void Ref_DrawEllipse(LCD_ST7735S *Lcd, int X_Center, int Y_Center,
+                            LCD_LENGTH X_Radius, LCD_LENGTH Y_Radius,
+                            LCD_COLOR Color, DRAW_FILL Draw_Fill,
+                            DOT_PIXEL Dot_Pixel) {
+  Ref_Curve(Lcd, X_Center, Y_Center, X_Center, Y_Center, Color, Draw_Fill,
+            Dot_Pixel, [&](const std::function<void(int, int)> &Point) {
+              Ref_EllipseQuadrant(X_Radius, Y_Radius, Point);
+            });
+}
+
+static void Ref_DrawRoundRectangle(LCD_ST7735S *Lcd, int X0, int Y0, int X1,
+                                   int Y1, int Radius, LCD_COLOR Color,
+                                   DRAW_FILL Filled, DOT_PIXEL Dot_Pixel) {
+  if (Filled) {
+    X1--;
+    Y1--;
+  }
+  int Max_Radius = (X1 - X0 < Y1 - Y0 ? X1 - X0 : Y1 - Y0) / 2;
+  Radius = Radius > Max_Radius ? Max_Radius : Radius;
+  int X_Left = X0 + Radius, X_Right = X1 - Radius;
+  int Y_Top = Y0 + Radius, Y_Bottom = Y1 - Radius;
+
+  auto Walk = [&](const std::function<void(int, int)> &Point) {
+    Ref_CircleQuadrant(Radius, Point);
+  };
+  Ref_Curve(Lcd, X_Left, Y_Top, X_Right, Y_Bottom, Color, Filled, Dot_Pixel,
+            Walk);
+  // The straight parts between the corners
+  if (Filled) {
+    for (int Y = Y_Top; Y <= Y_Bottom; Y++) {
+      Ref_Row(Lcd, X0, X1, Y, Color);
+    }
+  } else {
+    for (int X = X_Left; X <= X_Right; X++) {
+      Ref_Square(Lcd, X, Y0, Color, Dot_Pixel);
+      Ref_Square(Lcd, X, Y1, Color, Dot_Pixel);
+    }
+    for (int Y = Y_Top; Y <= Y_Bottom; Y++) {
+      Ref_Square(Lcd, X0, Y, Color, Dot_Pixel);
+      Ref_Square(Lcd, X1, Y, Color, Dot_Pixel);
+    }
+  }
+}
+
+static void Ref_DrawBorderedRectangle(LCD_ST7735S *Lcd, int Xstart, int Ystart,
+                                      int Xend, int Yend, LCD_COLOR Color,
+                                      LCD_COLOR Border_Color,
+                                      DOT_PIXEL Dot_Pixel) {
+  for (int Y = Ystart; Y < Yend; Y++) {
+    for (int X = Xstart; X < Xend; X++) {
+      bool Border = X < Xstart + Dot_Pixel || X >= Xend - Dot_Pixel ||
+                    Y < Ystart + Dot_Pixel || Y >= Yend - Dot_Pixel;
+      Lcd->LCD_SetPointlColor(X, Y, Border ? Border_Color : Color);
+    }
+  }
+}
+
+/*******************************************************************************
+function:
+                One shape on a cleared panel through the driver, and through
+                its reference on another; returns the windows the driver
+                took, or UINT32_MAX when a pixel differs
+*******************************************************************************/
+static uint32_t Test_Shape(const char *Name, bool Framebuffer,
+                           const std::function<void(LCD_ST7735S *)> &Draw,
+                           const std::function<void(LCD_ST7735S *)> &Ref) {
+  static LCD_ST7735S_Emulator Panel, Ref_Panel;
+  LCD_Host_Transport Bus, Ref_Bus;
+  Bus.LCD_SetListener(&Panel);
+  Ref_Bus.LCD_SetListener(&Ref_Panel);
+  LCD_ST7735S Lcd(&Bus), Ref_Lcd(&Ref_Bus);
+  Lcd.LCD_Init(L2R_U2D);
+  Ref_Lcd.LCD_Init(L2R_U2D);
+  Lcd.LCD_Clear(WHITE);
+  Ref_Lcd.LCD_Clear(WHITE);
+  if (Framebuffer) {
+    Lcd.LCD_SetFramebuffer(test_frame);
+    Lcd.LCD_Clear(WHITE);
+    Lcd.LCD_Flush();
+  }
+
+  Panel.LCD_ResetStats();
+  Draw(&Lcd);
+  Lcd.LCD_Flush();
+  Ref(&Ref_Lcd);
+
+  uint32_t Different = 0;
+  for (LCD_POINT Y = 0; Y < sLCD_DIS.LCD_Dis_Page; Y++) {
+    for (LCD_POINT X = 0; X < sLCD_DIS.LCD_Dis_Column; X++) {
+      Different += Panel.LCD_GetPixel(X, Y) != Ref_Panel.LCD_GetPixel(X, Y);
+    }
+  }
+  if (Different) {
+    fprintf(stderr, "%s%s: %u pixels differ\n", Name,
+            Framebuffer ? " (framebuffer)" : "", Different);
+  }
+  TEST_CHECK(Different == 0);
+  return Different ? UINT32_MAX : Panel.LCD_GetStats()->Windows;
+}
+
+static void Test_Circles(bool Framebuffer) {
+  static const LCD_LENGTH Radii[] = {0, 1, 4, 10, 23};
+  static const LCD_POINT Centers[][2] = {{64, 80}, {3, 150}, {125, 2}};
+  for (LCD_LENGTH Radius : Radii) {
+    for (const LCD_POINT *Center : Centers) {
+      LCD_POINT X = Center[0], Y = Center[1];
+      for (int Dot = 1; Dot <= 4; Dot++) {
+        DOT_PIXEL Dot_Pixel = (DOT_PIXEL)Dot;
+        // Squares centered off the display are clipped, not dropped
+        bool Inside = X >= Radius && X + Radius <= sLCD_DIS.LCD_Dis_Column &&
+                      Y >= Radius && Y + Radius <= sLCD_DIS.LCD_Dis_Page;
+        Test_Shape(
+            "circle", Framebuffer,
+            [&](LCD_ST7735S *Lcd) {
+              Lcd->LCD_DrawCircle(X, Y, Radius, RED, DRAW_EMPTY, Dot_Pixel);
+            },
+            [&](LCD_ST7735S *Lcd) {
+              if (Inside) {
+                Ref_DrawCircle(Lcd, X, Y, Radius, RED, DRAW_EMPTY, Dot_Pixel);
+                return;
+              }
+              Ref_Curve(Lcd, X, Y, X, Y, RED, DRAW_EMPTY, Dot_Pixel,
+                        [&](const std::function<void(int, int)> &Point) {
+                          Ref_CircleQuadrant(Radius, Point);
+                        });
+            });
+      }
+      uint32_t Windows = Test_Shape(
+          "filled circle", Framebuffer,
+          [&](LCD_ST7735S *Lcd) {
+            Lcd->LCD_DrawCircle(X, Y, Radius, BLUE, DRAW_FULL, DOT_PIXEL_1X1);
+          },
+          [&](LCD_ST7735S *Lcd) {
+            Ref_DrawCircle(Lcd, X, Y, Radius, BLUE, DRAW_FULL, DOT_PIXEL_1X1);
+          });
+      // One span a row at most
+      if (!Framebuffer) {
+        TEST_CHECK(Windows <= 2u * Radius + 1);
+      }
+    }
+  }
+}
+
+static void Test_Ellipses(bool Framebuffer) {
+  static const LCD_LENGTH Radii[][2] = {{0, 0}, {1, 5}, {12, 4}, {30, 17},
+                                        {5, 40}, {20, 0}, {0, 9}};
+  for (const LCD_LENGTH *Radius : Radii) {
+    for (int Dot = 1; Dot <= 3; Dot++) {
+      for (int Fill = 0; Fill < 2; Fill++) {
+        DOT_PIXEL Dot_Pixel = (DOT_PIXEL)Dot;
+        DRAW_FILL Draw_Fill = (DRAW_FILL)Fill;
+        uint32_t Windows = Test_Shape(
+            "ellipse", Framebuffer,
+            [&](LCD_ST7735S *Lcd) {
+              Lcd->LCD_DrawEllipse(60, 70, Radius[0], Radius[1], GREEN,
+                                   Draw_Fill, Dot_Pixel);
+            },
+            [&](LCD_ST7735S *Lcd) {
+              Ref_DrawEllipse(Lcd, 60, 70, Radius[0], Radius[1], GREEN,
+                              Draw_Fill, Dot_Pixel);
+            });
+        if (!Framebuffer && Draw_Fill) {
+          TEST_CHECK(Windows <= 2u * Radius[1] + 1);
+        }
+      }
+    }
+  }
+}
+
+static void Test_Rectangles(bool Framebuffer) {
+  static const LCD_POINT Rects[][4] = {
+      {10, 20, 90, 60}, {90, 60, 10, 20}, {0, 0, 128, 160}, {40, 40, 42, 90}};
+  for (const LCD_POINT *Rect : Rects) {
+    for (int Dot = 1; Dot <= 4; Dot++) {
+      DOT_PIXEL Dot_Pixel = (DOT_PIXEL)Dot;
+      uint32_t Windows = Test_Shape(
+          "rectangle", Framebuffer,
+          [&](LCD_ST7735S *Lcd) {
+            Lcd->LCD_DrawRectangle(Rect[0], Rect[1], Rect[2], Rect[3], RED,
+                                   DRAW_EMPTY, Dot_Pixel);
+          },
+          [&](LCD_ST7735S *Lcd) {
+            Ref_DrawRectangle(Lcd, Rect[0], Rect[1], Rect[2], Rect[3], RED,
+                              DRAW_EMPTY, Dot_Pixel);
+          });
+      if (!Framebuffer) {
+        TEST_CHECK(Windows <= 4);
+      }
+
+      for (LCD_LENGTH Radius : {0, 3, 8, 100}) {
+        for (int Fill = 0; Fill < 2; Fill++) {
+          DRAW_FILL Filled = (DRAW_FILL)Fill;
+          int X0 = Rect[0] < Rect[2] ? Rect[0] : Rect[2];
+          int X1 = Rect[0] < Rect[2] ? Rect[2] : Rect[0];
+          int Y0 = Rect[1] < Rect[3] ? Rect[1] : Rect[3];
+          int Y1 = Rect[1] < Rect[3] ? Rect[3] : Rect[1];
+          Test_Shape(
+              "rounded rectangle", Framebuffer,
+              [&](LCD_ST7735S *Lcd) {
+                Lcd->LCD_DrawRoundRectangle(Rect[0], Rect[1], Rect[2], Rect[3],
+                                            Radius, BLUE, Filled, Dot_Pixel);
+              },
+              [&](LCD_ST7735S *Lcd) {
+                Ref_DrawRoundRectangle(Lcd, X0, Y0, X1, Y1, Radius, BLUE,
+                                       Filled, Dot_Pixel);
+              });
+        }
+      }
+
+      if (Rect[2] > Rect[0] && Rect[3] > Rect[1]) {
+        Windows = Test_Shape(
+            "bordered rectangle", Framebuffer,
+            [&](LCD_ST7735S *Lcd) {
+              Lcd->LCD_DrawBorderedRectangle(Rect[0], Rect[1], Rect[2],
+                                             Rect[3], GRAY, BLACK, Dot_Pixel);
+            },
+            [&](LCD_ST7735S *Lcd) {
+              Ref_DrawBorderedRectangle(Lcd, Rect[0], Rect[1], Rect[2], Rect[3],
+                                        GRAY, BLACK, Dot_Pixel);
+            });
+        if (!Framebuffer) {
+          TEST_CHECK(Windows <= 5);
+        }
+      }
+    }
+  }
+}
+
+int main(void) {
+  for (int Framebuffer = 0; Framebuffer < 2; Framebuffer++) {
+    Test_Circles(Framebuffer);
+    Test_Ellipses(Framebuffer);
+    Test_Rectangles(Framebuffer);
+  }
+
+  // The figures of the requests: a radius 10 disc in about 20 windows, an
+  // outline in 4 fills and a bordered swatch in 5
+  static LCD_ST7735S_Emulator Panel;
+  LCD_Host_Transport Bus;
+  Bus.LCD_SetListener(&Panel);
+  LCD_ST7735S Lcd(&Bus);
+  Lcd.LCD_Init(L2R_U2D);
+  Panel.LCD_ResetStats();
+  Lcd.LCD_DrawCircle(64, 80, 10, BLUE, DRAW_FULL, DOT_PIXEL_1X1);
+  uint32_t Disc = Panel.LCD_GetStats()->Windows;
+  Panel.LCD_ResetStats();
+  Lcd.LCD_DrawRectangle(10, 20, 90, 60, RED, DRAW_EMPTY, DOT_PIXEL_2X2);
+  uint32_t Outline = Panel.LCD_GetStats()->Windows;
+  Panel.LCD_ResetStats();
+  Lcd.LCD_DrawBorderedRectangle(10, 20, 90, 60, GRAY, BLACK, DOT_PIXEL_2X2);
+  uint32_t Swatch = Panel.LCD_GetStats()->Windows;
+  TEST_CHECK(Disc <= 21);
+  TEST_CHECK(Outline == 4);
+  TEST_CHECK(Swatch == 5);
+  printf("radius 10 disc %u windows, outline %u, bordered %u\n", Disc, Outline,
+         Swatch);
+  return TEST_RESULT();
+}
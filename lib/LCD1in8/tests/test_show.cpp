@@ -0,0 +1,127 @@
+/***********************************************************************************************************************
+  | file      	:	test_show.cpp
+  | function	:	LCD_Show drawn by the driver against the same primitives
+  |                 drawn one LCD_SetPointlColor at a time, compared on the
+  |                 GRAM emulator
+***********************************************************************************************************************/
+
+#include "LCD_Emulator.h"
+#include "LCD_Reference.h"
+#include "LCD_Test.h"
+
+static LCD_COLOR test_frame[LCD_FRAMEBUFFER_SIZE];
+
+/*******************************************************************************
+function:
+                LCD_Show, both orientations, drawn with the reference
+*******************************************************************************/
+static void Ref_Show(LCD_ST7735S *Lcd) {
+  LCD_LENGTH Column = sLCD_DIS.LCD_Dis_Column, Page = sLCD_DIS.LCD_Dis_Page;
+  bool Horizontal = Column <= Page;
+
+  Ref_DrawLine(Lcd, 0, 10, Column, 10, RED, LINE_SOLID, DOT_PIXEL_2X2);
+  Ref_DrawLine(Lcd, 0, Page - 10, Column, Page - 10, RED, LINE_SOLID,
+               DOT_PIXEL_2X2);
+  Ref_DrawLine(Lcd, 0, 20, Column, 20, RED, LINE_DOTTED, DOT_PIXEL_DFT);
+  Ref_DrawLine(Lcd, 0, Page - 20, Column, Page - 20, RED, LINE_DOTTED,
+               DOT_PIXEL_DFT);
+
+  Ref_DrawRectangle(Lcd, 0, 0, Column, 8, BLUE, DRAW_FULL, DOT_PIXEL_1X1);
+  Ref_DrawRectangle(Lcd, 0, Page - 10, Column, Page, BLUE, DRAW_FULL,
+                    DOT_PIXEL_1X1);
+  Ref_DrawRectangle(Lcd, 1, 1, Column, Page, RED, DRAW_EMPTY, DOT_PIXEL_2X2);
+
+  uint16_t Cx1 = Horizontal ? 40 : 45, Cy1 = Horizontal ? 85 : 80, Cr = 12;
+  uint16_t Cx2 = Cx1 + (2.5 * Cr), Cy2 = Cy1;
+  uint16_t Cx3 = Cx1 + (5 * Cr), Cy3 = Cy1;
+  uint16_t Cx4 = (Cx1 + Cx2) / 2, Cy4 = Cy1 + Cr;
+  uint16_t Cx5 = (Cx2 + Cx3) / 2, Cy5 = Cy1 + Cr;
+  Ref_DrawCircle(Lcd, Cx1, Cy1, Cr, BLUE, DRAW_EMPTY, DOT_PIXEL_DFT);
+  Ref_DrawCircle(Lcd, Cx2, Cy2, Cr, BLACK, DRAW_EMPTY, DOT_PIXEL_DFT);
+  Ref_DrawCircle(Lcd, Cx3, Cy3, Cr, RED, DRAW_EMPTY, DOT_PIXEL_DFT);
+  Ref_DrawCircle(Lcd, Cx4, Cy4, Cr, YELLOW, DRAW_EMPTY, DOT_PIXEL_DFT);
+  Ref_DrawCircle(Lcd, Cx5, Cy5, Cr, GREEN, DRAW_EMPTY, DOT_PIXEL_DFT);
+
+  if (Horizontal) {
+    Ref_DrawCircle(Lcd, 15, 110, 10, BRRED, DRAW_FULL, DOT_PIXEL_DFT);
+    Ref_DrawCircle(Lcd, Column - 15, 110, 10, BRRED, DRAW_FULL, DOT_PIXEL_DFT);
+    Ref_DisplayString(Lcd, 35, 20, "WaveShare", &Font12, LCD_BACKGROUND, BLUE);
+    Ref_DisplayString(Lcd, 32, 33, "Electronic", &Font12, LCD_BACKGROUND,
+                      BLUE);
+    Ref_DisplayString(Lcd, 28, 45, "1.8inch TFTLCD", &Font8, RED, GRED);
+    Ref_DisplayString(Lcd, 28, 55, "1234567890", &Font12, LCD_BACKGROUND,
+                      BLUE);
+  } else {
+    Ref_DrawCircle(Lcd, 15, 90, 10, BRRED, DRAW_FULL, DOT_PIXEL_DFT);
+    Ref_DrawCircle(Lcd, Column - 15, 90, 10, BRRED, DRAW_FULL, DOT_PIXEL_DFT);
+    Ref_DisplayString(Lcd, 10, 20, "WaveShare Electronic", &Font12,
+                      LCD_BACKGROUND, BLUE);
+    Ref_DisplayString(Lcd, 35, 35, "1.8inch TFTLCD", &Font12, RED, GRED);
+    Ref_DisplayString(Lcd, 35, 50, "1234567890", &Font12, LCD_BACKGROUND,
+                      BLUE);
+  }
+}
+
+/*******************************************************************************
+function:
+                Both drivers start from a cleared panel, then draw LCD_Show;
+                every pixel and the bytes sent are compared
+*******************************************************************************/
+static void Test_Show(LCD_SCAN_DIR Scan, bool Framebuffer) {
+  static LCD_ST7735S_Emulator Panel, Ref_Panel;
+  LCD_Host_Transport Bus, Ref_Bus;
+  Bus.LCD_SetListener(&Panel);
+  Ref_Bus.LCD_SetListener(&Ref_Panel);
+  LCD_ST7735S Lcd(&Bus), Ref(&Ref_Bus);
+
+  Ref.LCD_Init(Scan);
+  for (LCD_POINT Y = 0; Y < sLCD_DIS.LCD_Dis_Page; Y++) {
+    for (LCD_POINT X = 0; X < sLCD_DIS.LCD_Dis_Column; X++) {
+      Ref.LCD_SetPointlColor(X, Y, LCD_BACKGROUND);
+    }
+  }
+  Ref_Panel.LCD_ResetStats();
+  Ref_Show(&Ref);
+
+  Lcd.LCD_Init(Scan);
+  if (Framebuffer) {
+    Lcd.LCD_SetFramebuffer(test_frame);
+  }
+  Lcd.LCD_Clear(LCD_BACKGROUND);
+  Lcd.LCD_Flush();
+  Panel.LCD_ResetStats();
+  Lcd.LCD_Show();
+  Lcd.LCD_Flush();
+
+  uint32_t Differ = 0;
+  for (LCD_POINT Y = 0; Y < sLCD_DIS.LCD_Dis_Page; Y++) {
+    for (LCD_POINT X = 0; X < sLCD_DIS.LCD_Dis_Column; X++) {
+      if (Panel.LCD_GetPixel(X, Y) != Ref_Panel.LCD_GetPixel(X, Y)) {
+        if (!Differ) {
+          printf("first difference at %u,%u: %04x vs %04x\n", X, Y,
+                 Panel.LCD_GetPixel(X, Y), Ref_Panel.LCD_GetPixel(X, Y));
+        }
+        Differ++;
+      }
+    }
+  }
+  TEST_CHECK(Differ == 0);
+
+  const LCD_EMU_STATS *New = Panel.LCD_GetStats();
+  const LCD_EMU_STATS *Old = Ref_Panel.LCD_GetStats();
+  TEST_CHECK(New->Bytes < Old->Bytes);
+  TEST_CHECK(New->Commands < Old->Commands);
+  printf("scan %d %s: %llu bytes, %u commands vs %llu bytes, %u commands "
+         "per pixel\n",
+         Scan, Framebuffer ? "framebuffer" : "direct",
+         (unsigned long long)New->Bytes, New->Commands,
+         (unsigned long long)Old->Bytes, Old->Commands);
+}
+
+int main(void) {
+  Test_Show(L2R_U2D, false);
+  Test_Show(L2R_U2D, true);
+  Test_Show(U2D_L2R, false);
+  Test_Show(U2D_L2R, true);
+  return TEST_RESULT();
+}
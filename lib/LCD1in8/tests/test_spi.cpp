@@ -0,0 +1,142 @@
+/***********************************************************************************************************************
+  | file      	:	test_spi.cpp
+  | function	:	LCD_SPI_Transport on the simulated SDK: its DMA fills
+  |                 and pixel bursts against the per-pixel writes of the
+  |                 original driver
+***********************************************************************************************************************/
+
+#include "LCD_Emulator.h"
+#include "LCD_SPI.h"
+#include "LCD_Test.h"
+
+#define TEST_PIN_CS 9
+#define TEST_PIN_DC 8
+#define TEST_PIN_RST 12
+#define TEST_PIN_BL 13
+
+static void Test_Callback(void *User_Data) { (*(uint32_t *)User_Data)++; }
+
+/*******************************************************************************
+function:
+                LCD_WriteData_NLen16Bit of the original driver
+*******************************************************************************/
+static void Test_WriteData_NLen16Bit(uint16_t Data, uint32_t DataLen) {
+  uint8_t buf[2] = {(uint8_t)(Data >> 8), uint8_t(Data & 0xff)};
+  gpio_put(TEST_PIN_DC, 1);
+  gpio_put(TEST_PIN_CS, 0);
+  for (uint32_t i = 0; i < DataLen; i++) {
+    spi_write_blocking(spi0, buf, 2);
+  }
+  gpio_put(TEST_PIN_CS, 1);
+}
+
+/*******************************************************************************
+function:
+                A DMA fill, completed from the interrupt, sends the bytes
+                of the original loop in one CS burst and restores 8 bit
+                frames
+*******************************************************************************/
+static void Test_Repeated(uint16_t Word, uint32_t Count) {
+  Test_Stream Stream, Reference;
+  Test_Pico_Reset(TEST_PIN_CS, TEST_PIN_DC, TEST_PIN_RST, &Reference);
+  Test_WriteData_NLen16Bit(Word, Count);
+
+  Test_Pico_Reset(TEST_PIN_CS, TEST_PIN_DC, TEST_PIN_RST, &Stream);
+  LCD_SPI_Transport Spi(spi0, TEST_PIN_CS, TEST_PIN_DC, TEST_PIN_RST,
+                        TEST_PIN_BL);
+  Spi.Init();
+  uint32_t Done = 0;
+  Spi.StartRepeated(Word, Count, Test_Callback, &Done);
+  TEST_CHECK(Spi.Busy() == (Count != 0));
+  TEST_CHECK(Done == (Count == 0 ? 1u : 0u));
+  Spi.Wait();
+  TEST_CHECK(!Spi.Busy());
+  TEST_CHECK(Done == 1);
+
+  const TEST_PICO_STATS *Stats = Test_Pico_GetStats();
+  TEST_CHECK(Stream.Bytes == Reference.Bytes);
+  TEST_CHECK(Stats->Errors == 0);
+  TEST_CHECK(spi0->Data_Bits == 8);
+  if (Count) {
+    TEST_CHECK(Stats->Cs_Edges == 1);
+    TEST_CHECK(Stats->Dma_Runs == 1);
+    TEST_CHECK(Stats->Data_Bits == 16);
+    TEST_CHECK(!Stats->Read_Increment);
+  }
+}
+
+/*******************************************************************************
+function:
+                A pixel burst reads the buffer, MSB first, and the bus
+                takes 8 bit register writes again afterwards
+*******************************************************************************/
+static void Test_Pixels(void) {
+  static const uint16_t Pixels[] = {0x1234, 0xF800, 0x07E0, 0x001F, 0xABCD};
+  Test_Stream Stream;
+  Test_Pico_Reset(TEST_PIN_CS, TEST_PIN_DC, TEST_PIN_RST, &Stream);
+  LCD_SPI_Transport Spi(spi0, TEST_PIN_CS, TEST_PIN_DC, TEST_PIN_RST,
+                        TEST_PIN_BL);
+  Spi.Init();
+  Spi.StartPixels(Pixels, 5, nullptr, nullptr);
+  uint8_t Param = 0x05;
+  Spi.WriteCommand(0x3A, &Param, 1);
+
+  std::vector<uint16_t> Expected;
+  for (uint16_t Pixel : Pixels) {
+    Expected.push_back(Pixel >> 8);
+    Expected.push_back(Pixel & 0xff);
+  }
+  Expected.push_back(0x100 | 0x3A);
+  Expected.push_back(0x05);
+  const TEST_PICO_STATS *Stats = Test_Pico_GetStats();
+  TEST_CHECK(Stream.Bytes == Expected);
+  TEST_CHECK(Stats->Read_Increment);
+  TEST_CHECK(Stats->Errors == 0);
+  TEST_CHECK(Stats->Cs_Edges == 2);
+}
+
+/*******************************************************************************
+function:
+                The driver over SPI sends what it sends over the host
+                transport, and the panel shows the fills
+*******************************************************************************/
+static void Test_Driver(void) {
+  static LCD_ST7735S_Emulator Panel;
+  Test_Stream Stream(&Panel), Host_Stream;
+  Test_Pico_Reset(TEST_PIN_CS, TEST_PIN_DC, TEST_PIN_RST, &Stream);
+  LCD_SPI_Transport Spi(spi0, TEST_PIN_CS, TEST_PIN_DC, TEST_PIN_RST,
+                        TEST_PIN_BL);
+  LCD_Host_Transport Host;
+  Host.LCD_SetListener(&Host_Stream);
+  LCD_ST7735S Lcd(&Spi), Host_Lcd(&Host);
+
+  Lcd.LCD_Init(L2R_U2D);
+  Host_Lcd.LCD_Init(L2R_U2D);
+  Lcd.LCD_Clear(GRAY);
+  Host_Lcd.LCD_Clear(GRAY);
+  Lcd.LCD_SetArealColor(17, 9, 101, 77, 0xFEDC);
+  Host_Lcd.LCD_SetArealColor(17, 9, 101, 77, 0xFEDC);
+  Lcd.LCD_SetArealColor_Async(5, 6, 70, 80, BLUE);
+  Host_Lcd.LCD_SetArealColor_Async(5, 6, 70, 80, BLUE);
+  Lcd.LCD_Wait();
+  Host_Lcd.LCD_Wait();
+
+  TEST_CHECK(Stream.Bytes == Host_Stream.Bytes);
+  TEST_CHECK(Test_Pico_GetStats()->Errors == 0);
+  TEST_CHECK(Panel.LCD_GetPixel(0, 0) == GRAY);
+  TEST_CHECK(Panel.LCD_GetPixel(100, 76) == 0xFEDC);
+  TEST_CHECK(Panel.LCD_GetPixel(5, 6) == BLUE);
+  TEST_CHECK(Panel.LCD_GetPixel(127, 159) == GRAY);
+  printf("driver over SPI: %zu bytes, %u DMA transfers\n", Stream.Bytes.size(),
+         Test_Pico_GetStats()->Dma_Runs);
+}
+
+int main(void) {
+  Test_Repeated(0xF81F, 1);
+  Test_Repeated(0x1234, 1000);
+  Test_Repeated(GRAY, 128 * 160);
+  Test_Repeated(RED, 0);
+  Test_Pixels();
+  Test_Driver();
+  return TEST_RESULT();
+}
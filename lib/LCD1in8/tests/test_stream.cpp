@@ -0,0 +1,119 @@
+/***********************************************************************************************************************
+  | file      	:	test_stream.cpp
+  | function	:	Bytes of the DMA fills and of LCD_SetWindows against the
+  |                 streams of the original driver
+***********************************************************************************************************************/
+
+#include "LCD_Emulator.h"
+#include "LCD_Test.h"
+
+/*******************************************************************************
+function:
+                Panel stream of a fill written one pixel at a time, the way
+                LCD_WriteData_16Bit did before the DMA path
+*******************************************************************************/
+static void Test_ReferenceFill(LCD_ST7735S *Lcd, LCD_Host_Transport *Bus,
+                               LCD_POINT Xstart, LCD_POINT Ystart,
+                               LCD_POINT Xend, LCD_POINT Yend,
+                               LCD_COLOR Color) {
+  if (Xend <= Xstart || Yend <= Ystart) {
+    return;
+  }
+  Lcd->LCD_SetWindows(Xstart, Ystart, Xend, Yend);
+  uint8_t Pixel[2] = {(uint8_t)(Color >> 8), (uint8_t)(Color & 0xff)};
+  for (uint32_t i = 0; i < (uint32_t)(Xend - Xstart) * (Yend - Ystart); i++) {
+    Bus->WriteData(Pixel, sizeof(Pixel));
+  }
+}
+
+static void Test_Fills(LCD_SCAN_DIR Scan_Dir) {
+  static const LCD_RECT Windows[] = {
+      {0, 0, 1, 1}, {3, 5, 60, 6}, {10, 20, 11, 90}, {17, 9, 101, 77}};
+  static const LCD_COLOR Colors[] = {RED, 0x1234, BLACK, 0xFEDC};
+
+  LCD_Host_Transport Bus, Reference_Bus;
+  Test_Stream Stream, Reference;
+  LCD_ST7735S Lcd(&Bus), Reference_Lcd(&Reference_Bus);
+  Lcd.LCD_Init(Scan_Dir);
+  Reference_Lcd.LCD_Init(Scan_Dir);
+  Bus.LCD_SetListener(&Stream);
+  Reference_Bus.LCD_SetListener(&Reference);
+
+  Lcd.LCD_Clear(GRAY);
+  Test_ReferenceFill(&Reference_Lcd, &Reference_Bus, 0, 0,
+                     sLCD_DIS.LCD_Dis_Column, sLCD_DIS.LCD_Dis_Page, GRAY);
+  for (uint32_t i = 0; i < sizeof(Windows) / sizeof(Windows[0]); i++) {
+    const LCD_RECT *Rect = &Windows[i];
+    Lcd.LCD_SetArealColor(Rect->Xstart, Rect->Ystart, Rect->Xend, Rect->Yend,
+                          Colors[i]);
+    Test_ReferenceFill(&Reference_Lcd, &Reference_Bus, Rect->Xstart,
+                       Rect->Ystart, Rect->Xend, Rect->Yend, Colors[i]);
+  }
+  // The asynchronous fill sends the same bytes once it has completed
+  Lcd.LCD_SetArealColor_Async(5, 6, 70, 80, BLUE);
+  Lcd.LCD_Wait();
+  Test_ReferenceFill(&Reference_Lcd, &Reference_Bus, 5, 6, 70, 80, BLUE);
+
+  TEST_CHECK(Stream.Bytes.size() == Reference.Bytes.size());
+  TEST_CHECK(Stream.Bytes == Reference.Bytes);
+  // The repeated words go out as one burst per fill
+  TEST_CHECK(Bus.LCD_TransactionCount() < Reference_Bus.LCD_TransactionCount());
+  printf("scan %d: %zu bytes, %u bursts (per pixel: %u)\n", Scan_Dir,
+         Stream.Bytes.size(), Bus.LCD_TransactionCount(),
+         Reference_Bus.LCD_TransactionCount());
+}
+
+/*******************************************************************************
+function:
+                LCD_SetWindows, one CS burst per register and its
+                parameters, against the original burst per byte
+*******************************************************************************/
+static void Test_Windows(void) {
+  static LCD_ST7735S_Emulator Panel, Reference_Panel;
+  LCD_Host_Transport Bus, Reference_Bus;
+  Test_Stream Stream(&Panel), Reference(&Reference_Panel);
+  LCD_ST7735S Lcd(&Bus);
+  Lcd.LCD_Init(L2R_U2D);
+  Bus.LCD_SetListener(&Stream);
+  Reference_Bus.LCD_SetListener(&Reference);
+  Bus.LCD_ClearRecords();
+  Panel.LCD_ResetStats();
+  Reference_Panel.LCD_ResetStats();
+
+  Lcd.LCD_SetWindows(7, 9, 100, 120);
+
+  // LCD_WriteReg + LCD_WriteData_8Bit, as before the command bursts
+  uint8_t Column[4] = {0x00, (uint8_t)(7 + sLCD_DIS.LCD_X_Adjust), 0x00,
+                       (uint8_t)(99 + sLCD_DIS.LCD_X_Adjust)};
+  uint8_t Page[4] = {0x00, (uint8_t)(9 + sLCD_DIS.LCD_Y_Adjust), 0x00,
+                     (uint8_t)(119 + sLCD_DIS.LCD_Y_Adjust)};
+  Reference_Bus.WriteCommand(0x2A, nullptr, 0);
+  for (uint8_t Byte : Column) {
+    Reference_Bus.WriteData(&Byte, 1);
+  }
+  Reference_Bus.WriteCommand(0x2B, nullptr, 0);
+  for (uint8_t Byte : Page) {
+    Reference_Bus.WriteData(&Byte, 1);
+  }
+  Reference_Bus.WriteCommand(0x2C, nullptr, 0);
+
+  const LCD_EMU_STATS *Stats = Panel.LCD_GetStats();
+  const LCD_EMU_STATS *Reference_Stats = Reference_Panel.LCD_GetStats();
+  TEST_CHECK(Stream.Bytes == Reference.Bytes);
+  TEST_CHECK(Stats->Commands == 3 && Reference_Stats->Commands == 3);
+  TEST_CHECK(Stats->Command_Bytes == 11);
+  TEST_CHECK(Stats->Command_Bytes == Reference_Stats->Command_Bytes);
+  TEST_CHECK(Bus.LCD_TransactionCount() == 3);
+  TEST_CHECK(Reference_Bus.LCD_TransactionCount() == 11);
+  printf("LCD_SetWindows: %u commands, %llu bytes, CS edges %u (was %u)\n",
+         Stats->Commands, (unsigned long long)Stats->Command_Bytes,
+         2 * Bus.LCD_TransactionCount(),
+         2 * Reference_Bus.LCD_TransactionCount());
+}
+
+int main(void) {
+  Test_Fills(L2R_U2D);
+  Test_Fills(U2D_L2R);
+  Test_Windows();
+  return TEST_RESULT();
+}
@@ -0,0 +1,131 @@
+/***********************************************************************************************************************
+  | file      	:	test_swapchain.cpp
+  | function	:	Frames of a swap chain against a framebuffer drawn the same
+  |                 way, and the time a flush of several regions holds back
+  |                 the next present
+***********************************************************************************************************************/
+
+#include "LCD_Emulator.h"
+#include "LCD_SwapChain.h"
+#include "LCD_Test.h"
+
+#include <string.h>
+
+static LCD_COLOR test_buffer[2][LCD_FRAMEBUFFER_SIZE];
+static LCD_COLOR test_frame[LCD_FRAMEBUFFER_SIZE];
+
+// Changes of frame i only, the rest is kept from the frames before
+static void Test_DrawFrame(LCD_ST7735S *Lcd, uint32_t i) {
+  char Text[8];
+  LCD_POINT X = i * 37 % 100, Y = 20 + i * 23 % 110;
+  Lcd->LCD_SetArealColor(X, Y, X + 12 + i % 5, Y + 9, 0x1863 * i);
+  Lcd->LCD_DrawCircle(64, 80, 5 + i % 40, 0xf800 >> (i % 11), DRAW_EMPTY,
+                      DOT_PIXEL_1X1);
+  snprintf(Text, sizeof(Text), "%u", i);
+  Lcd->LCD_DisplayString(2, 2, Text, &Font12, BLACK, WHITE);
+}
+
+static uint32_t Test_Different(LCD_ST7735S_Emulator *Panel,
+                               const LCD_COLOR *Frame) {
+  uint32_t Different = 0;
+  for (LCD_POINT Y = 0; Y < sLCD_DIS.LCD_Dis_Page; Y++) {
+    for (LCD_POINT X = 0; X < sLCD_DIS.LCD_Dis_Column; X++) {
+      Different += Panel->LCD_GetPixel(X, Y) !=
+                   Frame[(uint32_t)Y * sLCD_DIS.LCD_Dis_Column + X];
+    }
+  }
+  return Different;
+}
+
+static void Test_Frames(void) {
+  static LCD_ST7735S_Emulator Panel;
+  LCD_Host_Transport Bus, Ref_Bus;
+  Bus.LCD_SetListener(&Panel);
+  LCD_ST7735S Lcd(&Bus), Ref_Lcd(&Ref_Bus);
+  Lcd.LCD_Init(L2R_U2D);
+  Ref_Lcd.LCD_Init(L2R_U2D);
+  Ref_Lcd.LCD_SetFramebuffer(test_frame);
+
+  LCD_Swap_Chain Chain(&Lcd, test_buffer[0], test_buffer[1], 0);
+  Chain.LCD_Begin();
+  Lcd.LCD_Clear(GRAY);
+  Ref_Lcd.LCD_Clear(GRAY);
+
+  uint32_t Back_Different = 0, Panel_Different = 0;
+  for (uint32_t i = 0; i < 50; i++) {
+    Test_DrawFrame(&Lcd, i);
+    Test_DrawFrame(&Ref_Lcd, i);
+    Chain.LCD_Present();
+    // The new back buffer holds the frame just presented
+    Back_Different += memcmp(Chain.LCD_BackBuffer(), test_frame,
+                             sizeof(test_frame)) != 0;
+    while (Chain.LCD_Poll()) {
+    }
+    Panel_Different += Test_Different(&Panel, test_frame);
+  }
+  TEST_CHECK(Back_Different == 0);
+  TEST_CHECK(Panel_Different == 0);
+  TEST_CHECK(Chain.LCD_GetStats()->Frames == 50);
+}
+
+/********************************************************************************
+  function:
+                        Present a frame of three regions and, right after it,
+                        an empty one
+********************************************************************************/
+static void Test_Regions(uint32_t Rate, LCD_SWAP_STATS *Stats) {
+  static LCD_ST7735S_Emulator Panel;
+  LCD_Host_Transport Bus;
+  Bus.LCD_SetListener(&Panel);
+  LCD_ST7735S Lcd(&Bus);
+  Lcd.LCD_Init(L2R_U2D);
+  LCD_Swap_Chain Chain(&Lcd, test_buffer[0], test_buffer[1], Rate);
+  Chain.LCD_Begin();
+  Lcd.LCD_Clear(WHITE);
+  Chain.LCD_Present();
+  Lcd.LCD_Wait();
+
+  // Too far apart to be merged, the flush needs a window for each
+  Lcd.LCD_SetArealColor(2, 3, 10, 9, RED);
+  Lcd.LCD_SetArealColor(90, 120, 120, 150, BLUE);
+  Lcd.LCD_SetArealColor(50, 60, 51, 61, GREEN);
+  Chain.LCD_Present();
+  Panel.LCD_ResetStats();
+  Chain.LCD_ResetStats();
+  Chain.LCD_Present();
+  *Stats = *Chain.LCD_GetStats();
+
+  TEST_CHECK(Panel.LCD_GetStats()->Windows == 2);
+  TEST_CHECK(Panel.LCD_GetPixel(9, 8) == RED);
+  TEST_CHECK(Panel.LCD_GetPixel(119, 149) == BLUE);
+  TEST_CHECK(Panel.LCD_GetPixel(50, 60) == GREEN);
+}
+
+static void Test_Wait(void) {
+  // Bus time of the two regions after the first, at 62.5 MHz
+  const uint32_t Bytes = (30 * 30 + 1) * 2;
+  const uint32_t Bus_us = Bytes * 8 / 62;
+  LCD_SWAP_STATS Stats;
+
+  // Without a cap, the next present waits for the rest of the flush
+  Test_Regions(0, &Stats);
+  TEST_CHECK(Stats.Pace_us == 0);
+  TEST_CHECK(Stats.Wait_us >= Bus_us && Stats.Wait_us < 2 * Bus_us);
+  TEST_CHECK(Stats.Flush_us > Stats.Wait_us);
+  TEST_CHECK(Stats.Frame_us >= Stats.Render_us + Stats.Wait_us);
+
+  // Held back by the cap, the pacer sends it meanwhile. The clock counts
+  // nanoseconds, read back in whole microseconds
+  Test_Regions(30, &Stats);
+  TEST_CHECK(Stats.Wait_us == 0);
+  TEST_CHECK(Stats.Pace_us > Bus_us);
+  TEST_CHECK(Stats.Frame_us >= 1000000 / 30 &&
+             Stats.Frame_us <= 1000000 / 30 + 1);
+  TEST_CHECK(Stats.Idle_Total_us == Stats.Pace_us);
+}
+
+int main(void) {
+  Test_Frames();
+  Test_Wait();
+  return TEST_RESULT();
+}